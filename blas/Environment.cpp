@@ -16,6 +16,9 @@ namespace nd4j {
         _verbose.store(false);
         _debug.store(false);
         _profile.store(false);
+        _workspaceMmap.store(false);
+        _tadCacheHits.store(0);
+        _tadCacheMisses.store(0);
 
 #ifndef ANDROID
         const char* omp_threads = std::getenv("OMP_NUM_THREADS");
@@ -96,6 +99,35 @@ namespace nd4j {
         _maxThreads.store(max);
     }
 
+    bool Environment::isWorkspaceMmap() {
+        return _workspaceMmap.load();
+    }
+
+    void Environment::setWorkspaceMmap(bool reallyMmap) {
+        _workspaceMmap.store(reallyMmap);
+    }
+
+    Nd4jIndex Environment::tadCacheHits() {
+        return _tadCacheHits.load();
+    }
+
+    Nd4jIndex Environment::tadCacheMisses() {
+        return _tadCacheMisses.load();
+    }
+
+    void Environment::countTadCacheHit() {
+        _tadCacheHits++;
+    }
+
+    void Environment::countTadCacheMiss() {
+        _tadCacheMisses++;
+    }
+
+    void Environment::resetTadCacheCounters() {
+        _tadCacheHits.store(0);
+        _tadCacheMisses.store(0);
+    }
+
     nd4j::Environment *nd4j::Environment::_instance = 0;
 
 }
@@ -7,6 +7,7 @@
 
 #include <atomic>
 #include <dll.h>
+#include <pointercast.h>
 
 namespace nd4j{
     class ND4J_EXPORT Environment {
@@ -17,6 +18,9 @@ namespace nd4j{
         std::atomic<bool> _debug;
         std::atomic<bool> _profile;
         std::atomic<int> _maxThreads;
+        std::atomic<bool> _workspaceMmap;
+        std::atomic<Nd4jIndex> _tadCacheHits;
+        std::atomic<Nd4jIndex> _tadCacheMisses;
 
         static Environment* _instance;
 
@@ -41,6 +45,21 @@ namespace nd4j{
 
         int maxThreads();
         void setMaxThreads(int max);
+
+        /**
+         * If enabled, workspace buffers are backed by anonymous mmap (MAP_NORESERVE, huge pages if available)
+         */
+        bool isWorkspaceMmap();
+        void setWorkspaceMmap(bool reallyMmap);
+
+        /**
+         * TAD cache statistics
+         */
+        Nd4jIndex tadCacheHits();
+        Nd4jIndex tadCacheMisses();
+        void countTadCacheHit();
+        void countTadCacheMiss();
+        void resetTadCacheCounters();
     };
 }
 
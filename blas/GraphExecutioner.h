@@ -24,7 +24,11 @@ namespace nd4j {
     template <typename T>
     class GraphExecutioner {
     protected:
-
+        /**
+        * This method executes dataflow Graph by dependencies: nodes are executed by pool of workers as soon as all their inputs are available
+        * @return
+        */
+        static Nd4jStatus executeParallel(Graph<T> *graph, VariableSpace<T>* variableSpace);
 
     public:
         //static Nd4jStatus executeFlatNode(nd4j::graph::Graph *graph, nd4j::graph::Node *node, nd4j::graph::VariableSpace<float> *variableSpace);
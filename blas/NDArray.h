@@ -1327,10 +1327,16 @@ FORCEINLINE T NDArray<T>::operator()(const Nd4jIndex i) const {
     else if(ews > 1 && order == 'c')
         return _buffer[i*ews];
     else {
-        int idx[MAX_RANK];
-        shape::ind2subC(rankOf(), shapeOf(), i, idx);
-        Nd4jIndex offset = shape::getOffset(0, shapeOf(), stridesOf(), idx, rankOf());
-        return _buffer[offset];        
+        // random access can't be incremental, but we still don't need coordinates array here
+        int *shape = shapeOf();
+        int *stride = stridesOf();
+        Nd4jIndex index = i;
+        Nd4jIndex offset = 0;
+        for (int e = rankOf() - 1; e >= 0; e--) {
+            offset += (index % shape[e]) * stride[e];
+            index /= shape[e];
+        }
+        return _buffer[offset];
     }
 }
 
@@ -1350,10 +1356,16 @@ FORCEINLINE T& NDArray<T>::operator()(const Nd4jIndex i) {
     else if(ews > 1 && order == 'c')
         return _buffer[i*ews];
     else {
-        int idx[MAX_RANK];
-        shape::ind2subC(rankOf(), shapeOf(), i, idx);
-        Nd4jIndex offset = shape::getOffset(0, shapeOf(), stridesOf(), idx, rankOf());
-        return _buffer[offset];        
+        // random access can't be incremental, but we still don't need coordinates array here
+        int *shape = shapeOf();
+        int *stride = stridesOf();
+        Nd4jIndex index = i;
+        Nd4jIndex offset = 0;
+        for (int e = rankOf() - 1; e >= 0; e--) {
+            offset += (index % shape[e]) * stride[e];
+            index /= shape[e];
+        }
+        return _buffer[offset];
     }    
 }
 
@@ -493,6 +493,14 @@ public:
         nd4j::SpecialMethods<T>::sortTadGeneric(x, xShapeInfo, dimension, dimensionLength, tadShapeInfo, tadOffsets, descending);
     }
 
+    inline static void execSortByKey(T *x, int *xShapeInfo, T *y, int *yShapeInfo, bool descending) {
+        nd4j::SpecialMethods<T>::sortByKeyGeneric(x, xShapeInfo, y, yShapeInfo, descending);
+    }
+
+    inline static void execArgsort(T *x, int *xShapeInfo, Nd4jIndex *z, bool descending) {
+        nd4j::SpecialMethods<T>::argsortGeneric(x, xShapeInfo, z, descending);
+    }
+
     inline static void execSortCooIndices(int *indices, T *values, Nd4jIndex length, int rank) {
         nd4j::sparse::SparseUtils<T>::sortCooIndicesGeneric(indices, values, length, rank);
     }
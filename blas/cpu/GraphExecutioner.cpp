@@ -15,6 +15,7 @@
 #include <Scope.h>
 #include <GraphExecutioner.h>
 #include <graph/TimeHolder.h>
+#include <graph/MappedFile.h>
 #include <loops/scalar.h>
 #include <loops/pairwise_transform.h>
 #include <loops/transform.h>
@@ -34,6 +35,12 @@
 #include <helpers/ShapeUtils.h>
 #include <Status.h>
 #include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <memory>
+#include <omp.h>
 
 namespace nd4j{
 namespace graph {
@@ -179,6 +186,122 @@ template <typename T>
 }
 
 
+/**
+ * This method executes dataflow Graph by dependencies.
+ *
+ * Each node has in-degree counter (built along with Graph), which gets decremented once producer of its input is executed.
+ * Nodes with zero counter land into ready queue, which is served by pool of workers. Each worker gets its share of
+ * OpenMP threads, so total number of threads stays the same as for sequential execution.
+ *
+ * @param graph
+ * @param variableSpace
+ * @return
+ */
+template <typename T>
+Nd4jStatus GraphExecutioner<T>::executeParallel(Graph<T> *graph, VariableSpace<T>* variableSpace) {
+    auto flowPath = variableSpace->flowPath();
+    auto order = graph->executionOrder();
+    auto dependents = graph->dependents();
+    auto inDegrees = graph->inDegrees();
+
+    int numNodes = (int) order->size();
+    int maxThreads = omp_get_max_threads();
+    int numWorkers = nd4j::math::nd4j_min<int>(graph->maxWidth(), maxThreads);
+    int innerThreads = nd4j::math::nd4j_max<int>(1, maxThreads / numWorkers);
+
+    std::unique_ptr<std::atomic<int>[]> pending(new std::atomic<int>[numNodes]);
+    std::deque<int> ready;
+    for (int e = 0; e < numNodes; e++) {
+        pending[e].store(inDegrees->at(e));
+
+        if (inDegrees->at(e) == 0)
+            ready.emplace_back(e);
+
+        // states are created upfront, so workers only update existing entries
+        flowPath->markNodeActive(order->at(e)->id(), true);
+    }
+
+    std::mutex queueLock;
+    std::condition_variable queueCondition;
+    int remaining = numNodes;
+    Nd4jStatus result = ND4J_STATUS_OK;
+    std::exception_ptr exception = nullptr;
+
+    auto worker = [&]() {
+        omp_set_num_threads(innerThreads);
+
+        while (true) {
+            int e;
+            {
+                std::unique_lock<std::mutex> lock(queueLock);
+                queueCondition.wait(lock, [&] { return !ready.empty() || remaining == 0 || result != ND4J_STATUS_OK; });
+
+                if (ready.empty() || result != ND4J_STATUS_OK)
+                    return;
+
+                e = ready.front();
+                ready.pop_front();
+            }
+
+            auto node = order->at(e);
+            nd4j_debug("Parallel step: Node: %i <%s>\n", node->id(), node->name()->c_str());
+
+            Nd4jStatus status = ND4J_STATUS_OK;
+            try {
+                auto timeStart = std::chrono::system_clock::now();
+
+                status = executeFlatNode(graph, node, variableSpace);
+
+                auto timeEnd = std::chrono::system_clock::now();
+                auto outerTime = std::chrono::duration_cast<std::chrono::nanoseconds>(timeEnd - timeStart).count();
+
+                flowPath->setOuterTime(node->id(), outerTime);
+                flowPath->markExecuted(node->id(), true);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(queueLock);
+                if (exception == nullptr)
+                    exception = std::current_exception();
+
+                status = ND4J_STATUS_BAD_INPUT;
+            }
+
+            std::lock_guard<std::mutex> lock(queueLock);
+            if (status != ND4J_STATUS_OK) {
+                if (result == ND4J_STATUS_OK)
+                    result = status;
+
+                // no new nodes will be scheduled, workers will drain and quit
+                ready.clear();
+                queueCondition.notify_all();
+                return;
+            }
+
+            // some other node has failed meanwhile, so dependents are never scheduled
+            if (result != ND4J_STATUS_OK)
+                return;
+
+            remaining--;
+            for (auto d: dependents->at(e))
+                if (--pending[d] == 0)
+                    ready.emplace_back(d);
+
+            queueCondition.notify_all();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (int w = 0; w < numWorkers; w++)
+        workers.emplace_back(worker);
+
+    for (auto &w: workers)
+        w.join();
+
+    if (exception != nullptr)
+        std::rethrow_exception(exception);
+
+    return result;
+}
+
 /**
  * This method executes given Graph instance, and returns error code.
  *
@@ -199,7 +322,9 @@ Nd4jStatus GraphExecutioner<T>::execute(Graph<T> *graph, VariableSpace<T>* varia
     Nd4jIndex tb0 = Environment::getInstance()->isProfiling() ? GraphProfile::currentTime() : 0L;
     graph->buildGraph();
 
-    auto footprintForward = nd4j::memory::MemoryRegistrator::getInstance()->getGraphMemoryFootprint(graph->hashCode());
+    // structural hash is cached by graph, so key only depends on shapes of external variables of this run
+    auto footprintKey = graph->footprintKey(__variableSpace);
+    auto footprintForward = nd4j::memory::MemoryRegistrator::getInstance()->getGraphMemoryFootprint(footprintKey);
     if (footprintForward > 0) {
         if (__variableSpace->workspace() != nullptr) {
             // this method will work only if current workspace size is smaller then proposed value
@@ -208,14 +333,28 @@ Nd4jStatus GraphExecutioner<T>::execute(Graph<T> *graph, VariableSpace<T>* varia
         }
     }
 
-    // optionally saving graph build time
-    if (Environment::getInstance()->isProfiling())
-        flowPath->profile()->setBuildTime(GraphProfile::relativeTime(tb0));
+    // optionally saving graph build time, import time included
+    if (Environment::getInstance()->isProfiling()) {
+        flowPath->profile()->setBuildTime(graph->importTime() + GraphProfile::relativeTime(tb0));
+        flowPath->profile()->setImportMemory(graph->bytesMapped(), graph->bytesConverted());
+    }
 
     Nd4jIndex timeStart = Environment::getInstance()->isProfiling() ? GraphProfile::currentTime() : 0L;
 
     bool pe = graph->getExecutorConfiguration()->_executionMode == ExecutionMode_AUTO;
 
+    // pure dataflow graphs are executed by dependencies, with independent nodes in flight at the same time
+    if (pe && graph->isParallelizable() && omp_get_max_threads() > 1 && !Environment::getInstance()->isProfiling()) {
+        auto status = executeParallel(graph, __variableSpace);
+
+        if (status == ND4J_STATUS_OK && __variableSpace->workspace() != nullptr)
+            nd4j::memory::MemoryRegistrator::getInstance()->setGraphMemoryFootprintIfGreater(footprintKey, __variableSpace->workspace()->getAllocatedSize());
+
+        if (tempFlow)
+            delete flowPath;
+
+        return status;
+    }
 
     // basically if at some point code diverges, code branch might be _DISABLED_, and all nodes within that branch will be disabled as well
 
@@ -468,7 +607,7 @@ Nd4jStatus GraphExecutioner<T>::execute(Graph<T> *graph, VariableSpace<T>* varia
 
     // saving memory footprint for current run
     if (__variableSpace->workspace() != nullptr) {
-        nd4j::memory::MemoryRegistrator::getInstance()->setGraphMemoryFootprintIfGreater(graph->hashCode(), __variableSpace->workspace()->getAllocatedSize());
+        nd4j::memory::MemoryRegistrator::getInstance()->setGraphMemoryFootprintIfGreater(footprintKey, __variableSpace->workspace()->getAllocatedSize());
     }
 
     if (tempFlow)
@@ -816,12 +955,13 @@ uint8_t* readFlatBuffers(const char * filename) {
     uint8_t * data = new uint8_t[fileLen];
 
     FILE *in = fopen(filename, "rb");
-    int cnt = 0;
-
-    while (cnt < fileLen) {
-        fread(data + cnt, 1, 1, in);
+    if (in == nullptr || (long) fread(data, 1, (size_t) fileLen, in) != fileLen) {
+        if (in != nullptr)
+            fclose(in);
 
-        cnt++;
+        delete[] data;
+        nd4j_printf("Unable to read file [%s]\n", filename);
+        throw "Unable to read file";
     }
     fclose(in);
 
@@ -832,16 +972,27 @@ uint8_t* readFlatBuffers(const char * filename) {
 /**
 *   This method reads given FlatBuffers file, and returns Graph instance
 *
-*   PLEASE NOTE: This method is mostly suited for tests and debugging/profiling
+*   File is memory mapped, and Graph keeps the mapping: variables stored in T and native byte order use file memory as is,
+*   so only mismatching variables are converted into heap buffers
 */
 template <typename T>
 Graph<T>* GraphExecutioner<T>::importFromFlatBuffers(const char *filename) {
-    uint8_t* data = readFlatBuffers(filename);
+    auto timeStart = GraphProfile::currentTime();
+
+    auto file = new MappedFile(filename);
+
+    Graph<T>* restoredGraph = nullptr;
+    try {
+        restoredGraph = new Graph<T>(GetFlatGraph(file->data()), nullptr, file);
+    } catch (...) {
+        delete file;
+        throw;
+    }
+
+    restoredGraph->setImportTime(GraphProfile::relativeTime(timeStart));
 
-    auto restoredGraph = importFromFlatPointer(reinterpret_cast<Nd4jPointer>(data));
+    nd4j_debug("Graph imported in %lld ns: %lld bytes mapped, %lld bytes converted\n", restoredGraph->importTime(), restoredGraph->bytesMapped(), restoredGraph->bytesConverted());
 
-    delete[] data;
-    
     return restoredGraph;
 }
 
@@ -12,6 +12,7 @@
 #include <types/float16.h>
 #include <helpers/ShapeUtils.h>
 #include <helpers/BlasHelper.h>
+#include <helpers/TadCache.h>
 
 namespace nd4j {
 
@@ -41,12 +42,10 @@ namespace nd4j {
         Nd4jIndex tadLength = shape::tadLength(ndArray->getShapeInfo(), copy.data(), copy.size());
         Nd4jIndex numTads = ndArray->lengthOf() / tadLength;
 
-        std::unique_ptr<shape::TAD> tad(new shape::TAD(ndArray->getShapeInfo(), copy.data(), copy.size()));
-        tad->createTadOnlyShapeInfo();
-        tad->createOffsets();
+        auto tadPack = nd4j::TadCache::getInstance()->tadForDimensions(ndArray->getShapeInfo(), copy.data(), (int) copy.size());
 
-        int* shapeInfo = new int[shape::shapeInfoLength(tad->tadOnlyShapeInfo[0])];
-        std::memcpy(shapeInfo, tad->tadOnlyShapeInfo, shape::shapeInfoByteLength(tad->tadOnlyShapeInfo));
+        int* shapeInfo = new int[shape::shapeInfoLength(tadPack->primaryShapeInfo()[0])];
+        std::memcpy(shapeInfo, tadPack->primaryShapeInfo(), shape::shapeInfoByteLength(tadPack->primaryShapeInfo()));
 
         for (auto idx: indices) {
             if (idx >= numTads) {
@@ -55,7 +54,7 @@ namespace nd4j {
             }
 
 
-            T* buffer = ndArray->getBuffer() + tad->tadOffsets[idx];
+            T* buffer = ndArray->getBuffer() + tadPack->primaryOffsets()[idx];
             auto array = new NDArray<T>(buffer, shapeInfo);
             result->push_back(array);
         }
@@ -94,15 +93,13 @@ namespace nd4j {
         Nd4jIndex tadLength = shape::tadLength(ndArray->getShapeInfo(), copy.data(), copy.size());
         Nd4jIndex numTads = ndArray->lengthOf() / tadLength;
 
-        std::unique_ptr<shape::TAD> tad(new shape::TAD(ndArray->getShapeInfo(), copy.data(), copy.size()));
-        tad->createTadOnlyShapeInfo();
-        tad->createOffsets();
+        auto tadPack = nd4j::TadCache::getInstance()->tadForDimensions(ndArray->getShapeInfo(), copy.data(), (int) copy.size());
 
-        int* shapeInfo = new int[shape::shapeInfoLength(tad->tadOnlyShapeInfo[0])];
-        std::memcpy(shapeInfo, tad->tadOnlyShapeInfo, shape::shapeInfoByteLength(tad->tadOnlyShapeInfo));
+        int* shapeInfo = new int[shape::shapeInfoLength(tadPack->primaryShapeInfo()[0])];
+        std::memcpy(shapeInfo, tadPack->primaryShapeInfo(), shape::shapeInfoByteLength(tadPack->primaryShapeInfo()));
 
         for (int idx = 0; idx < numTads; idx++ ) {
-            T* buffer = const_cast<NDArray<T>*>(ndArray)->getBuffer() + tad->tadOffsets[idx];
+            T* buffer = const_cast<NDArray<T>*>(ndArray)->getBuffer() + tadPack->primaryOffsets()[idx];
             auto array = new NDArray<T>(buffer, shapeInfo);
             result->push_back(array);
         }
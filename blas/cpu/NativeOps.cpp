@@ -12,6 +12,9 @@
 #include <templatemath.h>
 #include <types/float8.h>
 #include <loops/type_conversions.h>
+#include <helpers/threshold.h>
+#include <helpers/TadCache.h>
+#include <helpers/StridedIterator.h>
 #include <loops/aggregates.h>
 #include <helpers/helper_ptrmap.h>
 #include <helpers/logger.h>
@@ -2019,17 +2022,10 @@ void NativeOps::setGridLimit(int gridSize) {
 }
 
 void NativeOps::tadOnlyShapeInfo(int *xShapeInfo, int *dimension, int dimensionLength, int *target, Nd4jIndex *offsets) {
-    shape::TAD *tad = new shape::TAD();
-    tad->init(xShapeInfo, dimension, dimensionLength);
-    //tad->setOutputBuffer(target);
-    tad->createTadOnlyShapeInfo();
-    tad->createOffsets();
+    auto tadPack = nd4j::TadCache::getInstance()->tadForDimensions(xShapeInfo, dimension, dimensionLength);
 
-
-    std::memcpy((void *) target, tad->tadOnlyShapeInfo, (tad->tadOnlyShapeInfo[0] * 2 + 4) * sizeof(int));
-    std::memcpy((void *) offsets, tad->tadOffsets, tad->numTads * sizeof(Nd4jIndex));
-
-    delete tad;
+    std::memcpy((void *) target, tadPack->primaryShapeInfo(), shape::shapeInfoByteLength(tadPack->primaryShapeInfo()));
+    std::memcpy((void *) offsets, tadPack->primaryOffsets(), tadPack->numberOfTads() * sizeof(Nd4jIndex));
 }
 
 int NativeOps::memcpyConstantAsync(Nd4jIndex dst, Nd4jPointer src, Nd4jIndex size, int flags, Nd4jPointer reserved) {
@@ -2207,50 +2203,45 @@ void NativeOps::enableP2P(bool enable) {
 }
 
 void NativeOps::encodeThresholdP1Half(Nd4jPointer *extraPointers, float16 *dx, Nd4jIndex N, int *dz, float threshold) {
-    // TODO: to be implemented
+    cpuEncodeThresholdP1Generic<float16>(dx, N, dz, threshold);
 }
 
 void NativeOps::encodeThresholdP1Float(Nd4jPointer *extraPointers, float *dx, Nd4jIndex N, int *dz, float threshold) {
-    // TODO: to be implemented
+    cpuEncodeThresholdP1Generic<float>(dx, N, dz, threshold);
 }
 
 void NativeOps::encodeThresholdP1Double(Nd4jPointer *extraPointers, double *dx, Nd4jIndex N, int *dz, float threshold) {
-    // TODO: to be implemented
+    cpuEncodeThresholdP1Generic<double>(dx, N, dz, threshold);
 }
 
 
 void NativeOps::encodeThresholdP2Int(Nd4jPointer *extraPointers, int *dx, Nd4jIndex N, int *dz) {
-    // TODO: to be implemented
+    // dx is P1 output, so per-block counts start at dx[1]
+    cpuPrefixSum(dx + 1, N, dz);
 }
 
 void NativeOps::encodeThresholdP3Float(Nd4jPointer *extraPointers, float *dx, int *offsets, Nd4jIndex N, int *dz){
-    // offsets won't be used here
-
-    // TODO: to be implemented
+    cpuEncodeThresholdP3Generic<float>(dx, offsets, N, dz);
 }
 
 void NativeOps::encodeThresholdP3Double(Nd4jPointer *extraPointers, double *dx, int *offsets, Nd4jIndex N, int *dz){
-    // offsets won't be used here
-
-    // TODO: to be implemented
+    cpuEncodeThresholdP3Generic<double>(dx, offsets, N, dz);
 }
 
 void NativeOps::encodeThresholdP3Half(Nd4jPointer *extraPointers, float16 *dx, int *offsets, Nd4jIndex N, int *dz){
-    // offsets won't be used here
-
-    // TODO: to be implemented
+    cpuEncodeThresholdP3Generic<float16>(dx, offsets, N, dz);
 }
 
 void NativeOps::decodeThresholdFloat(Nd4jPointer *extraPointers, void *dx, Nd4jIndex N, float *dz){
-    // TODO: to be implemented
+    cpuDecodeThresholdGeneric<float>(dx, N, dz);
 }
 
 void NativeOps::decodeThresholdHalf(Nd4jPointer *extraPointers, void *dx, Nd4jIndex N, float16 *dz){
-    // TODO: to be implemented
+    cpuDecodeThresholdGeneric<float16>(dx, N, dz);
 }
 
 void NativeOps::decodeThresholdDouble(Nd4jPointer *extraPointers, void *dx, Nd4jIndex N, double *dz){
-    // TODO: to be implemented
+    cpuDecodeThresholdGeneric<double>(dx, N, dz);
 }
 
 bool NativeOps::isP2PAvailable() {
@@ -2276,12 +2267,8 @@ void shuffleGeneric(T **dX, int **xShapeInfo, T **dZ, int **zShapeInfo, int N, i
 
         const Nd4jIndex tadLength = shape::length(tadOnlyShapeInfo[f]);
         int tadEWS = shape::elementWiseStride(tadOnlyShapeInfo[f]);
-        int tadRank = shape::rank(tadOnlyShapeInfo[f]);
         int numTads = shape::length(xShapeInfo[f]) / tadLength;
 
-        int *tadShape = shape::shapeOf(tadOnlyShapeInfo[f]);
-        int *tadStride = shape::stride(tadOnlyShapeInfo[f]);
-
         //printf("Array: [%i], tadEWS: [%i], tadLength: [%i]\n", f, tadEWS, tadLength);
 
         // TODO: omp *probably* has no sense here, since 99% of uses for this method will be inside DataSet. but worth a check
@@ -2304,19 +2291,17 @@ void shuffleGeneric(T **dX, int **xShapeInfo, T **dZ, int **zShapeInfo, int N, i
                 }
 
             } else {
-                // ind2sub branch
-#pragma omp parallel for schedule(guided) if (N == 1 && tadLength > 512) default(shared)
-                for (Nd4jIndex i = 0; i < tadLength; i++) {
-                    int xCoord[MAX_RANK];
-                    int yCoord[MAX_RANK];
-
-                    shape::ind2subC(tadRank,tadShape, i, xCoord);
-                    shape::ind2subC(tadRank,tadShape, i, yCoord);
-
-                    Nd4jIndex xOffset = shape::getOffset(oldOffset, tadShape, tadStride, xCoord, tadRank);
-                    Nd4jIndex yOffset = shape::getOffset(newOffset, tadShape, tadStride, yCoord, tadRank);
-
-                    nd4j::math::nd4j_swap<T>(x[xOffset], x[yOffset]);
+                // strided branch: both TADs share the same shape, so single iterator serves both of them
+#pragma omp parallel if (N == 1 && tadLength > 512) default(shared)
+                {
+                    Nd4jIndex start, end;
+                    nd4j::StridedIterator::threadSpan(tadLength, omp_get_thread_num(), omp_get_num_threads(), start, end);
+
+                    nd4j::StridedIterator tadIter(tadOnlyShapeInfo[f], start);
+                    for (Nd4jIndex i = start; i < end; i++) {
+                        nd4j::math::nd4j_swap<T>(rX[tadIter.offset()], rY[tadIter.offset()]);
+                        tadIter.next();
+                    }
                 }
 
             }
@@ -2876,11 +2861,9 @@ void NativeOps::execRandomHalf(Nd4jPointer *extraPointers,
 
 Nd4jPointer NativeOps::initRandom(Nd4jPointer *extraPointers, long seed, long bufferSize, Nd4jPointer ptrToBuffer) {
     long *ptrBuf = reinterpret_cast<long *>(ptrToBuffer);
+    // values are generated from counters on demand, so there's nothing to pre-fill here
     nd4j::random::RandomBuffer *buffer = new nd4j::random::RandomBuffer(seed, bufferSize, (uint64_t *) ptrBuf);
 
-    nd4j::random::Xoroshiro128 generator(buffer);
-    generator.refreshBuffer();
-
     return (Nd4jPointer) buffer;
 }
 
@@ -2889,8 +2872,6 @@ void NativeOps::refreshBuffer(Nd4jPointer *extraPointers, long seed, Nd4jPointer
 
     buffer->setSeed(seed);
     buffer->setOffset(0);
-    nd4j::random::Xoroshiro128 generator(buffer);
-    generator.refreshBuffer();
 }
 
 void NativeOps::reSeedBuffer(Nd4jPointer *extraPointers, long seed, Nd4jPointer ptrRandom) {
@@ -3009,7 +2990,7 @@ void NativeOps::sortDouble(Nd4jPointer *extraPointers, double *x, int *xShapeInf
 }
 
 void NativeOps::sortHalf(Nd4jPointer *extraPointers, float16 *x, int *xShapeInfo, bool descending) {
-    //NativeOpExcutioner<float16>::execSort(x, xShapeInfo, descending);
+    NativeOpExcutioner<float16>::execSort(x, xShapeInfo, descending);
 }
 
 void NativeOps::sortTadFloat(Nd4jPointer *extraPointers, float *x, int *xShapeInfo, int *dimension, int dimensionLength, int *tadShapeInfo, Nd4jIndex *tadOffsets, bool descending) {
@@ -3021,7 +3002,7 @@ void NativeOps::sortTadDouble(Nd4jPointer *extraPointers, double *x, int *xShape
 }
 
 void NativeOps::sortTadHalf(Nd4jPointer *extraPointers, float16 *x, int *xShapeInfo, int *dimension, int dimensionLength, int *tadShapeInfo, Nd4jIndex *tadOffsets, bool descending) {
-    //NativeOpExcutioner<float16>::execSort(x, xShapeInfo, dimension, dimensionLength, tadShapeInfo, tadOffsets, descending);
+    NativeOpExcutioner<float16>::execSort(x, xShapeInfo, dimension, dimensionLength, tadShapeInfo, tadOffsets, descending);
 }
 
 void NativeOps::sortCooIndicesFloat(Nd4jPointer *extraPointers, int *indices, float *values, Nd4jIndex length, int rank) {
@@ -3033,7 +3014,7 @@ void NativeOps::sortCooIndicesDouble(Nd4jPointer *extraPointers, int *indices, d
 }
 
 void NativeOps::sortCooIndicesHalf(Nd4jPointer *extraPointers, int *indices, float16 *values, Nd4jIndex length, int rank) {
- //   NativeOpExcutioner<float>::execSortCooIndices(indices, values, length, rank);
+    NativeOpExcutioner<float16>::execSortCooIndices(indices, values, length, rank);
 }
 
 Nd4jIndex NativeOps::encodeBitmapFloat(Nd4jPointer *extraPointers, float *dx, Nd4jIndex N, int *dz, float threshold) {
@@ -3344,52 +3325,95 @@ int NativeOps::registerGraphHalf(Nd4jPointer *extraPointers, Nd4jIndex graphId,
 }
 
 template <typename T>
-static VariablesSet<T>* executeStoredGraphT(Nd4jPointer *extraPointers, Nd4jIndex graphId, Nd4jPointer *inputBuffers, Nd4jPointer *inputShapes, int* inputIndices, int numInputs) {
-    auto graph = nd4j::graph::GraphHolder::getInstance()->pullGraph<T>(graphId);
-    auto varSpace = graph->getVariableSpace()->clone();
-
-    std::vector<nd4j::NDArray<T> *> handles;
-
+static void feedStoredGraphInputs(nd4j::graph::VariableSpace<T> *varSpace, Nd4jPointer *inputBuffers, Nd4jPointer *inputShapes, int* inputIndices, int numInputs) {
     for (int e = 0; e < numInputs; e++) {
         auto idx = inputIndices[e];
 
-        // we'll delete this array later, together with cloned VariableSpace
+        // we'll delete this array later, together with VariableSpace
         auto array = new nd4j::NDArray<T>((T *) inputBuffers[e], (int *) inputShapes[e]);
-        handles.emplace_back(array);
 
         if (varSpace->hasVariable(idx)) {
             auto var = varSpace->getVariable(idx);
-            if (var->hasNDArray())
+
+            // shared graph arrays aren't owned by this VariableSpace
+            if (var->hasNDArray() && var->isRemovable())
                 delete var->getNDArray();
 
             var->setNDArray(array);
+            var->markRemovable(true);
         } else
             varSpace->putVariable(idx, array);
     }
+}
 
-    auto result = nd4j::graph::GraphExecutioner<T>::execute(graph, varSpace);
+template <typename T>
+static VariablesSet<T>* executeStoredGraphT(Nd4jPointer *extraPointers, Nd4jIndex graphId, Nd4jPointer *inputBuffers, Nd4jPointer *inputShapes, int* inputIndices, int numInputs) {
+    auto plan = nd4j::graph::GraphHolder::getInstance()->pullPlan<T>(graphId);
+    auto varSpace = plan->prepareSpace();
+
+    feedStoredGraphInputs<T>(varSpace, inputBuffers, inputShapes, inputIndices, numInputs);
+
+    auto result = plan->execute(varSpace);
     auto varSet = new nd4j::graph::VariablesSet<T>(result);
 
     if (result == ND4J_STATUS_OK) {
         // pull back results, and provide them
-        auto outputs = graph->fetchOutputs();
-        for (int e = 0; e < outputs->size(); e++) {
-            // we're only getting variable ID/Index from original grap. values will be taken from cloned workspace
-            std::pair<int, int> varId(outputs->at(e)->id(), outputs->at(e)->index());
+        for (auto id: *plan->graph()->output()) {
+            auto var = varSpace->getVariable(id);
 
-            auto var = varSpace->getVariable(varId);
+            // results are copied out of workspace, since it'll be reused by next run
+            if (var->hasNDArray()) {
+                auto array = new nd4j::NDArray<T>(var->getNDArray(), false, nullptr);
+                array->assign(var->getNDArray());
 
-            varSet->push_back(var->clone());
+                varSet->push_back(new nd4j::graph::Variable<T>(array, var->getName()->c_str(), var->id(), var->index()));
+            } else
+                varSet->push_back(var->clone());
         }
-
-        delete outputs;
     }
 
-    delete varSpace;
+    plan->releaseSpace(varSpace);
 
     return varSet;
 }
 
+template <typename T>
+static int executeStoredGraphT(Nd4jPointer *extraPointers, Nd4jIndex graphId, Nd4jPointer *inputBuffers, Nd4jPointer *inputShapes, int* inputIndices, int numInputs, Nd4jPointer *outputBuffers, Nd4jPointer *outputShapes, int numOutputs) {
+    auto plan = nd4j::graph::GraphHolder::getInstance()->pullPlan<T>(graphId);
+    auto outputs = plan->graph()->output();
+
+    if (numOutputs != (int) outputs->size()) {
+        nd4j_printf("Graph [%lld] has %i outputs, but %i were provided\n", graphId, (int) outputs->size(), numOutputs);
+        return ND4J_STATUS_BAD_OUTPUT;
+    }
+
+    auto varSpace = plan->prepareSpace();
+
+    feedStoredGraphInputs<T>(varSpace, inputBuffers, inputShapes, inputIndices, numInputs);
+
+    auto result = plan->execute(varSpace);
+
+    if (result == ND4J_STATUS_OK) {
+        // results are written straight into provided buffers
+        for (int e = 0; e < numOutputs; e++) {
+            auto var = varSpace->getVariable(outputs->at(e));
+            nd4j::NDArray<T> z((T *) outputBuffers[e], (int *) outputShapes[e]);
+
+            if (!var->hasNDArray() || !z.isSameShape(var->getNDArray())) {
+                nd4j_printf("Output [%i] of graph [%lld] doesn't match provided buffer\n", e, graphId);
+                result = ND4J_STATUS_BAD_OUTPUT;
+                break;
+            }
+
+            z.assign(var->getNDArray());
+        }
+    }
+
+    plan->releaseSpace(varSpace);
+
+    return result;
+}
+
 VariablesSet<float>* NativeOps::executeStoredGraphFloat(Nd4jPointer *extraPointers, Nd4jIndex graphId, Nd4jPointer *inputBuffers, Nd4jPointer *inputShapes, int* inputIndices, int numInputs) {
     return executeStoredGraphT<float>(extraPointers, graphId, inputBuffers, inputShapes, inputIndices, numInputs);
 }
@@ -3402,6 +3426,18 @@ VariablesSet<double>* NativeOps::executeStoredGraphDouble(Nd4jPointer *extraPoin
     return executeStoredGraphT<double>(extraPointers, graphId, inputBuffers, inputShapes, inputIndices, numInputs);
 }
 
+int NativeOps::executeStoredGraphFloat(Nd4jPointer *extraPointers, Nd4jIndex graphId, Nd4jPointer *inputBuffers, Nd4jPointer *inputShapes, int* inputIndices, int numInputs, Nd4jPointer *outputBuffers, Nd4jPointer *outputShapes, int numOutputs) {
+    return executeStoredGraphT<float>(extraPointers, graphId, inputBuffers, inputShapes, inputIndices, numInputs, outputBuffers, outputShapes, numOutputs);
+}
+
+int NativeOps::executeStoredGraphHalf(Nd4jPointer *extraPointers, Nd4jIndex graphId, Nd4jPointer *inputBuffers, Nd4jPointer *inputShapes, int* inputIndices, int numInputs, Nd4jPointer *outputBuffers, Nd4jPointer *outputShapes, int numOutputs) {
+    return executeStoredGraphT<float16>(extraPointers, graphId, inputBuffers, inputShapes, inputIndices, numInputs, outputBuffers, outputShapes, numOutputs);
+}
+
+int NativeOps::executeStoredGraphDouble(Nd4jPointer *extraPointers, Nd4jIndex graphId, Nd4jPointer *inputBuffers, Nd4jPointer *inputShapes, int* inputIndices, int numInputs, Nd4jPointer *outputBuffers, Nd4jPointer *outputShapes, int numOutputs) {
+    return executeStoredGraphT<double>(extraPointers, graphId, inputBuffers, inputShapes, inputIndices, numInputs, outputBuffers, outputShapes, numOutputs);
+}
+
 int NativeOps::unregisterGraph(Nd4jPointer *extraPointers, Nd4jIndex graphId) {
 
     nd4j::graph::GraphHolder::getInstance()->dropGraphAny(graphId);
@@ -6825,52 +6825,95 @@ int NativeOps::registerGraphHalf(Nd4jPointer *extraPointers, Nd4jIndex graphId,
 }
 
 template <typename T>
-static VariablesSet<T>* executeStoredGraphT(Nd4jPointer *extraPointers, Nd4jIndex graphId, Nd4jPointer *inputBuffers, Nd4jPointer *inputShapes, int* inputIndices, int numInputs) {
-	auto graph = nd4j::graph::GraphHolder::getInstance()->pullGraph<T>(graphId);
-	auto varSpace = graph->getVariableSpace()->clone();
-
-	std::vector<nd4j::NDArray<T> *> handles;
-
+static void feedStoredGraphInputs(nd4j::graph::VariableSpace<T> *varSpace, Nd4jPointer *inputBuffers, Nd4jPointer *inputShapes, int* inputIndices, int numInputs) {
 	for (int e = 0; e < numInputs; e++) {
 		auto idx = inputIndices[e];
 
-		// we'll delete this array later, together with cloned VariableSpace
+		// we'll delete this array later, together with VariableSpace
 		auto array = new nd4j::NDArray<T>((T *) inputBuffers[e], (int *) inputShapes[e]);
-		handles.emplace_back(array);
 
 		if (varSpace->hasVariable(idx)) {
 			auto var = varSpace->getVariable(idx);
-			if (var->hasNDArray())
+
+			// shared graph arrays aren't owned by this VariableSpace
+			if (var->hasNDArray() && var->isRemovable())
 				delete var->getNDArray();
 
 			var->setNDArray(array);
+			var->markRemovable(true);
 		} else
 			varSpace->putVariable(idx, array);
 	}
+}
+
+template <typename T>
+static VariablesSet<T>* executeStoredGraphT(Nd4jPointer *extraPointers, Nd4jIndex graphId, Nd4jPointer *inputBuffers, Nd4jPointer *inputShapes, int* inputIndices, int numInputs) {
+	auto plan = nd4j::graph::GraphHolder::getInstance()->pullPlan<T>(graphId);
+	auto varSpace = plan->prepareSpace();
+
+	feedStoredGraphInputs<T>(varSpace, inputBuffers, inputShapes, inputIndices, numInputs);
 
-	auto result = nd4j::graph::GraphExecutioner<T>::execute(graph, varSpace);
+	auto result = plan->execute(varSpace);
 	auto varSet = new nd4j::graph::VariablesSet<T>(result);
 
 	if (result == ND4J_STATUS_OK) {
 		// pull back results, and provide them
-		auto outputs = graph->fetchOutputs();
-		for (int e = 0; e < outputs->size(); e++) {
-			// we're only getting variable ID/Index from original grap. values will be taken from cloned workspace
-			std::pair<int, int> varId(outputs->at(e)->id(), outputs->at(e)->index());
+		for (auto id: *plan->graph()->output()) {
+			auto var = varSpace->getVariable(id);
 
-			auto var = varSpace->getVariable(varId);
+			// results are copied out of workspace, since it'll be reused by next run
+			if (var->hasNDArray()) {
+				auto array = new nd4j::NDArray<T>(var->getNDArray(), false, nullptr);
+				array->assign(var->getNDArray());
 
-			varSet->push_back(var->clone());
+				varSet->push_back(new nd4j::graph::Variable<T>(array, var->getName()->c_str(), var->id(), var->index()));
+			} else
+				varSet->push_back(var->clone());
 		}
-
-		delete outputs;
 	}
 
-	delete varSpace;
+	plan->releaseSpace(varSpace);
 
 	return varSet;
 }
 
+template <typename T>
+static int executeStoredGraphT(Nd4jPointer *extraPointers, Nd4jIndex graphId, Nd4jPointer *inputBuffers, Nd4jPointer *inputShapes, int* inputIndices, int numInputs, Nd4jPointer *outputBuffers, Nd4jPointer *outputShapes, int numOutputs) {
+	auto plan = nd4j::graph::GraphHolder::getInstance()->pullPlan<T>(graphId);
+	auto outputs = plan->graph()->output();
+
+	if (numOutputs != (int) outputs->size()) {
+		nd4j_printf("Graph [%lld] has %i outputs, but %i were provided\n", graphId, (int) outputs->size(), numOutputs);
+		return ND4J_STATUS_BAD_OUTPUT;
+	}
+
+	auto varSpace = plan->prepareSpace();
+
+	feedStoredGraphInputs<T>(varSpace, inputBuffers, inputShapes, inputIndices, numInputs);
+
+	auto result = plan->execute(varSpace);
+
+	if (result == ND4J_STATUS_OK) {
+		// results are written straight into provided buffers
+		for (int e = 0; e < numOutputs; e++) {
+			auto var = varSpace->getVariable(outputs->at(e));
+			nd4j::NDArray<T> z((T *) outputBuffers[e], (int *) outputShapes[e]);
+
+			if (!var->hasNDArray() || !z.isSameShape(var->getNDArray())) {
+				nd4j_printf("Output [%i] of graph [%lld] doesn't match provided buffer\n", e, graphId);
+				result = ND4J_STATUS_BAD_OUTPUT;
+				break;
+			}
+
+			z.assign(var->getNDArray());
+		}
+	}
+
+	plan->releaseSpace(varSpace);
+
+	return result;
+}
+
 VariablesSet<float>* NativeOps::executeStoredGraphFloat(Nd4jPointer *extraPointers, Nd4jIndex graphId, Nd4jPointer *inputBuffers, Nd4jPointer *inputShapes, int* inputIndices, int numInputs) {
 	return executeStoredGraphT<float>(extraPointers, graphId, inputBuffers, inputShapes, inputIndices, numInputs);
 }
@@ -6883,6 +6926,18 @@ VariablesSet<double>* NativeOps::executeStoredGraphDouble(Nd4jPointer *extraPoin
 	return executeStoredGraphT<double>(extraPointers, graphId, inputBuffers, inputShapes, inputIndices, numInputs);
 }
 
+int NativeOps::executeStoredGraphFloat(Nd4jPointer *extraPointers, Nd4jIndex graphId, Nd4jPointer *inputBuffers, Nd4jPointer *inputShapes, int* inputIndices, int numInputs, Nd4jPointer *outputBuffers, Nd4jPointer *outputShapes, int numOutputs) {
+	return executeStoredGraphT<float>(extraPointers, graphId, inputBuffers, inputShapes, inputIndices, numInputs, outputBuffers, outputShapes, numOutputs);
+}
+
+int NativeOps::executeStoredGraphHalf(Nd4jPointer *extraPointers, Nd4jIndex graphId, Nd4jPointer *inputBuffers, Nd4jPointer *inputShapes, int* inputIndices, int numInputs, Nd4jPointer *outputBuffers, Nd4jPointer *outputShapes, int numOutputs) {
+	return executeStoredGraphT<float16>(extraPointers, graphId, inputBuffers, inputShapes, inputIndices, numInputs, outputBuffers, outputShapes, numOutputs);
+}
+
+int NativeOps::executeStoredGraphDouble(Nd4jPointer *extraPointers, Nd4jIndex graphId, Nd4jPointer *inputBuffers, Nd4jPointer *inputShapes, int* inputIndices, int numInputs, Nd4jPointer *outputBuffers, Nd4jPointer *outputShapes, int numOutputs) {
+	return executeStoredGraphT<double>(extraPointers, graphId, inputBuffers, inputShapes, inputIndices, numInputs, outputBuffers, outputShapes, numOutputs);
+}
+
 int NativeOps::unregisterGraph(Nd4jPointer *extraPointers, Nd4jIndex graphId) {
 
 	nd4j::graph::GraphHolder::getInstance()->dropGraphAny(graphId);
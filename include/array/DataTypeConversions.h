@@ -15,36 +15,29 @@
 namespace nd4j {
     template <typename T>
     class DataTypeConversions {
+    private:
+        template <typename S>
+        static FORCEINLINE void convert(T* buffer, S* src, bool canKeep, Nd4jIndex length) {
+            // bytes are swapped in source type, before conversion
+#pragma omp parallel for simd schedule(guided) if (length > ELEMENT_THRESHOLD)
+            for (Nd4jIndex e = 0; e < length; e++)
+                buffer[e] = canKeep ? (T) src[e] : (T) BitwiseUtils::swap_bytes<S>(src[e]);
+        }
+
     public:
         static FORCEINLINE void convertType(T* buffer, void* src, DataType dataType, ByteOrder order, Nd4jIndex length) {
             bool isBe = BitwiseUtils::isBE();
             bool canKeep = (isBe && order == ByteOrder::BE) || (!isBe && order == ByteOrder::LE);
 
             switch (dataType) {
-                case DataType_FLOAT: {
-                        auto tmp = (float *) src;
-
-                        //#pragma omp parallel for simd schedule(guided)
-                        for (Nd4jIndex e = 0; e < length; e++) {
-                            buffer[e] = canKeep ? (T) tmp[e] : BitwiseUtils::swap_bytes<T>((T) tmp[e]);
-                        }
-                    }
+                case DataType_FLOAT:
+                    convert<float>(buffer, (float *) src, canKeep, length);
                     break;
-                case DataType_DOUBLE: {
-                        auto tmp = (double *) src;
-
-                        //#pragma omp parallel for simd schedule(guided)
-                        for (Nd4jIndex e = 0; e < length; e++)
-                            buffer[e] = canKeep ? (T) tmp[e] : BitwiseUtils::swap_bytes<T>((T) tmp[e]);
-                    }
+                case DataType_DOUBLE:
+                    convert<double>(buffer, (double *) src, canKeep, length);
                     break;
-                case DataType_HALF: {
-                        auto tmp = (float16 *) src;
-
-                        //#pragma omp parallel for simd schedule(guided)
-                        for (Nd4jIndex e = 0; e < length; e++)
-                            buffer[e] = canKeep ? (T) tmp[e] : BitwiseUtils::swap_bytes<T>((T) tmp[e]);
-                    }
+                case DataType_HALF:
+                    convert<float16>(buffer, (float16 *) src, canKeep, length);
                     break;
                 default: {
                     nd4j_printf("Unsupported DataType requested: [%i]\n", (int) dataType);
@@ -0,0 +1,122 @@
+//
+//  @author raver119@gmail.com
+//
+
+#ifndef LIBND4J_EXECUTIONPLAN_H
+#define LIBND4J_EXECUTIONPLAN_H
+
+#include <pointercast.h>
+#include <dll.h>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <memory>
+#include <graph/Graph.h>
+#include <graph/Node.h>
+#include <graph/VariableSpace.h>
+#include <graph/MemoryPlan.h>
+#include <memory/Workspace.h>
+#include <ops/declarable/DeclarableOp.h>
+
+namespace nd4j {
+    namespace graph {
+        /**
+         * This class holds Graph prepared for repeated execution.
+         *
+         * Graph is built once, and for pure dataflow graphs nodes are stored in execution order along with their ops,
+         * so each run just walks over this array. Every run gets its own lightweight VariableSpace: external variables
+         * refer to Graph arrays instead of being duplicated, and node outputs are allocated from Workspace reused across runs.
+         * Once outputs shapes are known for given input shapes, node outputs are placed according to MemoryPlan.
+         *
+         * batchnorm nodes with constant params, along with following bias_add, are folded into weights and bias of preceding
+         * conv2d or matmul. Folded weights are kept by plan, Graph itself isn't modified.
+         *
+         * Graphs with logic ops, scopes or embedded graphs are executed with GraphExecutioner on deep copy of VariableSpace, as before.
+         *
+         * PLEASE NOTE: ExecutionPlan doesn't own Graph
+         */
+        template <typename T>
+        class ND4J_EXPORT ExecutionPlan {
+        protected:
+            Graph<T>* _graph;
+
+            // TRUE if graph is pure dataflow, so nodes are executed in fixed order
+            bool _compiled = false;
+
+            std::vector<Node<T>*> _nodes;
+            std::vector<nd4j::ops::DeclarableOp<T>*> _ops;
+
+            // in-place flags as plan executes nodes: Graph nodes keep their own
+            std::vector<bool> _inplace;
+
+            // graph variables that aren't produced by nodes: every run refers to them instead of making copies
+            std::vector<Variable<T>*> _shared;
+
+            // workspaces released by finished runs, so next runs don't have to allocate memory again
+            std::mutex _mutex;
+            std::vector<nd4j::memory::Workspace*> _workspaces;
+
+            // built after first run with given input shapes, guarded by the same mutex
+            std::shared_ptr<MemoryPlan<T>> _memoryPlan;
+
+            // arrays for planned outputs of runs within given workspace, along with memory plan they were created for
+            std::map<nd4j::memory::Workspace*, std::pair<std::shared_ptr<MemoryPlan<T>>, std::unique_ptr<PlannedOutputs<T>>>> _outputs;
+
+            // nodes with folded batchnorm, their ops and constants. all of them are owned by plan
+            std::vector<Node<T>*> _foldedNodes;
+            std::vector<nd4j::ops::DeclarableOp<T>*> _foldedOps;
+            std::vector<Variable<T>*> _constants;
+
+            // ids of folded nodes, which output is output of node at the same position
+            std::vector<std::vector<int>> _aliases;
+            int _numFolded = 0;
+
+            void compile();
+
+            void foldBatchNorm();
+
+        public:
+            explicit ExecutionPlan(Graph<T>* graph);
+            ~ExecutionPlan();
+
+            Graph<T>* graph();
+
+            /**
+             * This method returns TRUE if graph was compiled into fixed order of nodes
+             */
+            bool isCompiled();
+
+            /**
+             * This method returns number of nodes in execution order
+             */
+            int numberOfNodes();
+
+            /**
+             * This method returns number of batchnorm nodes folded into preceding nodes
+             */
+            int numberOfFolded();
+
+            /**
+             * This method returns MemoryPlan built for last seen input shapes, or nullptr if there's none yet
+             */
+            std::shared_ptr<MemoryPlan<T>> memoryPlan();
+
+            /**
+             * This method returns new VariableSpace for one run of this plan. It must be passed to releaseSpace() once run results are consumed
+             */
+            VariableSpace<T>* prepareSpace();
+
+            /**
+             * This method releases VariableSpace created with prepareSpace(), and keeps its Workspace for next runs
+             */
+            void releaseSpace(VariableSpace<T>* space);
+
+            /**
+             * This method executes plan within given VariableSpace
+             */
+            Nd4jStatus execute(VariableSpace<T>* space);
+        };
+    }
+}
+
+#endif //LIBND4J_EXECUTIONPLAN_H
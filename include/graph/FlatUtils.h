@@ -19,8 +19,15 @@ namespace nd4j {
 
             static std::pair<Nd4jIndex, Nd4jIndex > fromLongPair(LongPair* pair);
 
+            /**
+             * This method creates NDArray out of FlatArray.
+             *
+             * @param allowView if TRUE, and FlatArray buffer holds T values, resulting NDArray will use FlatArray buffer
+             *                  without copying it. Foreign byte order is swapped in place, so FlatBuffer must be writable,
+             *                  and it must outlive such NDArray.
+             */
             template <typename T>
-            static NDArray<T>* fromFlatArray(const nd4j::graph::FlatArray* flatArray);
+            static NDArray<T>* fromFlatArray(const nd4j::graph::FlatArray* flatArray, bool allowView = false);
         };
     }
 }
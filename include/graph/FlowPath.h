@@ -6,6 +6,7 @@
 #define LIBND4J_FLOWPATH_H
 
 #include <map>
+#include <mutex>
 #include <pointercast.h>
 #include <graph/NodeState.h>
 #include <graph/FrameState.h>
@@ -23,6 +24,9 @@ namespace nd4j {
             void ensureFrame(int nodeId);
 
             GraphProfile _profile;
+
+            // node states might be updated concurrently by parallel executioner
+            std::mutex _mutex;
         public:
             FlowPath() = default;
             ~FlowPath() = default;
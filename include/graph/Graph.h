@@ -18,6 +18,7 @@
 #include <graph/generated/graph_generated.h>
 #include <graph/generated/config_generated.h>
 #include <graph/ExecutorConfiguration.h>
+#include <graph/MappedFile.h>
 
 namespace nd4j {
     namespace graph {
@@ -50,6 +51,25 @@ namespace nd4j {
             std::map<int, Scope<T> *> _mappedScopes;
             std::vector<Scope<T> *> _scopes;
 
+            // dependency info for parallel execution: nodes in onion order, number of internal inputs for each node, and consumers of each node
+            std::mutex _mutexDependencies;
+            bool _dependenciesBuilt = false;
+            bool _dataflow = false;
+            bool _parallelizable = false;
+            int _maxWidth = 1;
+            std::vector<Node<T> *> _executionOrder;
+            std::vector<int> _inDegrees;
+            std::vector<std::vector<int>> _dependents;
+
+            // file this graph was loaded from. variables may refer to its memory directly, so it's released after them
+            MappedFile* _file = nullptr;
+            Nd4jIndex _importTime = 0L;
+            Nd4jIndex _bytesMapped = 0L;
+            Nd4jIndex _bytesConverted = 0L;
+
+            // structural hash, computed once graph is built. 0 means it wasn't computed yet
+            std::atomic<Nd4jIndex> _hashCode{0L};
+
 ////////////////////////////////////////
             Nd4jStatus validateNode(nd4j::graph::Node<T> *node);
 
@@ -62,8 +82,14 @@ namespace nd4j {
             void printOutNode(Node<T>* node);
 
             void prepareOutputs();
+
+            void buildDependencies();
         public:
-            Graph(const FlatGraph *flatGraph = nullptr, VariableSpace<T> *variableSpace = nullptr);
+            /**
+             * @param file if set, graph takes ownership of the file flatGraph lives in,
+             *             and variables that need no conversion refer to file memory instead of being copied
+             */
+            Graph(const FlatGraph *flatGraph = nullptr, VariableSpace<T> *variableSpace = nullptr, MappedFile *file = nullptr);
 
             ~Graph();
 
@@ -183,17 +209,59 @@ namespace nd4j {
             bool hasNode(int nodeId);
 
             /**
-             * This method returns hash of given Graph instance
+             * This method returns structural hash of given Graph instance: data type, nodes, their ops, inputs and names.
+             * Hash doesn't depend on variables, so it's computed once, when graph is built, and doesn't change between runs
              */
             Nd4jIndex hashCode();
 
+            /**
+             * This method returns hash of given Graph instance specialized for shapes of external variables in given VariableSpace.
+             * Every dimension is rounded up to power of 2, so close shapes (i.e. batches of 33 and 60) share the same key.
+             * It's used to track memory footprint for each bucket of input shapes separately
+             */
+            Nd4jIndex footprintKey(VariableSpace<T> *variableSpace);
+
             /**
              * PLEASE NOTE: This method will be moved to private section
              */
             void tagInplaceNodes();
 
+            /**
+             * These methods return dependency info built along with the graph:
+             * all nodes in onion order, number of internal inputs for each node,
+             * and positions (within execution order) of nodes consuming each node
+             */
+            std::vector<Node<T> *>* executionOrder();
+            std::vector<int>* inDegrees();
+            std::vector<std::vector<int>>* dependents();
+
+            /**
+             * This method returns max number of nodes that can be executed simultaneously
+             */
+            int maxWidth();
+
+            /**
+             * This method returns TRUE if this graph is pure dataflow graph (no logic ops, scopes or divergence points),
+             * and has independent nodes, so it can be executed by dependencies with multiple nodes in flight
+             */
+            bool isParallelizable();
+
+            /**
+             * This method returns TRUE if this graph is pure dataflow graph, so all nodes can be executed in fixed order, one after another
+             */
+            bool isDataflow();
+
             void replaceState(VariableSpace<T> *state, ExecutorConfiguration *configuration);
 
+            /**
+             * These methods hold import stats: time spent on loading file and creating this graph, in nanoseconds,
+             * and sizes of variables used directly from file memory and converted into heap buffers, in bytes
+             */
+            void setImportTime(Nd4jIndex nanos);
+            Nd4jIndex importTime();
+            Nd4jIndex bytesMapped();
+            Nd4jIndex bytesConverted();
+
             FORCEINLINE std::vector<int>* nodes() {
                 return _nodes;
             }
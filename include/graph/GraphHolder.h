@@ -6,6 +6,7 @@
 #include <pointercast.h>
 #include <map>
 #include <graph/Graph.h>
+#include <graph/ExecutionPlan.h>
 
 namespace nd4j {
     namespace graph {
@@ -16,6 +17,11 @@ namespace nd4j {
             std::map<Nd4jIndex, Graph<double>*> _graphD;
             std::map<Nd4jIndex, Graph<float16>*> _graphH;
 
+            // execution plans are built once graph is registered, and live as long as graph is registered
+            std::map<Nd4jIndex, ExecutionPlan<float>*> _planF;
+            std::map<Nd4jIndex, ExecutionPlan<double>*> _planD;
+            std::map<Nd4jIndex, ExecutionPlan<float16>*> _planH;
+
             GraphHolder() = default;
             ~GraphHolder() = default;
         public:
@@ -30,6 +36,12 @@ namespace nd4j {
             template <typename T>
             Graph<T>* pullGraph(Nd4jIndex graphId);
 
+            /**
+             * This method returns ExecutionPlan built for graph registered with given id
+             */
+            template <typename T>
+            ExecutionPlan<T>* pullPlan(Nd4jIndex graphId);
+
             template <typename T>
             void forgetGraph(Nd4jIndex graphId);
 
@@ -43,4 +55,4 @@ namespace nd4j {
             bool hasGraph(Nd4jIndex graphId);
         };
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,53 @@
+//
+//  @author raver119@gmail.com
+//
+
+#ifndef LIBND4J_MAPPEDFILE_H
+#define LIBND4J_MAPPEDFILE_H
+
+#include <pointercast.h>
+#include <dll.h>
+#include <stdint.h>
+
+namespace nd4j {
+    namespace graph {
+        /**
+         * This class holds file contents in memory: file is mapped with mmap where available, and read in one go otherwise.
+         *
+         * Mapping is private, so pages are shared with page cache until something writes to them,
+         * and writes never go back to the file.
+         */
+        class ND4J_EXPORT MappedFile {
+        private:
+            uint8_t* _data = nullptr;
+            Nd4jIndex _length = 0L;
+            bool _mapped = false;
+
+        public:
+            explicit MappedFile(const char *filename);
+            ~MappedFile();
+
+            /**
+             * This method returns pointer to the beginning of file contents
+             */
+            uint8_t* data();
+
+            /**
+             * This method returns file length, in bytes
+             */
+            Nd4jIndex length();
+
+            /**
+             * This method returns TRUE if file is memory mapped, and FALSE if it was read into heap buffer
+             */
+            bool isMapped();
+
+            /**
+             * This method returns TRUE if given pointer points within file contents
+             */
+            bool contains(void *ptr);
+        };
+    }
+}
+
+#endif //LIBND4J_MAPPEDFILE_H
@@ -0,0 +1,112 @@
+//
+//  @author raver119@gmail.com
+//
+
+#ifndef LIBND4J_MEMORYPLAN_H
+#define LIBND4J_MEMORYPLAN_H
+
+#include <pointercast.h>
+#include <dll.h>
+#include <vector>
+#include <graph/Node.h>
+#include <graph/VariableSpace.h>
+
+namespace nd4j {
+    namespace graph {
+        template <typename T>
+        class MemoryPlan;
+
+        /**
+         * This class holds arrays for planned outputs, so consecutive runs within the same Workspace reuse them instead of
+         * allocating new ones. Arrays keep their own copies of shape info, since ops may reshape outputs in place
+         */
+        template <typename T>
+        class ND4J_EXPORT PlannedOutputs {
+        protected:
+            std::vector<std::vector<int>> _shapes;
+            std::vector<NDArray<T>*> _arrays;
+
+            explicit PlannedOutputs(int numberOfArrays);
+
+            friend class MemoryPlan<T>;
+        public:
+            ~PlannedOutputs();
+        };
+
+        /**
+         * This class holds static memory plan for node outputs of compiled graph.
+         *
+         * Plan is built from shapes observed during one run, for given shapes of external variables. Each output gets
+         * live range within execution order: from node that produces it, till last node that consumes it. Outputs are
+         * packed into single arena with best-fit offset assignment, so outputs that are dead by then share memory.
+         *
+         * PLEASE NOTE: plan is valid only for the same shapes of external variables, see matches()
+         */
+        template <typename T>
+        class ND4J_EXPORT MemoryPlan {
+        protected:
+            // shapes of external variables this plan was built for
+            std::vector<int> _signature;
+
+            // planned outputs: variable they go to, their shapes and offsets within arena, all in elements of T
+            std::vector<std::pair<int, int>> _keys;
+            std::vector<std::vector<int>> _shapes;
+            std::vector<Nd4jIndex> _offsets;
+
+            // indices of planned outputs, grouped by position of producing node within execution order
+            std::vector<std::vector<int>> _byPosition;
+
+            Nd4jIndex _arenaLength = 0L;
+            Nd4jIndex _naiveLength = 0L;
+
+            MemoryPlan() = default;
+        public:
+            ~MemoryPlan() = default;
+
+            /**
+             * This method returns shapes of all arrays available in given VariableSpace, as single vector
+             */
+            static std::vector<int> signature(VariableSpace<T> *space);
+
+            /**
+             * This method builds plan out of VariableSpace filled by finished run of given nodes
+             *
+             * @param nodes execution order
+             * @param space VariableSpace after execution
+             * @param outputs ids of graph outputs, they're kept alive till the end of run
+             * @param signature shapes of external variables, as they were before execution
+             */
+            static MemoryPlan<T>* build(std::vector<Node<T>*> &nodes, VariableSpace<T> *space, std::vector<int> *outputs, std::vector<int> &signature);
+
+            /**
+             * This method returns TRUE if plan was built for given shapes of external variables
+             */
+            bool matches(std::vector<int> &signature);
+
+            /**
+             * This method returns arena size in bytes
+             */
+            Nd4jIndex plannedBytes();
+
+            /**
+             * This method returns size in bytes all planned outputs would take without memory reuse
+             */
+            Nd4jIndex naiveBytes();
+
+            int numberOfArrays();
+
+            /**
+             * This method creates arrays for planned outputs. They're owned by caller and must be used by one run at a time
+             */
+            PlannedOutputs<T>* createOutputs();
+
+            /**
+             * This method puts arrays for outputs of node at given position into VariableSpace. Arrays are pointed at arena memory,
+             * and get shapes of this plan back
+             */
+            void placeOutputs(int position, VariableSpace<T> *space, T *arena, PlannedOutputs<T> *outputs);
+        };
+    }
+}
+
+#endif //LIBND4J_MEMORYPLAN_H
@@ -41,11 +41,20 @@ namespace nd4j {
             Variable(bool placeHolder);
             Variable(nd4j::NDArray<T> *arrayw, const char *name, int id, int idx = 0);
             Variable(nd4j::NDArray<T> *array = nullptr, const char *name = nullptr);
-            Variable(const nd4j::graph::FlatVariable *flatVariable);
+            /**
+             * @param allowView if TRUE, array may refer to FlatBuffer memory directly, see FlatUtils::fromFlatArray
+             */
+            Variable(const nd4j::graph::FlatVariable *flatVariable, bool allowView = false);
             ~Variable();
 
             Variable<T>* clone();
 
+            /**
+             * This method returns copy of this Variable, which refers to the same NDArray instead of duplicating it.
+             * Referenced NDArray isn't released together with copy
+             */
+            Variable<T>* reference();
+
             template <typename N>
             Variable<N>* asT();
 
@@ -28,6 +28,9 @@ namespace nd4j {
         protected:
 
             nd4j::memory::Workspace _workspace;
+
+            // if set, it's used instead of own workspace. VariableSpace doesn't own it
+            nd4j::memory::Workspace* _attachedWorkspace = nullptr;
             nd4j::random::RandomBuffer* _rng = nullptr;
 
             // stash is NOT cloned
@@ -47,7 +50,8 @@ namespace nd4j {
 
             int _auto_counter = -1;
 
-            std::mutex _varmap;
+            // recursive, since putVariable() overloads call each other under lock
+            std::recursive_mutex _varmap;
 
             std::map<int, nd4j::graph::Variable<T> *> _temporary;
 
@@ -126,6 +126,16 @@ namespace nd4j {
         template <typename N>
         ContextPrototype<N>* ContextPrototype<T>::asT() {
             auto clone = new ContextPrototype<N>(_nodeId, _isInplace);
+            clone->setOpNum(_opNum);
+
+            for (auto v: _inputs)
+                clone->inputs()->emplace_back(v);
+
+            for (auto v: _tArgs)
+                clone->getTArguments()->emplace_back((N) v);
+
+            for (auto v: _iArgs)
+                clone->getIArguments()->emplace_back(v);
 
             return clone;
         }
@@ -0,0 +1,476 @@
+//
+//  @author raver119@gmail.com
+//
+
+#include <graph/ExecutionPlan.h>
+#include <graph/Context.h>
+#include <graph/FlowPath.h>
+#include <helpers/logger.h>
+#include <Environment.h>
+#include <memory/MemoryRegistrator.h>
+#include <GraphExecutioner.h>
+#include <ops/declarable/CustomOperations.h>
+#include <ops/declarable/helpers/batchnorm.h>
+#include <map>
+#include <set>
+
+namespace nd4j {
+    namespace graph {
+        template <typename T>
+        ExecutionPlan<T>::ExecutionPlan(Graph<T> *graph) {
+            _graph = graph;
+
+            compile();
+        }
+
+        template <typename T>
+        ExecutionPlan<T>::~ExecutionPlan() {
+            for (auto w: _workspaces)
+                delete w;
+
+            for (auto n: _foldedNodes)
+                delete n;
+
+            for (auto o: _foldedOps)
+                delete o;
+
+            for (auto v: _constants)
+                delete v;
+        }
+
+        template <typename T>
+        void ExecutionPlan<T>::compile() {
+            _graph->buildGraph();
+
+            if (!_graph->isDataflow())
+                return;
+
+            std::set<Variable<T>*> unique;
+            for (auto var: *_graph->getVariableSpace()->handles()) {
+                if (_graph->hasNode(var->id()) || unique.count(var) > 0)
+                    continue;
+
+                unique.insert(var);
+                _shared.emplace_back(var);
+            }
+
+            for (auto node: *_graph->executionOrder()) {
+                // such nodes write to external variables, which are shared between runs
+                if (node->hasExternalOutputs()) {
+                    _nodes.clear();
+                    _ops.clear();
+                    _inplace.clear();
+                    _shared.clear();
+                    return;
+                }
+
+                // same applies to in-place ops consuming external variables: they'll get separate output instead
+                bool inplace = node->isInplace();
+                for (auto &p: *node->input())
+                    if (p.first < 0 || !_graph->hasNode(p.first))
+                        inplace = false;
+
+                _nodes.emplace_back(node);
+                _ops.emplace_back(node->hasCustomOp() ? node->getCustomOp() : nullptr);
+                _inplace.emplace_back(inplace);
+            }
+
+            _aliases.resize(_nodes.size());
+
+            foldBatchNorm();
+
+            _compiled = true;
+
+            nd4j_debug("Graph compiled into %i nodes\n", (int) _nodes.size());
+        }
+
+        template <typename T>
+        void ExecutionPlan<T>::foldBatchNorm() {
+            auto variableSpace = _graph->getVariableSpace();
+
+            // consumers of each node output, graph outputs are fetched after run so they can't be folded away
+            std::map<std::pair<int, int>, std::vector<int>> consumers;
+            for (int e = 0; e < (int) _nodes.size(); e++)
+                for (auto &p: *_nodes[e]->input())
+                    consumers[p].emplace_back(e);
+
+            std::set<int> outputs(_graph->output()->begin(), _graph->output()->end());
+
+            // array behind given input, if it's constant: not produced by node and not fed at run time
+            auto constant = [&] (std::pair<int, int> &p) -> NDArray<T>* {
+                if (_graph->hasNode(p.first) || !variableSpace->hasVariable(p))
+                    return nullptr;
+
+                auto var = variableSpace->getVariable(p);
+                if (var->isPlaceholder() || !var->hasNDArray())
+                    return nullptr;
+
+                return var->getNDArray();
+            };
+
+            // the only node consuming output of node at given position, and nothing else does
+            auto follower = [&] (int position, const char *opName) -> int {
+                std::pair<int, int> out(_nodes[position]->id(), 0);
+                if (outputs.count(out.first) > 0 || consumers[out].size() != 1)
+                    return -1;
+
+                std::pair<int, int> second(out.first, 1);
+                if (consumers.count(second) > 0)
+                    return -1;
+
+                int c = consumers[out].at(0);
+                if (_ops[c] == nullptr || *_ops[c]->getOpName() != opName || _nodes[c]->input()->at(0) != out)
+                    return -1;
+
+                return c;
+            };
+
+            int nextId = -1;
+            for (auto var: *variableSpace->handles())
+                nextId = nd4j::math::nd4j_min<int>(nextId, var->id() - 1);
+
+            std::vector<bool> removed(_nodes.size(), false);
+
+            for (int e = 0; e < (int) _nodes.size(); e++) {
+                if (_ops[e] == nullptr || removed[e])
+                    continue;
+
+                auto node = _nodes[e];
+                auto name = *_ops[e]->getOpName();
+                auto iArgs = node->getContextPrototype()->getIArguments();
+                auto tArgs = node->getContextPrototype()->getTArguments();
+
+                bool isConv = name == "conv2d";
+                bool isMatmul = name == "matmul";
+                if (!isConv && !isMatmul)
+                    continue;
+
+                int bn = follower(e, "batchnorm");
+                if (bn < 0)
+                    continue;
+
+                auto bnInputs = _nodes[bn]->input();
+                auto bnIArgs = _nodes[bn]->getContextPrototype()->getIArguments();
+                auto bnTArgs = _nodes[bn]->getContextPrototype()->getTArguments();
+                if (bnInputs->size() != 5 || bnIArgs->size() < 2 || bnTArgs->empty())
+                    continue;
+
+                NDArray<T> *mean = constant(bnInputs->at(1));
+                NDArray<T> *variance = constant(bnInputs->at(2));
+                NDArray<T> *gamma = constant(bnInputs->at(3));
+                NDArray<T> *beta = constant(bnInputs->at(4));
+                if (mean == nullptr || variance == nullptr || gamma == nullptr || beta == nullptr)
+                    continue;
+
+                auto inputs = node->input();
+                if (inputs->size() < 2)
+                    continue;
+
+                NDArray<T> *weights = constant(inputs->at(1));
+                NDArray<T> *bias = inputs->size() > 2 ? constant(inputs->at(2)) : nullptr;
+                if (weights == nullptr || (inputs->size() > 2 && bias == nullptr))
+                    continue;
+
+                // output rank, channels axis and number of channels
+                int rank, axis, channels;
+                bool isNCHW = true, transB = false;
+                T alpha = (T) 1.0f;
+                if (isConv) {
+                    if (weights->rankOf() != 4 || iArgs->size() < 9)
+                        continue;
+
+                    isNCHW = iArgs->size() > 9 ? !iArgs->at(9) : true;
+                    rank = 4;
+                    axis = isNCHW ? 1 : 3;
+                    channels = isNCHW ? weights->sizeAt(0) : weights->sizeAt(3);
+                } else {
+                    int transA = iArgs->size() > 0 ? iArgs->at(0) : 0;
+                    int tB = iArgs->size() > 1 ? iArgs->at(1) : 0;
+                    if (weights->rankOf() != 2 || (transA != 0 && transA != 111) || (tB != 0 && tB != 1 && tB != 111 && tB != 112))
+                        continue;
+
+                    // beta applies to previous content of output, so such matmul is left as is
+                    if (tArgs->size() > 1 && tArgs->at(1) != (T) 0.0f)
+                        continue;
+
+                    if (tArgs->size() > 0)
+                        alpha = tArgs->at(0);
+
+                    transB = tB == 1 || tB == 112;
+                    rank = 2;
+                    axis = 1;
+                    channels = transB ? weights->sizeAt(0) : weights->sizeAt(1);
+                }
+
+                if (bias != nullptr && bias->lengthOf() != channels)
+                    continue;
+
+                const bool applyScale = (bool) bnIArgs->at(0);
+                const bool applyOffset = (bool) bnIArgs->at(1);
+                if (!helpers::isPerChannel<T>(*mean, rank, axis, channels) || !helpers::isPerChannel<T>(*variance, rank, axis, channels) ||
+                    (applyScale && !helpers::isPerChannel<T>(*gamma, rank, axis, channels)) || (applyOffset && !helpers::isPerChannel<T>(*beta, rank, axis, channels)))
+                    continue;
+
+                // bias_add goes along last dimension
+                int ba = axis == rank - 1 ? follower(bn, "biasadd") : -1;
+                NDArray<T> *extraBias = ba >= 0 ? constant(_nodes[ba]->input()->at(1)) : nullptr;
+                if (extraBias == nullptr || extraBias->lengthOf() != channels)
+                    ba = -1;
+
+                std::vector<T> scale, shift;
+                helpers::batchnormCoefficients<T>(*mean, *variance, applyScale ? gamma : nullptr, applyOffset ? beta : nullptr, bnTArgs->at(0), channels, scale, shift);
+
+                // W * scale, per output channel
+                NDArray<T> *foldedWeights;
+                if (isConv) {
+                    foldedWeights = weights->dup('c');
+                    Nd4jIndex perChannel = foldedWeights->lengthOf() / channels;
+                    for (Nd4jIndex i = 0; i < foldedWeights->lengthOf(); i++) {
+                        int c = isNCHW ? (int) (i / perChannel) : (int) (i % channels);
+                        foldedWeights->putIndexedScalar(i, foldedWeights->getIndexedScalar(i) * scale[c]);
+                    }
+                } else {
+                    int k = transB ? weights->sizeAt(1) : weights->sizeAt(0);
+                    foldedWeights = new NDArray<T>('c', {k, channels});
+                    for (int r = 0; r < k; r++)
+                        for (int c = 0; c < channels; c++)
+                            (*foldedWeights)(r, c) = (transB ? (*weights)(c, r) : (*weights)(r, c)) * alpha * scale[c];
+                }
+
+                // b * scale + shift [+ bias_add]
+                auto foldedBias = new NDArray<T>('c', {channels});
+                for (int c = 0; c < channels; c++) {
+                    T value = shift[c];
+                    if (bias != nullptr)
+                        value += bias->getIndexedScalar(c) * scale[c];
+
+                    if (ba >= 0)
+                        value += extraBias->getIndexedScalar(c);
+
+                    foldedBias->putIndexedScalar(c, value);
+                }
+
+                auto weightsVar = new Variable<T>(foldedWeights, nullptr, nextId--, 0);
+                auto biasVar = new Variable<T>(foldedBias, nullptr, nextId--, 0);
+                _constants.emplace_back(weightsVar);
+                _constants.emplace_back(biasVar);
+                _shared.emplace_back(weightsVar);
+                _shared.emplace_back(biasVar);
+
+                // plan gets its own copy of node, which reads folded arrays
+                auto clone = node->clone();
+                std::vector<std::pair<int, int>> foldedInputs = {inputs->at(0), std::pair<int, int>(weightsVar->id(), 0), std::pair<int, int>(biasVar->id(), 0)};
+                clone->input()->assign(foldedInputs.begin(), foldedInputs.end());
+                clone->getContextPrototype()->inputs()->assign(foldedInputs.begin(), foldedInputs.end());
+
+                if (isMatmul) {
+                    auto op = new nd4j::ops::xw_plus_b<T>();
+                    clone->setCustomOp(op);
+                    _foldedOps.emplace_back(op);
+                    _ops[e] = op;
+                }
+
+                _foldedNodes.emplace_back(clone);
+                _nodes[e] = clone;
+
+                removed[bn] = true;
+                _aliases[e].emplace_back(_nodes[bn]->id());
+                if (ba >= 0) {
+                    removed[ba] = true;
+                    _aliases[e].emplace_back(_nodes[ba]->id());
+                }
+
+                _numFolded++;
+            }
+
+            if (_numFolded == 0)
+                return;
+
+            int position = 0;
+            for (int e = 0; e < (int) _nodes.size(); e++) {
+                if (removed[e])
+                    continue;
+
+                _nodes[position] = _nodes[e];
+                _ops[position] = _ops[e];
+                _inplace[position] = _inplace[e];
+                _aliases[position] = _aliases[e];
+                position++;
+            }
+
+            _nodes.resize(position);
+            _ops.resize(position);
+            _inplace.resize(position);
+            _aliases.resize(position);
+
+            nd4j_debug("Folded %i batchnorm nodes\n", _numFolded);
+        }
+
+        template <typename T>
+        Graph<T>* ExecutionPlan<T>::graph() {
+            return _graph;
+        }
+
+        template <typename T>
+        bool ExecutionPlan<T>::isCompiled() {
+            return _compiled;
+        }
+
+        template <typename T>
+        int ExecutionPlan<T>::numberOfNodes() {
+            return (int) _nodes.size();
+        }
+
+        template <typename T>
+        int ExecutionPlan<T>::numberOfFolded() {
+            return _numFolded;
+        }
+
+        template <typename T>
+        std::shared_ptr<MemoryPlan<T>> ExecutionPlan<T>::memoryPlan() {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _memoryPlan;
+        }
+
+        template <typename T>
+        VariableSpace<T>* ExecutionPlan<T>::prepareSpace() {
+            VariableSpace<T>* space = nullptr;
+            if (_compiled) {
+                space = new VariableSpace<T>();
+
+                for (auto var: _shared) {
+                    std::pair<int, int> pair(var->id(), var->index());
+                    space->injectVariable(pair, var->reference());
+                }
+            } else {
+                // logic ops can modify external variables, so such graphs still get deep copy
+                space = _graph->getVariableSpace()->clone();
+            }
+
+            nd4j::memory::Workspace *workspace = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_workspaces.empty()) {
+                    workspace = _workspaces.back();
+                    _workspaces.pop_back();
+                }
+            }
+
+            // inputs are fed after this method returns, so new workspace is sized in execute(), for their shapes
+            if (workspace == nullptr)
+                workspace = new nd4j::memory::Workspace();
+
+            // new cycle: workspace grows here if previous run didn't fit into it
+            workspace->scopeIn();
+            space->setWorkspace(workspace);
+
+            return space;
+        }
+
+        template <typename T>
+        void ExecutionPlan<T>::releaseSpace(VariableSpace<T> *space) {
+            auto workspace = space->workspace();
+
+            // footprint is tracked for input shapes of this run
+            auto key = _graph->footprintKey(space);
+
+            delete space;
+
+            nd4j::memory::MemoryRegistrator::getInstance()->setGraphMemoryFootprintIfGreater(key, workspace->getAllocatedSize());
+
+            // arrays allocated during this run are gone, so memory is available for next run
+            workspace->scopeOut();
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            _workspaces.emplace_back(workspace);
+        }
+
+        template <typename T>
+        Nd4jStatus ExecutionPlan<T>::execute(VariableSpace<T> *space) {
+            if (!_compiled)
+                return GraphExecutioner<T>::execute(_graph, space);
+
+            // footprint is looked up for fed input shapes, the same way releaseSpace() records it
+            auto footprint = nd4j::memory::MemoryRegistrator::getInstance()->getGraphMemoryFootprint(_graph->footprintKey(space));
+            if (footprint > 0 && space->workspace() != nullptr)
+                space->workspace()->expandTo(footprint);
+
+            FlowPath flowPath;
+            bool tempFlow = space->flowPath() == nullptr;
+            if (tempFlow)
+                space->setFlowPath(&flowPath);
+
+            // memory plan is valid only for shapes it was built for
+            auto signature = MemoryPlan<T>::signature(space);
+            std::shared_ptr<MemoryPlan<T>> memoryPlan;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_memoryPlan != nullptr && _memoryPlan->matches(signature))
+                    memoryPlan = _memoryPlan;
+            }
+
+            T* arena = nullptr;
+            PlannedOutputs<T>* outputs = nullptr;
+            if (memoryPlan != nullptr && memoryPlan->plannedBytes() > 0) {
+                arena = reinterpret_cast<T *>(space->workspace()->allocateBytes(memoryPlan->plannedBytes()));
+
+                // workspace is used by one run at a time, so are its arrays
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto &entry = _outputs[space->workspace()];
+                if (entry.first != memoryPlan) {
+                    entry.first = memoryPlan;
+                    entry.second.reset(memoryPlan->createOutputs());
+                }
+
+                outputs = entry.second.get();
+            }
+
+            Nd4jStatus status = ND4J_STATUS_OK;
+            for (int e = 0; e < (int) _nodes.size(); e++) {
+                if (_ops[e] == nullptr)
+                    continue;
+
+                if (arena != nullptr)
+                    memoryPlan->placeOutputs(e, space, arena, outputs);
+
+                Context<T> context(_nodes[e]->getContextPrototype(), space);
+                context.markInplace(_inplace[e]);
+
+                status = _ops[e]->execute(&context);
+                if (status != ND4J_STATUS_OK)
+                    break;
+
+                // folded nodes refer to the same array
+                for (auto id: _aliases[e]) {
+                    std::pair<int, int> source(_nodes[e]->id(), 0);
+                    std::pair<int, int> alias(id, 0);
+
+                    auto var = space->getVariable(source)->reference();
+                    var->setId(id, 0);
+                    space->injectVariable(alias, var);
+                }
+            }
+
+            // outputs were allocated one by one during this run, now we know their shapes and live ranges
+            if (status == ND4J_STATUS_OK && memoryPlan == nullptr) {
+                memoryPlan.reset(MemoryPlan<T>::build(_nodes, space, _graph->output(), signature));
+
+                std::lock_guard<std::mutex> lock(_mutex);
+                _memoryPlan = memoryPlan;
+            }
+
+            if (Environment::getInstance()->isProfiling() && memoryPlan != nullptr && space->flowPath() != nullptr)
+                space->flowPath()->profile()->setPlannedMemory(memoryPlan->plannedBytes(), memoryPlan->naiveBytes());
+
+            if (tempFlow)
+                space->setFlowPath(nullptr);
+
+            return status;
+        }
+
+
+        template class ND4J_EXPORT ExecutionPlan<float>;
+        template class ND4J_EXPORT ExecutionPlan<float16>;
+        template class ND4J_EXPORT ExecutionPlan<double>;
+    }
+}
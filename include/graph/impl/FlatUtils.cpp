@@ -6,6 +6,7 @@
 #include <array/DataTypeConversions.h>
 #include <array/DataTypeUtils.h>
 #include <array/ByteOrderUtils.h>
+#include <helpers/BitwiseUtils.h>
 
 
 namespace nd4j {
@@ -19,21 +20,35 @@ namespace nd4j {
         }
 
         template<typename T>
-        NDArray<T> *FlatUtils::fromFlatArray(const nd4j::graph::FlatArray *flatArray) {
+        NDArray<T> *FlatUtils::fromFlatArray(const nd4j::graph::FlatArray *flatArray, bool allowView) {
             int * newShape = new int[shape::shapeInfoLength((int *)flatArray->shape()->data())];
             memcpy(newShape, flatArray->shape()->data(), shape::shapeInfoByteLength((int *)flatArray->shape()->data()));
 
+            auto dtype = DataTypeUtils::fromFlatDataType(flatArray->dtype());
+            auto order = ByteOrderUtils::fromFlatByteOrder(flatArray->byteOrder());
+            auto data = (void *) flatArray->buffer()->data();
+
+            // buffer that already holds T values is used as is. it's private copy-on-write memory, so foreign byte order is fixed in place
+            if (allowView && dtype == DataTypeUtils::fromT<T>() && reinterpret_cast<Nd4jIndex>(data) % sizeof(T) == 0) {
+                if (order != BitwiseUtils::asByteOrder())
+                    DataTypeConversions<T>::convertType(reinterpret_cast<T *>(data), data, dtype, order, shape::length(newShape));
+
+                auto array = new NDArray<T>(reinterpret_cast<T *>(data), newShape);
+                array->triggerAllocationFlag(false, true);
+
+                return array;
+            }
+
             T * newBuffer = new T[shape::length(newShape)];
-            DataTypeConversions<T>::convertType(newBuffer, (void *) flatArray->buffer()->data(), DataTypeUtils::fromFlatDataType(flatArray->dtype()), ByteOrderUtils::fromFlatByteOrder(flatArray->byteOrder()),  shape::length(newShape));
+            DataTypeConversions<T>::convertType(newBuffer, data, dtype, order, shape::length(newShape));
             auto array = new NDArray<T>(newBuffer, newShape);
             array->triggerAllocationFlag(true, true);
 
             return array;
         }
 
-
-        template NDArray<float> *FlatUtils::fromFlatArray<float>(const nd4j::graph::FlatArray *flatArray);
-        template NDArray<float16> *FlatUtils::fromFlatArray<float16>(const nd4j::graph::FlatArray *flatArray);
-        template NDArray<double> *FlatUtils::fromFlatArray<double>(const nd4j::graph::FlatArray *flatArray);
+        template NDArray<float> *FlatUtils::fromFlatArray<float>(const nd4j::graph::FlatArray *flatArray, bool allowView);
+        template NDArray<float16> *FlatUtils::fromFlatArray<float16>(const nd4j::graph::FlatArray *flatArray, bool allowView);
+        template NDArray<double> *FlatUtils::fromFlatArray<double>(const nd4j::graph::FlatArray *flatArray, bool allowView);
     }
 }
\ No newline at end of file
@@ -22,109 +22,140 @@ namespace nd4j {
         }
 
         void FlowPath::setInnerTime(int nodeId, Nd4jIndex time) {
+            std::lock_guard<std::mutex> lock(_mutex);
+
             ensureNode(nodeId);
 
             _states[nodeId].setInnerTime(time);
         }
 
         void FlowPath::setOuterTime(int nodeId, Nd4jIndex time) {
+            std::lock_guard<std::mutex> lock(_mutex);
+
             ensureNode(nodeId);
 
             _states[nodeId].setOuterTime(time);
         }
 
         Nd4jIndex FlowPath::innerTime(int nodeId) {
+            std::lock_guard<std::mutex> lock(_mutex);
+
             ensureNode(nodeId);
 
             return _states[nodeId].innerTime();
         }
 
         Nd4jIndex FlowPath::outerTime(int nodeId) {
+            std::lock_guard<std::mutex> lock(_mutex);
+
             ensureNode(nodeId);
 
             return _states[nodeId].outerTime();
         }
 
         bool FlowPath::isNodeActive(int nodeId) {
+            std::lock_guard<std::mutex> lock(_mutex);
+
             ensureNode(nodeId);
 
             return _states[nodeId].isActive();
         }
             
         void FlowPath::markNodeActive(int nodeId, bool isActive) {
+            std::lock_guard<std::mutex> lock(_mutex);
+
             ensureNode(nodeId);
 
             _states[nodeId].markActive(isActive);
         }
 
         int FlowPath::branch(int nodeId){
+            std::lock_guard<std::mutex> lock(_mutex);
+
             ensureNode(nodeId);
 
             return _states[nodeId].branch();
         }
 
         void FlowPath::markBranch(int nodeId, int index) {
+            std::lock_guard<std::mutex> lock(_mutex);
+
             ensureNode(nodeId);
 
             _states[nodeId].markBranch(index);
         }
 
         bool FlowPath::isFrameActive(Nd4jIndex frameId) {
+            std::lock_guard<std::mutex> lock(_mutex);
+
             ensureFrame(frameId);
 
             return _frames[frameId].wasActivated();
         }
 
         void FlowPath::markFrameActive(Nd4jIndex frameId, bool isActive) {
+            std::lock_guard<std::mutex> lock(_mutex);
+
             ensureFrame(frameId);
 
             _frames[frameId].markActivated(isActive);
         }
 
         bool FlowPath::isRewindPlanned(Nd4jIndex frameId) {
+            std::lock_guard<std::mutex> lock(_mutex);
             return _frames[frameId].isRewindPlanned();
         }
 
         void FlowPath::planRewind(Nd4jIndex frameId, bool reallyRewind) {
+            std::lock_guard<std::mutex> lock(_mutex);
             _frames[frameId].planRewind(reallyRewind);
         }
 
         int FlowPath::getRewindPosition(Nd4jIndex frameId) {
+            std::lock_guard<std::mutex> lock(_mutex);
             return _frames[frameId].getRewindPosition();
         }
 
         void FlowPath::setRewindPosition(Nd4jIndex frameId, int position) {
+            std::lock_guard<std::mutex> lock(_mutex);
             _frames[frameId].setRewindPosition(position);
         }
 
         void FlowPath::setRewindPositionOnce(Nd4jIndex frameId, int position) {
+            std::lock_guard<std::mutex> lock(_mutex);
             _frames[frameId].setRewindPositionOnce(position);
         }
 
         void FlowPath::registerFrame(Nd4jIndex frameId) {
+            std::lock_guard<std::mutex> lock(_mutex);
             if (_frames.count(frameId) == 0)
                 ensureFrame(frameId);
         }
 
         void FlowPath::forgetFrame(Nd4jIndex frameId) {
+            std::lock_guard<std::mutex> lock(_mutex);
             if (_frames.count(frameId) > 0)
                 _frames.erase(frameId);
         }
 
         void FlowPath::incrementNumberOfCycles(Nd4jIndex frameId) {
+            std::lock_guard<std::mutex> lock(_mutex);
             _frames[frameId].incrementNumberOfCycles();
         }
 
         Nd4jIndex FlowPath::getNumberOfCycles(Nd4jIndex frameId) {
+            std::lock_guard<std::mutex> lock(_mutex);
             return _frames[frameId].getNumberOfCycles();
         }
 
 
         bool FlowPath::wasExecuted(int nodeId) {
+            std::lock_guard<std::mutex> lock(_mutex);
             return _states[nodeId].wasExecuted();
         }
 
         void FlowPath::markExecuted(int nodeId, bool wasExecuted) {
+            std::lock_guard<std::mutex> lock(_mutex);
             _states[nodeId].markExecuted(wasExecuted);
         }
 
@@ -288,6 +288,8 @@ namespace nd4j {
             delete _onion;
             delete _configuration;
 
+            // variables are gone at this point, so nothing refers to file memory anymore
+            delete _file;
 
             // delete _onion content here
         }
@@ -295,6 +297,10 @@ namespace nd4j {
         template <typename T>
         void Graph<T>::addNode(Node<T> *node) {
             _built.store(false);
+            _dependenciesBuilt = false;
+
+            // structure changes, so cached hash is recomputed on next build
+            _hashCode.store(0L);
 
             if (node->opType() == OpType_LOGIC) {
                 nd4j_debug("Adding LogicOp [%i]\n", node->opNum());
@@ -521,6 +527,8 @@ namespace nd4j {
         Nd4jStatus Graph<T>::buildGraph() {
             if (_built.load()) {
                 prepareOutputs();
+                buildDependencies();
+                hashCode();
                 return ND4J_STATUS_OK;
             }
 
@@ -709,10 +717,143 @@ namespace nd4j {
                 _built.store(true);
 
             prepareOutputs();
+            buildDependencies();
+
+            // structural hash is computed once, so executions don't have to rebuild it
+            if (_built.load())
+                hashCode();
 
             return ND4J_STATUS_OK;
         }
 
+        template <typename T>
+        void Graph<T>::buildDependencies() {
+            std::lock_guard<std::mutex> lock(_mutexDependencies);
+
+            if (_dependenciesBuilt || !_built.load())
+                return;
+
+            _executionOrder.clear();
+            _inDegrees.clear();
+            _dependents.clear();
+
+            std::map<int, int> positions;
+            for (auto &v: *_onion)
+                for (auto node: *v.second) {
+                    positions[node->id()] = (int) _executionOrder.size();
+                    _executionOrder.emplace_back(node);
+                }
+
+            int numNodes = (int) _executionOrder.size();
+            _inDegrees.resize(numNodes, 0);
+            _dependents.resize(numNodes);
+
+            bool dataflow = _scopes.empty();
+            std::map<int, int> consumers;
+            for (int e = 0; e < numNodes; e++) {
+                auto node = _executionOrder[e];
+
+                if (node->opType() == OpType_LOGIC || node->hasGraphEmbedded() || node->isDivergencePoint() || node->isScoped())
+                    dataflow = false;
+
+                std::vector<int> producers;
+                for (auto &p: *node->input()) {
+                    consumers[p.first]++;
+
+                    // external variables are available from the very beginning
+                    if (p.first < 0 || positions.count(p.first) == 0)
+                        continue;
+
+                    int producer = positions.at(p.first);
+                    if (producer == e) {
+                        dataflow = false;
+                        continue;
+                    }
+
+                    if (std::find(producers.begin(), producers.end(), producer) != producers.end())
+                        continue;
+
+                    producers.emplace_back(producer);
+                    _dependents[producer].emplace_back(e);
+                }
+
+                _inDegrees[e] = (int) producers.size();
+            }
+
+            // in-place node can't run concurrently with other consumers of the same input
+            for (auto node: _executionOrder) {
+                if (!node->isInplace())
+                    continue;
+
+                for (auto &p: *node->input())
+                    if (consumers[p.first] > 1)
+                        dataflow = false;
+            }
+
+            // Kahn's pass: depth of each node, so we know how many nodes can be executed at once
+            std::vector<int> pending(_inDegrees);
+            std::vector<int> depth(numNodes, 0);
+            std::vector<int> queue;
+            std::map<int, int> widths;
+
+            for (int e = 0; e < numNodes; e++)
+                if (pending[e] == 0)
+                    queue.emplace_back(e);
+
+            for (int q = 0; q < (int) queue.size(); q++) {
+                int e = queue[q];
+                widths[depth[e]]++;
+
+                for (auto d: _dependents[e]) {
+                    depth[d] = nd4j::math::nd4j_max<int>(depth[d], depth[e] + 1);
+                    if (--pending[d] == 0)
+                        queue.emplace_back(d);
+                }
+            }
+
+            _maxWidth = 1;
+            for (auto &w: widths)
+                _maxWidth = nd4j::math::nd4j_max<int>(_maxWidth, w.second);
+
+            // cycles can't be resolved with in-degree counters
+            if ((int) queue.size() != numNodes)
+                dataflow = false;
+
+            _dataflow = dataflow;
+            _parallelizable = dataflow && _maxWidth > 1;
+            _dependenciesBuilt = true;
+        }
+
+        template <typename T>
+        std::vector<Node<T> *>* Graph<T>::executionOrder() {
+            return &_executionOrder;
+        }
+
+        template <typename T>
+        std::vector<int>* Graph<T>::inDegrees() {
+            return &_inDegrees;
+        }
+
+        template <typename T>
+        std::vector<std::vector<int>>* Graph<T>::dependents() {
+            return &_dependents;
+        }
+
+        template <typename T>
+        int Graph<T>::maxWidth() {
+            return _maxWidth;
+        }
+
+        template <typename T>
+        bool Graph<T>::isParallelizable() {
+            return _parallelizable;
+        }
+
+        template <typename T>
+        bool Graph<T>::isDataflow() {
+            return _dataflow;
+        }
+
         template <typename T>
         void Graph<T>::tagInplaceNodes() {
             // just calling, in case it wasn't built before
@@ -876,7 +1017,8 @@ namespace nd4j {
         }
 
         template <typename T>
-        Graph<T>::Graph(const FlatGraph *flatGraph, VariableSpace<T> *variableSpace) {
+        Graph<T>::Graph(const FlatGraph *flatGraph, VariableSpace<T> *variableSpace, MappedFile *file) {
+            this->_file = file;
             this->_onion = new std::map<int, std::vector<Node<T> *> *>();
             this->_mapped = new std::map<int, Node<T> *> ();
             this->_nodes = new std::vector<int>();
@@ -912,8 +1054,18 @@ namespace nd4j {
                 for (unsigned int e = 0; e < flatGraph->variables()->size(); e++) {
                     auto flatVar = flatGraph->variables()->Get(e);
 
-                    auto var = new Variable<T>(flatVar);
+                    auto var = new Variable<T>(flatVar, _file != nullptr);
                     std::pair<int, int> pair(flatVar->id()->first(), flatVar->id()->second());
+
+                    if (var->hasNDArray()) {
+                        auto array = var->getNDArray();
+                        auto bytes = array->lengthOf() * (Nd4jIndex) sizeof(T);
+
+                        if (_file != nullptr && _file->contains(array->getBuffer()))
+                            _bytesMapped += bytes;
+                        else if (flatVar->ndarray() != nullptr)
+                            _bytesConverted += bytes;
+                    }
                     _variableSpace->putVariable(pair, var);
 
                     // if that's VariableSpace mode - we're pushing it to _output
@@ -1097,6 +1249,26 @@ namespace nd4j {
             _variableSpace = nullptr;
         }
 
+        template <typename T>
+        void Graph<T>::setImportTime(Nd4jIndex nanos) {
+            _importTime = nanos;
+        }
+
+        template <typename T>
+        Nd4jIndex Graph<T>::importTime() {
+            return _importTime;
+        }
+
+        template <typename T>
+        Nd4jIndex Graph<T>::bytesMapped() {
+            return _bytesMapped;
+        }
+
+        template <typename T>
+        Nd4jIndex Graph<T>::bytesConverted() {
+            return _bytesConverted;
+        }
+
         template <typename T>
         void Graph<T>::replaceState(VariableSpace<T> *state, ExecutorConfiguration *configuration) {
             delete _variableSpace;
@@ -1187,17 +1359,22 @@ namespace nd4j {
 
         template <typename T>
         Nd4jIndex Graph<T>::hashCode() {
+            Nd4jIndex hash = _hashCode.load();
+            if (hash != 0L)
+                return hash;
+
             if (!_built.load())
                 this->buildGraph();
 
-            Nd4jIndex hash = 0L;
             std::string localStamp;
             /**
              * Plan is:
-             * 1) get shapes of existing variables
-             * 2) get hash codes of individual ops
-             * 3) optionally: get node names, if they are defined
+             * 1) data type
+             * 2) ids of nodes, their ops and inputs
+             * 3) optionally: node names, if they are defined
              * 4) use long hash on that
+             *
+             * Variables aren't taken into account: their shapes may change between runs, see footprintKey()
              */
 
             // FIXME: remove once additional dtypes added
@@ -1209,37 +1386,63 @@ namespace nd4j {
                 localStamp += "HALF";
             }
 
-            int cnt = 0;
-            if (_variableSpace != nullptr) {
-                // loop over existing variables
-                for (auto v: *(_variableSpace->handles())) {
-                    if (v->hasNDArray()) {
-                        NDArray<T> *arr = v->getNDArray();
-                        auto shape = arr->getShapeAsVector();
-                        auto string = ShapeUtils<T>::shapeAsString(shape);
-                        localStamp += string;
-                    }
-                }
-            }
-
             // loop over nodes in graph
             for (auto &v: *_mapped) {
                 Node<T> *node = v.second;
 
+                localStamp += "[" + std::to_string(node->id()) + ":" + std::to_string((int) node->opType()) + ":" + std::to_string(node->opNum());
+                for (auto &in: *node->input())
+                    localStamp += ":" + std::to_string(in.first) + "/" + std::to_string(in.second);
+
+                localStamp += "]";
+
                 // optional part: node names
                 if (!node->name()->empty()) {
                     localStamp += *(node->name());
                 }
             }
 
+            hash = HashHelper::getInstance()->getLongHash(localStamp);
 
-            hash = HashHelper::getInstance()->getLongHash(localStamp);        
+            // 0 is reserved for hash that wasn't computed yet
+            if (hash == 0L)
+                hash = 1L;
 
             nd4j_debug("Graph hash: %lld\n", hash);
 
+            _hashCode.store(hash);
+
             return hash;
         }
 
+        template <typename T>
+        Nd4jIndex Graph<T>::footprintKey(VariableSpace<T> *variableSpace) {
+            auto key = (uint64_t) hashCode();
+
+            for (auto v: *variableSpace->handles()) {
+                // node outputs follow from inputs, so only external variables matter here
+                if (v->id() >= 0 || !v->hasNDArray())
+                    continue;
+
+                auto shapeInfo = v->getNDArray()->getShapeInfo();
+                int rank = shape::rank(shapeInfo);
+                int *shape = shape::shapeOf(shapeInfo);
+
+                // FNV-1a over variable id, rank and dimensions rounded up to power of 2
+                key = (key ^ (uint64_t) (uint32_t) v->id()) * 1099511628211ULL;
+                key = (key ^ (uint64_t) rank) * 1099511628211ULL;
+                for (int e = 0; e < rank; e++) {
+                    uint64_t bucket = 1;
+                    while (bucket < (uint64_t) shape[e])
+                        bucket <<= 1;
+
+                    key = (key ^ bucket) * 1099511628211ULL;
+                }
+            }
+
+            return (Nd4jIndex) key;
+        }
+
         template class ND4J_EXPORT Graph<float>;
         template class ND4J_EXPORT Graph<float16>;
         template class ND4J_EXPORT Graph<double>;
@@ -14,19 +14,73 @@ namespace nd4j {
             return _INSTANCE;
         };
 
+        template <>
+        bool GraphHolder::hasGraph<float>(Nd4jIndex graphId) {
+            return _graphF.count(graphId) > 0;
+        }
+
+        template <>
+        bool GraphHolder::hasGraph<float16>(Nd4jIndex graphId) {
+            return _graphH.count(graphId) > 0;
+        }
+
+        template <>
+        bool GraphHolder::hasGraph<double>(Nd4jIndex graphId) {
+            return _graphD.count(graphId) > 0;
+        }
+
+        template <>
+        void GraphHolder::forgetGraph<float>(Nd4jIndex graphId) {
+            if (this->hasGraph<float>(graphId)) {
+                delete _planF[graphId];
+
+                _planF.erase(graphId);
+                _graphF.erase(graphId);
+            }
+        }
+
+        template <>
+        void GraphHolder::forgetGraph<float16>(Nd4jIndex graphId) {
+            if (this->hasGraph<float16>(graphId)) {
+                delete _planH[graphId];
+
+                _planH.erase(graphId);
+                _graphH.erase(graphId);
+            }
+        }
+
+        template <>
+        void GraphHolder::forgetGraph<double>(Nd4jIndex graphId) {
+            if (this->hasGraph<double>(graphId)) {
+                delete _planD[graphId];
+
+                _planD.erase(graphId);
+                _graphD.erase(graphId);
+            }
+        }
+
         template <>
         void GraphHolder::registerGraph(Nd4jIndex graphId, Graph<float>* graph) {
+            forgetGraph<float>(graphId);
+
             _graphF[graphId] = graph;
+            _planF[graphId] = new ExecutionPlan<float>(graph);
         }
 
         template <>
         void GraphHolder::registerGraph(Nd4jIndex graphId, Graph<float16>* graph) {
+            forgetGraph<float16>(graphId);
+
             _graphH[graphId] = graph;
+            _planH[graphId] = new ExecutionPlan<float16>(graph);
         }
 
         template <>
         void GraphHolder::registerGraph(Nd4jIndex graphId, Graph<double>* graph) {
+            forgetGraph<double>(graphId);
+
             _graphD[graphId] = graph;
+            _planD[graphId] = new ExecutionPlan<double>(graph);
         }
             
         template <>
@@ -77,41 +131,42 @@ namespace nd4j {
             return graph;
         }
 
-        template <typename T>
-        void GraphHolder::forgetGraph(Nd4jIndex graphId) {
-            if (sizeof(T) == 4) {
-                if (this->hasGraph<float>(graphId))
-                    _graphF.erase(graphId);
-            } else if (sizeof(T) == 2) {
-                if (this->hasGraph<double>(graphId))
-                    _graphD.erase(graphId);
-            } else if (sizeof(T) == 8) {
-                if (this->hasGraph<float16>(graphId))
-                    _graphH.erase(graphId);
+        template <>
+        ExecutionPlan<float>* GraphHolder::pullPlan(Nd4jIndex graphId) {
+            if (!this->hasGraph<float>(graphId)) {
+                nd4j_printf("GraphHolder doesn't have graph stored for [%lld]\n", graphId);
+                throw "Bad argument";
             }
+
+            return _planF[graphId];
+        }
+
+        template <>
+        ExecutionPlan<float16>* GraphHolder::pullPlan(Nd4jIndex graphId) {
+            if (!this->hasGraph<float16>(graphId)) {
+                nd4j_printf("GraphHolder doesn't have graph stored for [%lld]\n", graphId);
+                throw "Bad argument";
+            }
+
+            return _planH[graphId];
+        }
+
+        template <>
+        ExecutionPlan<double>* GraphHolder::pullPlan(Nd4jIndex graphId) {
+            if (!this->hasGraph<double>(graphId)) {
+                nd4j_printf("GraphHolder doesn't have graph stored for [%lld]\n", graphId);
+                throw "Bad argument";
+            }
+
+            return _planD[graphId];
         }
 
         template <typename T>
         void GraphHolder::dropGraph(Nd4jIndex graphId) {
-            // FIXME: we don't want this sizeof(T) here really. especially once we add multi-dtype support
-            if (sizeof(T) == 4) {
-                if (this->hasGraph<float>(graphId)) {
-                    auto g = _graphF[graphId];
-                    forgetGraph<float>(graphId);
-                    delete g;
-                }
-            } else if (sizeof(T) == 8) {
-                if (this->hasGraph<double>(graphId)) {
-                    auto g = _graphD[graphId];
-                    forgetGraph<double>(graphId);
-                    delete g;
-                }
-            } else if (sizeof(T) == 2) {
-                if (this->hasGraph<float16>(graphId)) {
-                    auto g = _graphH[graphId];
-                    forgetGraph<float16>(graphId);
-                    delete g;
-                }
+            if (this->hasGraph<T>(graphId)) {
+                auto g = pullGraph<T>(graphId);
+                forgetGraph<T>(graphId);
+                delete g;
             }
         }
 
@@ -121,17 +176,11 @@ namespace nd4j {
             this->dropGraph<double>(graphId);
         }
 
-        template<typename T>
-        bool GraphHolder::hasGraph(Nd4jIndex graphId) {
-            return _graphF.count(graphId) > 0;
-        }
-
-
-        template bool GraphHolder::hasGraph<float>(Nd4jIndex graphId);
-        template void GraphHolder::forgetGraph<float>(Nd4jIndex graphId);
         template void GraphHolder::dropGraph<float>(Nd4jIndex graphId);
+        template void GraphHolder::dropGraph<float16>(Nd4jIndex graphId);
+        template void GraphHolder::dropGraph<double>(Nd4jIndex graphId);
 
 
         GraphHolder* GraphHolder::_INSTANCE = 0;
     }
-}
\ No newline at end of file
+}
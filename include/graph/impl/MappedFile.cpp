@@ -0,0 +1,87 @@
+//
+//  @author raver119@gmail.com
+//
+
+#include <graph/MappedFile.h>
+#include <helpers/logger.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <stdio.h>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace nd4j {
+    namespace graph {
+        MappedFile::MappedFile(const char *filename) {
+            struct stat stat_buf;
+            if (stat(filename, &stat_buf) != 0) {
+                nd4j_printf("File [%s] wasn't found. Please check path and permissions\n", filename);
+                throw "File not found";
+            }
+
+            _length = (Nd4jIndex) stat_buf.st_size;
+            nd4j_debug("File length: %lld\n", _length);
+
+#ifndef _WIN32
+            int fd = open(filename, O_RDONLY);
+            if (fd >= 0 && _length > 0) {
+                void *ptr = mmap(nullptr, (size_t) _length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+                close(fd);
+
+                if (ptr != MAP_FAILED) {
+                    _data = reinterpret_cast<uint8_t *>(ptr);
+                    _mapped = true;
+                    return;
+                }
+            } else if (fd >= 0)
+                close(fd);
+#endif
+
+            // no mmap available, so we just read the whole file at once
+            _data = new uint8_t[_length];
+
+            FILE *in = fopen(filename, "rb");
+            if (in == nullptr || (Nd4jIndex) fread(_data, 1, (size_t) _length, in) != _length) {
+                if (in != nullptr)
+                    fclose(in);
+
+                delete[] _data;
+                nd4j_printf("Unable to read file [%s]\n", filename);
+                throw "Unable to read file";
+            }
+
+            fclose(in);
+        }
+
+        MappedFile::~MappedFile() {
+#ifndef _WIN32
+            if (_mapped) {
+                munmap(_data, (size_t) _length);
+                return;
+            }
+#endif
+            delete[] _data;
+        }
+
+        uint8_t* MappedFile::data() {
+            return _data;
+        }
+
+        Nd4jIndex MappedFile::length() {
+            return _length;
+        }
+
+        bool MappedFile::isMapped() {
+            return _mapped;
+        }
+
+        bool MappedFile::contains(void *ptr) {
+            auto p = reinterpret_cast<uint8_t *>(ptr);
+            return p >= _data && p < _data + _length;
+        }
+    }
+}
@@ -0,0 +1,262 @@
+//
+//  @author raver119@gmail.com
+//
+
+#include <graph/MemoryPlan.h>
+#include <helpers/shape.h>
+#include <algorithm>
+#include <map>
+#include <set>
+
+namespace nd4j {
+    namespace graph {
+        // planned arrays start at 64-byte boundaries within arena
+        static const Nd4jIndex PLAN_ALIGNMENT = 64;
+
+        template <typename T>
+        PlannedOutputs<T>::PlannedOutputs(int numberOfArrays) {
+            _shapes.resize(numberOfArrays);
+            for (int e = 0; e < numberOfArrays; e++)
+                _arrays.emplace_back(new NDArray<T>());
+        }
+
+        template <typename T>
+        PlannedOutputs<T>::~PlannedOutputs() {
+            for (auto a: _arrays)
+                delete a;
+        }
+
+        template <typename T>
+        std::vector<int> MemoryPlan<T>::signature(VariableSpace<T> *space) {
+            std::vector<int> result;
+            for (auto var: *space->handles()) {
+                if (!var->hasNDArray())
+                    continue;
+
+                auto shapeInfo = var->getNDArray()->getShapeInfo();
+
+                result.emplace_back(var->id());
+                result.emplace_back(var->index());
+                for (int e = 0; e < shape::shapeInfoLength(shapeInfo); e++)
+                    result.emplace_back(shapeInfo[e]);
+            }
+
+            return result;
+        }
+
+        template <typename T>
+        MemoryPlan<T>* MemoryPlan<T>::build(std::vector<Node<T>*> &nodes, VariableSpace<T> *space, std::vector<int> *outputs, std::vector<int> &signature) {
+            auto plan = new MemoryPlan<T>();
+            plan->_signature = signature;
+            plan->_byPosition.resize(nodes.size());
+
+            int numNodes = (int) nodes.size();
+            Nd4jIndex alignment = nd4j::math::nd4j_max<Nd4jIndex>(1L, PLAN_ALIGNMENT / (Nd4jIndex) sizeof(T));
+
+            std::map<int, int> positions;
+            for (int e = 0; e < numNodes; e++)
+                positions[nodes[e]->id()] = e;
+
+            // memory that isn't produced by nodes, it's never planned
+            std::vector<std::pair<T*, Nd4jIndex>> external;
+            for (auto var: *space->handles())
+                if (var->hasNDArray() && positions.count(var->id()) == 0)
+                    external.emplace_back(std::pair<T*, Nd4jIndex>(var->getNDArray()->getBuffer(), var->getNDArray()->lengthOf()));
+
+            // buffers observed during execution, and live ranges of planned arrays
+            std::vector<std::pair<T*, Nd4jIndex>> buffers;
+            std::vector<Nd4jIndex> lengths;
+            std::vector<int> starts;
+            std::vector<int> ends;
+
+            // variable -> planned array that holds its memory. in-place outputs and views refer to the same array
+            std::map<std::pair<int, int>, int> owners;
+
+            auto lookup = [] (std::vector<std::pair<T*, Nd4jIndex>> &list, T *buffer) -> int {
+                for (int e = 0; e < (int) list.size(); e++)
+                    if (buffer >= list[e].first && buffer < list[e].first + list[e].second)
+                        return e;
+
+                return -1;
+            };
+
+            // variables that aren't outputs of given nodes may still refer to planned array, i.e. outputs of folded nodes
+            auto owner = [&] (std::pair<int, int> &pair) -> int {
+                auto it = owners.find(pair);
+                if (it != owners.end())
+                    return it->second;
+
+                if (!space->hasVariable(pair) || !space->getVariable(pair)->hasNDArray())
+                    return -1;
+
+                return lookup(buffers, space->getVariable(pair)->getNDArray()->getBuffer());
+            };
+
+            for (int p = 0; p < numNodes; p++) {
+                auto node = nodes[p];
+
+                for (int idx = 0; ; idx++) {
+                    std::pair<int, int> pair(node->id(), idx);
+                    if (!space->hasVariable(pair))
+                        break;
+
+                    auto var = space->getVariable(pair);
+                    if (!var->hasNDArray())
+                        continue;
+
+                    auto array = var->getNDArray();
+                    auto buffer = array->getBuffer();
+
+                    int t = lookup(buffers, buffer);
+                    if (t >= 0) {
+                        owners[pair] = t;
+                        ends[t] = nd4j::math::nd4j_max<int>(ends[t], p);
+                        continue;
+                    }
+
+                    // views of external arrays, and strided arrays aren't planned
+                    if (lookup(external, buffer) >= 0 || array->ews() != 1)
+                        continue;
+
+                    Nd4jIndex length = array->lengthOf();
+
+                    t = (int) buffers.size();
+                    buffers.emplace_back(std::pair<T*, Nd4jIndex>(buffer, length));
+                    lengths.emplace_back(((length + alignment - 1) / alignment) * alignment);
+                    starts.emplace_back(p);
+                    ends.emplace_back(p);
+
+                    auto shapeInfo = array->getShapeInfo();
+                    plan->_keys.emplace_back(pair);
+                    plan->_shapes.emplace_back(std::vector<int>(shapeInfo, shapeInfo + shape::shapeInfoLength(shapeInfo)));
+                    plan->_byPosition[p].emplace_back(t);
+
+                    owners[pair] = t;
+                }
+
+                // array stays alive till its last consumer
+                for (auto &in: *node->input()) {
+                    int t = owner(in);
+                    if (t >= 0)
+                        ends[t] = nd4j::math::nd4j_max<int>(ends[t], p);
+                }
+            }
+
+            // graph outputs are fetched after execution
+            std::set<int> results(outputs->begin(), outputs->end());
+            for (auto &o: owners)
+                if (results.count(o.first.first) > 0)
+                    ends[o.second] = numNodes;
+
+            for (auto id: results) {
+                std::pair<int, int> pair(id, 0);
+                int t = owner(pair);
+                if (t >= 0)
+                    ends[t] = numNodes;
+            }
+
+            // greedy by size: largest arrays are placed first, each one goes into smallest gap between arrays it coexists with
+            int numArrays = (int) lengths.size();
+            std::vector<int> order(numArrays);
+            for (int e = 0; e < numArrays; e++)
+                order[e] = e;
+
+            std::stable_sort(order.begin(), order.end(), [&] (int a, int b) -> bool { return lengths[a] > lengths[b]; });
+
+            plan->_offsets.resize(numArrays, 0L);
+            std::vector<int> placed;
+            for (auto t: order) {
+                std::vector<std::pair<Nd4jIndex, Nd4jIndex>> busy;
+                for (auto o: placed)
+                    if (starts[o] <= ends[t] && starts[t] <= ends[o])
+                        busy.emplace_back(std::pair<Nd4jIndex, Nd4jIndex>(plan->_offsets[o], lengths[o]));
+
+                std::sort(busy.begin(), busy.end());
+
+                Nd4jIndex best = -1;
+                Nd4jIndex bestGap = 0;
+                Nd4jIndex cursor = 0;
+                for (auto &b: busy) {
+                    Nd4jIndex gap = b.first - cursor;
+                    if (gap >= lengths[t] && (best < 0 || gap < bestGap)) {
+                        best = cursor;
+                        bestGap = gap;
+                    }
+
+                    cursor = nd4j::math::nd4j_max<Nd4jIndex>(cursor, b.first + b.second);
+                }
+
+                if (best < 0)
+                    best = cursor;
+
+                plan->_offsets[t] = best;
+                plan->_arenaLength = nd4j::math::nd4j_max<Nd4jIndex>(plan->_arenaLength, best + lengths[t]);
+                plan->_naiveLength += lengths[t];
+
+                placed.emplace_back(t);
+            }
+
+            nd4j_debug("Memory plan: %i arrays; %lld bytes planned; %lld bytes naive\n", numArrays, plan->plannedBytes(), plan->naiveBytes());
+
+            return plan;
+        }
+
+        template <typename T>
+        bool MemoryPlan<T>::matches(std::vector<int> &signature) {
+            return _signature == signature;
+        }
+
+        template <typename T>
+        Nd4jIndex MemoryPlan<T>::plannedBytes() {
+            return _arenaLength * (Nd4jIndex) sizeof(T);
+        }
+
+        template <typename T>
+        Nd4jIndex MemoryPlan<T>::naiveBytes() {
+            return _naiveLength * (Nd4jIndex) sizeof(T);
+        }
+
+        template <typename T>
+        int MemoryPlan<T>::numberOfArrays() {
+            return (int) _keys.size();
+        }
+
+        template <typename T>
+        PlannedOutputs<T>* MemoryPlan<T>::createOutputs() {
+            auto outputs = new PlannedOutputs<T>(numberOfArrays());
+            for (int t = 0; t < numberOfArrays(); t++)
+                outputs->_shapes[t] = _shapes[t];
+
+            return outputs;
+        }
+
+        template <typename T>
+        void MemoryPlan<T>::placeOutputs(int position, VariableSpace<T> *space, T *arena, PlannedOutputs<T> *outputs) {
+            for (auto t: _byPosition[position]) {
+                // previous run could reshape array in place
+                auto &shapeInfo = outputs->_shapes[t];
+                std::copy(_shapes[t].begin(), _shapes[t].end(), shapeInfo.begin());
+
+                auto array = outputs->_arrays[t];
+                array->setShapeInfo(shapeInfo.data());
+                array->setBuffer(arena + _offsets[t]);
+
+                // variable goes away with VariableSpace, array stays with outputs
+                auto var = new Variable<T>(array, nullptr, _keys[t].first, _keys[t].second);
+                var->markRemovable(false);
+
+                std::pair<int, int> pair(_keys[t]);
+                space->putVariable(pair, var);
+            }
+        }
+
+
+        template class ND4J_EXPORT PlannedOutputs<float>;
+        template class ND4J_EXPORT PlannedOutputs<float16>;
+        template class ND4J_EXPORT PlannedOutputs<double>;
+
+        template class ND4J_EXPORT MemoryPlan<float>;
+        template class ND4J_EXPORT MemoryPlan<float16>;
+        template class ND4J_EXPORT MemoryPlan<double>;
+    }
+}
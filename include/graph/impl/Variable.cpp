@@ -53,6 +53,22 @@ namespace nd4j {
             return result;
         }
 
+        template <typename T>
+        nd4j::graph::Variable<T>* nd4j::graph::Variable<T>::reference() {
+            auto result = new Variable<T>(this->isPlaceholder());
+            result->_external = this->_external;
+            result->_id = this->_id;
+            result->_readOnly = this->_readOnly;
+            result->_name = this->_name;
+            result->_index = this->_index;
+            result->_variableType = this->_variableType;
+            result->_ndarray = this->_ndarray;
+            result->_list = this->_list;
+            result->_removable = false;
+
+            return result;
+        }
+
         template <typename T>
         void nd4j::graph::Variable<T>::setIndex(int index) {
             _index = index;
@@ -180,7 +196,7 @@ namespace nd4j {
         }
 
         template <typename T>
-        nd4j::graph::Variable<T>::Variable(const nd4j::graph::FlatVariable *flatVariable) {
+        nd4j::graph::Variable<T>::Variable(const nd4j::graph::FlatVariable *flatVariable, bool allowView) {
             auto vid = flatVariable->id();
             this->_id = vid->first();
             this->_index = vid->second();
@@ -195,8 +211,7 @@ namespace nd4j {
 
             if (flatVariable->ndarray() != nullptr) {
                  auto ar = flatVariable->ndarray();
-                _ndarray = nd4j::graph::FlatUtils::fromFlatArray<T>(ar);
-                _ndarray->triggerAllocationFlag(true, true);
+                _ndarray = nd4j::graph::FlatUtils::fromFlatArray<T>(ar, allowView);
             } else if (flatVariable->shape() != nullptr) {
                 int shapeLen = flatVariable->shape()->Length();
                 //int *shape = new int[shapeLen];
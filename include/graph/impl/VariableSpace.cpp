@@ -34,7 +34,7 @@ namespace nd4j {
 
         template<typename T>
         void VariableSpace<T>::setWorkspace(nd4j::memory::Workspace *workspace) {
-            //_workspace = *workspace;
+            _attachedWorkspace = workspace;
         }
 
         template <typename T>
@@ -82,11 +82,15 @@ namespace nd4j {
 
         template <typename T>
         bool nd4j::graph::VariableSpace<T>::hasVariable(std::string *symbol) {
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
+
             return _symbolic.count(*symbol) == 1;
         }
 
         template <typename T>
         nd4j::graph::Variable<T> * nd4j::graph::VariableSpace<T>::getVariable(std::string *symbol) {
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
+
             return _symbolic.at(*symbol);
         }
 
@@ -131,6 +135,8 @@ namespace nd4j {
 
         template <typename T>
         nd4j::graph::Variable<T> * nd4j::graph::VariableSpace<T>::getVariable(std::pair<int, int>& pair) {
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
+
 //            if (pair.first == 0)
 //                throw "0 requested";
 
@@ -152,11 +158,15 @@ namespace nd4j {
 
         template <typename T>
         bool nd4j::graph::VariableSpace<T>::hasVariable(int id) {
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
+
             return _variables.count(id) == 1 || _temporary.count(id) == 1;
         }
 
         template <typename T>
         bool nd4j::graph::VariableSpace<T>::hasVariable(std::pair<int,int>& id) {
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
+
             return _paired.count(id) > 0;
         }
 
@@ -236,6 +246,8 @@ namespace nd4j {
 
         template <typename T>
         void nd4j::graph::VariableSpace<T>::putVariable(std::pair<int,int>& pair, Variable<T> *variable) {
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
+
             silentPutVariable(pair, variable);
 
             if (variable->isPlaceholder())
@@ -249,21 +261,21 @@ namespace nd4j {
                     _symbolic[*(variable->getName())] = variable;
                 }
 
-                _varmap.lock();
-
                 _handles->push_back(variable);
-
-                _varmap.unlock();
             }
         }
 
         template <typename T>
         void VariableSpace<T>::trackList(nd4j::NDArrayList<T>* list) {
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
+
             _lists.emplace_back(list);
         }
 
         template <typename T>
         void nd4j::graph::VariableSpace<T>::putVariable(int id, Variable<T> *variable) {
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
+
             // we don't want to add variables more then once
             if (_variables.count(id) > 0 || _temporary.count(id) > 0) {
                 nd4j_verbose("Trying to update variable for node_%i\n", id);
@@ -279,8 +291,6 @@ namespace nd4j {
 
             //nd4j_debug("Adding Variable to Space: id: %i; Array is null: %i;\n", id, variable->getNDArray() == nullptr);
 
-            _varmap.lock();
-
             _handles->emplace_back(variable);
 
             if (_auto_counter >= id)
@@ -306,8 +316,6 @@ namespace nd4j {
                 _temporary[id] = variable;
             }
 
-            _varmap.unlock();
-
             std::pair<int,int> pair(id, 0);
             if (!hasVariable(pair)) {
                 this->silentPutVariable(pair, variable);
@@ -325,6 +333,8 @@ namespace nd4j {
 
         template <typename T>
         nd4j::graph::Variable<T> * nd4j::graph::VariableSpace<T>::getVariable(int id) {
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
+
 //            _varmap.lock();
 
             if (id < 0) {
@@ -342,7 +352,7 @@ namespace nd4j {
 
         template <typename T>
         nd4j::memory::Workspace * nd4j::graph::VariableSpace<T>::workspace() {
-            return &_workspace;
+            return _attachedWorkspace != nullptr ? _attachedWorkspace : &_workspace;
         }
 
         template <typename T>
@@ -408,11 +418,14 @@ namespace nd4j {
 
         template <typename T>
         void VariableSpace<T>::dropVariable(std::pair<int,int> &pair) {
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
+
             dropVariable(pair.first, pair.second);
         }
 
         template <typename T>
         void VariableSpace<T>::dropVariable(int id, int idx) {
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
 
         }
 
@@ -28,6 +28,14 @@ namespace nd4j {
             Nd4jIndex _memoryTemporary = 0L;
             Nd4jIndex _memoryObjects = 0L;
 
+            // model weights: used directly from mapped file, and converted into heap buffers
+            Nd4jIndex _memoryMapped = 0L;
+            Nd4jIndex _memoryConverted = 0L;
+
+            // node outputs: arena size of static memory plan, and size without memory reuse
+            Nd4jIndex _memoryPlanned = 0L;
+            Nd4jIndex _memoryNaive = 0L;
+
             // time spent for graph construction
             Nd4jIndex _buildTime = 0L;
 
@@ -57,6 +65,16 @@ namespace nd4j {
             void addToTemporary(Nd4jIndex bytes);
             void addToObjects(Nd4jIndex bytes);
 
+            /**
+             * This method sets amount of model weights, in bytes, used directly from mapped file and converted into heap buffers during import
+             */
+            void setImportMemory(Nd4jIndex mapped, Nd4jIndex converted);
+
+            /**
+             * This method sets amount of memory, in bytes, node outputs take with static memory plan, and without it
+             */
+            void setPlannedMemory(Nd4jIndex planned, Nd4jIndex naive);
+
             /**
              * This method allows to set graph construction (i.e. deserialization) time in nanoseconds
              */
@@ -36,6 +36,16 @@ namespace nd4j {
             _memoryObjects += bytes;
         }
 
+        void GraphProfile::setImportMemory(Nd4jIndex mapped, Nd4jIndex converted) {
+            _memoryMapped = mapped;
+            _memoryConverted = converted;
+        }
+
+        void GraphProfile::setPlannedMemory(Nd4jIndex planned, Nd4jIndex naive) {
+            _memoryPlanned = planned;
+            _memoryNaive = naive;
+        }
+
         void GraphProfile::setBuildTime(Nd4jIndex nanos) {
             _buildTime = nanos;
         }
@@ -110,6 +120,10 @@ namespace nd4j {
             _memoryTemporary += other->_memoryTemporary;
             _memoryTotal += other->_memoryTotal;
             _memoryObjects += other->_memoryObjects;
+            _memoryMapped += other->_memoryMapped;
+            _memoryConverted += other->_memoryConverted;
+            _memoryPlanned += other->_memoryPlanned;
+            _memoryNaive += other->_memoryNaive;
 
             _executionTime += other->_executionTime;
             _buildTime += other->_buildTime;
@@ -129,6 +143,10 @@ namespace nd4j {
             _memoryTemporary = other->_memoryTemporary;
             _memoryTotal = other->_memoryTotal;
             _memoryObjects = other->_memoryObjects;
+            _memoryMapped = other->_memoryMapped;
+            _memoryConverted = other->_memoryConverted;
+            _memoryPlanned = other->_memoryPlanned;
+            _memoryNaive = other->_memoryNaive;
 
             _executionTime = other->_executionTime;
             _buildTime = other->_buildTime;
@@ -159,6 +177,8 @@ namespace nd4j {
             }
 
             nd4j_printf("ACT: %lld; TMP: %lld; OBJ: %lld; TTL: %lld;\n", act / _merges, tmp / _merges, obj / _merges, ttl / _merges);
+            nd4j_printf("Weights: %lld mapped; %lld converted;\n", _memoryMapped / _merges, _memoryConverted / _merges);
+            nd4j_printf("Outputs: %lld planned; %lld naive;\n", _memoryPlanned / _merges, _memoryNaive / _merges);
 
             nd4j_printf("\nTime:\n", "");
             nd4j_printf("Construction time: %lld ns;\n", _buildTime / _merges);
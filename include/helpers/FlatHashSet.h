@@ -0,0 +1,202 @@
+//
+// @author raver119@gmail.com
+//
+
+#ifndef LIBND4J_FLATHASHSET_H
+#define LIBND4J_FLATHASHSET_H
+
+#include <pointercast.h>
+#include <op_boilerplate.h>
+#include <Environment.h>
+#include <templatemath.h>
+#include <vector>
+#include <cstring>
+#include <omp.h>
+
+namespace nd4j {
+
+    /**
+     * This class is open-addressing hash set for float/float16/double keys, with linear probing.
+     *
+     * Each distinct key gets dense id in order of first insertion, so class also serves as hash map:
+     * values live in side arrays indexed by id, and keys() returns distinct keys in first-occurrence order.
+     * Keys are compared with operator==, so -0.0 equals 0.0, and NaNs never match anything.
+     */
+    template <typename K>
+    class FlatHashSet {
+    private:
+        // slot keeps key next to its id, so probing touches single cache line. Empty slots have id -1
+        struct Slot {
+            K key;
+            Nd4jIndex id;
+        };
+
+        std::vector<Slot> _slots;
+        std::vector<K> _keys;
+        Nd4jIndex _mask;
+
+        static FORCEINLINE uint64_t hashOf(const K key) {
+            double d = static_cast<double>(key);
+
+            // -0.0 and 0.0 should land into the same slot
+            if (d == 0.0)
+                d = 0.0;
+
+            uint64_t h;
+            memcpy(&h, &d, sizeof(h));
+
+            // splitmix64 finalizer
+            h ^= h >> 30;
+            h *= 0xbf58476d1ce4e5b9ULL;
+            h ^= h >> 27;
+            h *= 0x94d049bb133111ebULL;
+            h ^= h >> 31;
+            return h;
+        }
+
+        void grow() {
+            const Nd4jIndex capacity = (Nd4jIndex) _slots.size() * 2;
+            _slots.assign(capacity, Slot{K(), -1});
+            _mask = capacity - 1;
+
+            for (Nd4jIndex id = 0; id < (Nd4jIndex) _keys.size(); id++) {
+                Nd4jIndex slot = hashOf(_keys[id]) & _mask;
+                while (_slots[slot].id >= 0)
+                    slot = (slot + 1) & _mask;
+
+                _slots[slot] = Slot{_keys[id], id};
+            }
+        }
+
+    public:
+        explicit FlatHashSet(Nd4jIndex expected = 16) {
+            // load factor is kept at 0.5 or below
+            Nd4jIndex capacity = 16;
+            while (capacity < expected * 2)
+                capacity *= 2;
+
+            _slots.assign(capacity, Slot{K(), -1});
+            _mask = capacity - 1;
+            _keys.reserve(expected);
+        }
+
+        /**
+         * This method returns id of given key, inserting key if it wasn't seen before
+         */
+        FORCEINLINE Nd4jIndex insert(const K key) {
+            Nd4jIndex slot = hashOf(key) & _mask;
+            while (_slots[slot].id >= 0) {
+                if (_slots[slot].key == key)
+                    return _slots[slot].id;
+
+                slot = (slot + 1) & _mask;
+            }
+
+            const Nd4jIndex id = (Nd4jIndex) _keys.size();
+            _slots[slot] = Slot{key, id};
+            _keys.emplace_back(key);
+
+            if (_keys.size() * 2 > _slots.size())
+                grow();
+
+            return id;
+        }
+
+        /**
+         * This method returns id of given key, or -1 if key isn't in the set
+         */
+        FORCEINLINE Nd4jIndex indexOf(const K key) const {
+            Nd4jIndex slot = hashOf(key) & _mask;
+            while (_slots[slot].id >= 0) {
+                if (_slots[slot].key == key)
+                    return _slots[slot].id;
+
+                slot = (slot + 1) & _mask;
+            }
+
+            return -1;
+        }
+
+        FORCEINLINE bool contains(const K key) const {
+            return indexOf(key) >= 0;
+        }
+
+        FORCEINLINE Nd4jIndex size() const {
+            return (Nd4jIndex) _keys.size();
+        }
+
+        /**
+         * This method returns distinct keys, in order of their first insertion
+         */
+        FORCEINLINE const std::vector<K>& keys() const {
+            return _keys;
+        }
+
+        /**
+         * This method inserts keys in their order. If provided, counts[id] gets number of occurrences of each key,
+         * and firsts[id] gets position of its first occurrence.
+         *
+         * Long inputs are split into chunks, one per thread. Each thread builds set for its own chunk,
+         * and chunk sets are merged in chunk order, so ids still follow first-occurrence order.
+         */
+        void insertAll(const K *keys, const Nd4jIndex length, std::vector<Nd4jIndex> *counts = nullptr, std::vector<Nd4jIndex> *firsts = nullptr) {
+            const int maxThreads = length > ELEMENT_THRESHOLD ? omp_get_max_threads() : 1;
+
+            std::vector<FlatHashSet<K>> sets(maxThreads);
+            std::vector<std::vector<Nd4jIndex>> localCounts(maxThreads);
+            std::vector<std::vector<Nd4jIndex>> localFirsts(maxThreads);
+
+#pragma omp parallel num_threads(maxThreads) if (maxThreads > 1)
+            {
+                const int thread = omp_get_thread_num();
+                const Nd4jIndex span = (length + omp_get_num_threads() - 1) / omp_get_num_threads();
+                const Nd4jIndex start = nd4j::math::nd4j_min<Nd4jIndex>(length, thread * span);
+                const Nd4jIndex end = nd4j::math::nd4j_min<Nd4jIndex>(length, start + span);
+
+                auto &set = sets[thread];
+                auto &count = localCounts[thread];
+                auto &first = localFirsts[thread];
+
+                for (Nd4jIndex e = start; e < end; e++) {
+                    const Nd4jIndex id = set.insert(keys[e]);
+                    if (id == (Nd4jIndex) count.size()) {
+                        count.emplace_back(0);
+                        first.emplace_back(e);
+                    }
+
+                    count[id]++;
+                }
+            }
+
+            for (int t = 0; t < maxThreads; t++) {
+                auto &set = sets[t];
+                for (Nd4jIndex l = 0; l < set.size(); l++) {
+                    const Nd4jIndex before = size();
+                    const Nd4jIndex id = insert(set._keys[l]);
+
+                    if (id == before) {
+                        if (counts != nullptr)
+                            counts->emplace_back(0);
+
+                        if (firsts != nullptr)
+                            firsts->emplace_back(localFirsts[t][l]);
+                    }
+
+                    if (counts != nullptr)
+                        (*counts)[id] += localCounts[t][l];
+                }
+            }
+        }
+
+        /**
+         * This method writes id of each key into ids, in parallel. All keys are expected to be in the set already
+         */
+        void indicesOf(const K *keys, const Nd4jIndex length, Nd4jIndex *ids) const {
+#pragma omp parallel for if (length > ELEMENT_THRESHOLD) schedule(static)
+            for (Nd4jIndex e = 0; e < length; e++)
+                ids[e] = indexOf(keys[e]);
+        }
+    };
+}
+
+#endif //LIBND4J_FLATHASHSET_H
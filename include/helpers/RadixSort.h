@@ -0,0 +1,292 @@
+//
+// @author raver119@gmail.com
+//
+
+#ifndef LIBND4J_RADIXSORT_H
+#define LIBND4J_RADIXSORT_H
+
+#include <pointercast.h>
+#include <op_boilerplate.h>
+#include <Environment.h>
+#include <types/float16.h>
+#include <templatemath.h>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <omp.h>
+
+namespace nd4j {
+
+    /**
+     * This struct maps keys to unsigned integers of the same width, preserving order.
+     * Floats get sign-flipped bit patterns: negative values have all bits inverted, positive ones get sign bit set.
+     * That way -0.0 goes right before 0.0, and NaNs go to the ends, depending on their sign bit.
+     */
+    template <typename K>
+    struct RadixKey;
+
+    template <>
+    struct RadixKey<float> {
+        typedef uint32_t Bits;
+
+        static FORCEINLINE Bits encode(const float key) {
+            Bits bits;
+            memcpy(&bits, &key, sizeof(bits));
+            return (bits & 0x80000000U) ? ~bits : bits | 0x80000000U;
+        }
+
+        static FORCEINLINE float decode(const Bits bits) {
+            Bits raw = (bits & 0x80000000U) ? bits & 0x7FFFFFFFU : ~bits;
+            float key;
+            memcpy(&key, &raw, sizeof(key));
+            return key;
+        }
+    };
+
+    template <>
+    struct RadixKey<double> {
+        typedef uint64_t Bits;
+
+        static FORCEINLINE Bits encode(const double key) {
+            Bits bits;
+            memcpy(&bits, &key, sizeof(bits));
+            return (bits & 0x8000000000000000ULL) ? ~bits : bits | 0x8000000000000000ULL;
+        }
+
+        static FORCEINLINE double decode(const Bits bits) {
+            Bits raw = (bits & 0x8000000000000000ULL) ? bits & 0x7FFFFFFFFFFFFFFFULL : ~bits;
+            double key;
+            memcpy(&key, &raw, sizeof(key));
+            return key;
+        }
+    };
+
+    template <>
+    struct RadixKey<float16> {
+        typedef uint16_t Bits;
+
+        static FORCEINLINE Bits encode(const float16 key) {
+            Bits bits;
+            memcpy(&bits, &key, sizeof(bits));
+            return (bits & 0x8000U) ? (Bits) ~bits : (Bits) (bits | 0x8000U);
+        }
+
+        static FORCEINLINE float16 decode(const Bits bits) {
+            Bits raw = (bits & 0x8000U) ? (Bits) (bits & 0x7FFFU) : (Bits) ~bits;
+            float16 key;
+            memcpy(&key, &raw, sizeof(key));
+            return key;
+        }
+    };
+
+    template <>
+    struct RadixKey<int> {
+        typedef uint32_t Bits;
+
+        static FORCEINLINE Bits encode(const int key) {
+            return (Bits) key ^ 0x80000000U;
+        }
+
+        static FORCEINLINE int decode(const Bits bits) {
+            return (int) (bits ^ 0x80000000U);
+        }
+    };
+
+    /**
+     * This class implements LSD radix sort with 8-bit digits. Sort is stable, so it can carry values along keys,
+     * and ties keep their original order in both directions.
+     *
+     * Each pass is split between threads by chunks: every thread builds histogram of its own chunk,
+     * and then scatters chunk into its slice of each bucket. Passes where all keys share the same digit are skipped,
+     * so e.g. small integer keys take a single pass.
+     */
+    class RadixSort {
+    private:
+        static const int BUCKETS = 256;
+
+        // below this length comparison sort over encoded keys is faster than counting passes
+        static const Nd4jIndex SMALL_LENGTH = 256;
+
+        template <typename U>
+        static FORCEINLINE int digitOf(const U bits, const int pass) {
+            return (int) ((bits >> (pass * 8)) & 0xFF);
+        }
+
+        static FORCEINLINE int numThreadsFor(const Nd4jIndex length) {
+            return length > ELEMENT_THRESHOLD && !omp_in_parallel() ? omp_get_max_threads() : 1;
+        }
+
+        /**
+         * This method sorts encoded keys, permuting values (if any) along. Result is written back into bits and values
+         */
+        template <typename U, typename V>
+        static void sortBits(U *bits, V *values, const Nd4jIndex length) {
+            if (length < 2)
+                return;
+
+            if (length < SMALL_LENGTH) {
+                if (values == nullptr) {
+                    std::sort(bits, bits + length);
+                    return;
+                }
+
+                std::vector<std::pair<U, V>> pairs(length);
+                for (Nd4jIndex e = 0; e < length; e++)
+                    pairs[e] = std::make_pair(bits[e], values[e]);
+
+                std::stable_sort(pairs.begin(), pairs.end(), [](const std::pair<U, V> &a, const std::pair<U, V> &b) { return a.first < b.first; });
+
+                for (Nd4jIndex e = 0; e < length; e++) {
+                    bits[e] = pairs[e].first;
+                    values[e] = pairs[e].second;
+                }
+                return;
+            }
+
+            const int numPasses = (int) sizeof(U);
+            const int maxThreads = numThreadsFor(length);
+
+            std::vector<U> bitsTmp(length);
+            std::vector<V> valuesTmp(values == nullptr ? 0 : length);
+
+            // digits shared by all keys are known upfront, so such passes are skipped
+            std::vector<Nd4jIndex> global(numPasses * BUCKETS, 0);
+            std::vector<Nd4jIndex> histograms((size_t) maxThreads * BUCKETS);
+
+#pragma omp parallel num_threads(maxThreads) if (maxThreads > 1)
+            {
+                std::vector<Nd4jIndex> local(numPasses * BUCKETS, 0);
+
+#pragma omp for schedule(static)
+                for (Nd4jIndex e = 0; e < length; e++)
+                    for (int p = 0; p < numPasses; p++)
+                        local[p * BUCKETS + digitOf(bits[e], p)]++;
+
+#pragma omp critical
+                for (int b = 0; b < numPasses * BUCKETS; b++)
+                    global[b] += local[b];
+            }
+
+            U *src = bits;
+            U *dst = bitsTmp.data();
+            V *srcV = values;
+            V *dstV = valuesTmp.data();
+
+            for (int p = 0; p < numPasses; p++) {
+                if (global[p * BUCKETS + digitOf(bits[0], p)] == length)
+                    continue;
+
+#pragma omp parallel num_threads(maxThreads) if (maxThreads > 1)
+                {
+                    const int numThreads = omp_get_num_threads();
+                    const int thread = omp_get_thread_num();
+                    const Nd4jIndex span = (length + numThreads - 1) / numThreads;
+                    const Nd4jIndex start = nd4j::math::nd4j_min<Nd4jIndex>(length, thread * span);
+                    const Nd4jIndex end = nd4j::math::nd4j_min<Nd4jIndex>(length, start + span);
+
+                    Nd4jIndex *hist = histograms.data() + (size_t) thread * BUCKETS;
+                    std::fill(hist, hist + BUCKETS, 0);
+
+                    for (Nd4jIndex e = start; e < end; e++)
+                        hist[digitOf(src[e], p)]++;
+
+#pragma omp barrier
+#pragma omp single
+                    {
+                        // bucket by bucket, each thread gets its slice in chunk order, so pass stays stable
+                        Nd4jIndex offset = 0;
+                        for (int b = 0; b < BUCKETS; b++)
+                            for (int t = 0; t < numThreads; t++) {
+                                const Nd4jIndex count = histograms[(size_t) t * BUCKETS + b];
+                                histograms[(size_t) t * BUCKETS + b] = offset;
+                                offset += count;
+                            }
+                    }
+
+                    if (srcV != nullptr) {
+                        for (Nd4jIndex e = start; e < end; e++) {
+                            const Nd4jIndex pos = hist[digitOf(src[e], p)]++;
+                            dst[pos] = src[e];
+                            dstV[pos] = srcV[e];
+                        }
+                    } else {
+                        for (Nd4jIndex e = start; e < end; e++)
+                            dst[hist[digitOf(src[e], p)]++] = src[e];
+                    }
+                }
+
+                std::swap(src, dst);
+                std::swap(srcV, dstV);
+            }
+
+            // odd number of passes leaves result in temporary buffers
+            if (src != bits) {
+                memcpy(bits, src, length * sizeof(U));
+                if (values != nullptr)
+                    memcpy(values, srcV, length * sizeof(V));
+            }
+        }
+
+        template <typename K>
+        static void encodeAll(const K *keys, typename RadixKey<K>::Bits *bits, const Nd4jIndex length, const bool descending) {
+            // inverted bits give descending order, and ties still keep their original order
+            const typename RadixKey<K>::Bits mask = descending ? (typename RadixKey<K>::Bits) ~0ULL : 0;
+
+#pragma omp parallel for simd if (numThreadsFor(length) > 1) schedule(static)
+            for (Nd4jIndex e = 0; e < length; e++)
+                bits[e] = RadixKey<K>::encode(keys[e]) ^ mask;
+        }
+
+        template <typename K>
+        static void decodeAll(const typename RadixKey<K>::Bits *bits, K *keys, const Nd4jIndex length, const bool descending) {
+            const typename RadixKey<K>::Bits mask = descending ? (typename RadixKey<K>::Bits) ~0ULL : 0;
+
+#pragma omp parallel for simd if (numThreadsFor(length) > 1) schedule(static)
+            for (Nd4jIndex e = 0; e < length; e++)
+                keys[e] = RadixKey<K>::decode(bits[e] ^ mask);
+        }
+
+    public:
+        /**
+         * This method sorts contiguous keys in place
+         */
+        template <typename K>
+        static void sort(K *keys, const Nd4jIndex length, const bool descending) {
+            std::vector<typename RadixKey<K>::Bits> bits(length);
+
+            encodeAll(keys, bits.data(), length, descending);
+            sortBits<typename RadixKey<K>::Bits, char>(bits.data(), nullptr, length);
+            decodeAll(bits.data(), keys, length, descending);
+        }
+
+        /**
+         * This method sorts contiguous keys in place, and applies the same permutation to values
+         */
+        template <typename K, typename V>
+        static void sortByKey(K *keys, V *values, const Nd4jIndex length, const bool descending) {
+            std::vector<typename RadixKey<K>::Bits> bits(length);
+
+            encodeAll(keys, bits.data(), length, descending);
+            sortBits(bits.data(), values, length);
+            decodeAll(bits.data(), keys, length, descending);
+        }
+
+        /**
+         * This method writes into indices positions of keys in sorted order, keys themselves are left intact
+         */
+        template <typename K>
+        static void argsort(const K *keys, Nd4jIndex *indices, const Nd4jIndex length, const bool descending) {
+            std::vector<typename RadixKey<K>::Bits> bits(length);
+
+            encodeAll(keys, bits.data(), length, descending);
+
+#pragma omp parallel for simd if (numThreadsFor(length) > 1) schedule(static)
+            for (Nd4jIndex e = 0; e < length; e++)
+                indices[e] = e;
+
+            sortBits(bits.data(), indices, length);
+        }
+    };
+}
+
+#endif //LIBND4J_RADIXSORT_H
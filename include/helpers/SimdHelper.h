@@ -0,0 +1,105 @@
+//
+//  @author raver119@gmail.com
+//
+
+#ifndef LIBND4J_SIMD_HELPER_H
+#define LIBND4J_SIMD_HELPER_H
+
+#include <pointercast.h>
+#include <op_boilerplate.h>
+
+namespace nd4j {
+
+    /**
+     * Instruction sets we ship vectorized kernels for. Every level implies all lower ones.
+     */
+    enum SimdLevel {
+        SIMD_GENERIC = 0,
+        SIMD_SSE4 = 1,
+        SIMD_AVX2 = 2,
+        SIMD_AVX512 = 3,
+    };
+
+    /**
+     * Transforms with vectorized implementations. Library calls can't be vectorized by compiler,
+     * so these ops use polynomial approximations instead. Max error measured vs. long double reference
+     * on 2M random points per range, including subnormals, same for float and double:
+     *
+     * SIMD_EXP:      < 2 ULP
+     * SIMD_LOG:      < 1 ULP
+     * SIMD_TANH:     < 1.5 ULP
+     * SIMD_SIGMOID:  < 3 ULP
+     * SIMD_SOFTPLUS: same formula as nd4j::math::softplus, log(1 + exp(x)), so it loses precision
+     *                for large negative x and overflows for large positive x exactly as scalar version does
+     *
+     * inf, -inf and NaN inputs produce the same results as libm does.
+     */
+    enum SimdOp {
+        SIMD_EXP = 0,
+        SIMD_LOG = 1,
+        SIMD_TANH = 2,
+        SIMD_SIGMOID = 3,
+        SIMD_SOFTPLUS = 4,
+    };
+
+#define SIMD_NUM_LEVELS 4
+#define SIMD_NUM_OPS 5
+
+    typedef void (*SimdTransformFloat)(float *x, float *z, Nd4jIndex length);
+    typedef void (*SimdTransformDouble)(double *x, double *z, Nd4jIndex length);
+
+    /**
+     * Kernels built for one instruction set
+     */
+    struct SimdKernels {
+        SimdTransformFloat floats[SIMD_NUM_OPS];
+        SimdTransformDouble doubles[SIMD_NUM_OPS];
+    };
+
+    /**
+     * Kernels are compiled once per instruction set, and this class picks the best one supported by current CPU.
+     * So the same binary runs everywhere, without relying on -march picked at build time.
+     */
+    class SimdHelper {
+    private:
+        static SimdHelper* _instance;
+
+        int _detected;
+        int _level;
+
+        SimdKernels _kernels[SIMD_NUM_LEVELS];
+
+        SimdHelper();
+
+    public:
+        static SimdHelper* getInstance();
+
+        /**
+         * This method returns best instruction set supported by current CPU
+         */
+        int detectedLevel();
+
+        /**
+         * This method returns instruction set used for kernels
+         */
+        int level();
+
+        /**
+         * This method allows to force lower instruction set, i.e. for benchmarks or tests.
+         * Levels above detected one are ignored.
+         */
+        void setLevel(int level);
+
+        static const char* levelName(int level);
+
+        /**
+         * This method applies given op to contiguous x, and stores result to contiguous z. x and z can be the same buffer.
+         *
+         * @return false if there's no vectorized kernel for given data type, so caller should fall back to scalar loop
+         */
+        template <typename T>
+        bool transform(int op, T *x, T *z, Nd4jIndex length);
+    };
+}
+
+#endif
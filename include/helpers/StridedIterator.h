@@ -0,0 +1,142 @@
+//
+// @author raver119@gmail.com
+//
+
+#ifndef LIBND4J_STRIDEDITERATOR_H
+#define LIBND4J_STRIDEDITERATOR_H
+
+#include <op_boilerplate.h>
+#include <pointercast.h>
+#include <helpers/shape.h>
+
+namespace nd4j {
+
+    /**
+     * This class walks over strided array in logical order, and keeps offset of current element.
+     * Offset is updated incrementally, so there's no ind2sub/getOffset call per element: just one add in most cases,
+     * and carry over outer dimensions once per innermost row.
+     *
+     * Unit dimensions are dropped, and dimensions contiguous in iteration order are collapsed into one.
+     *
+     * PLEASE NOTE: 'c' order means last dimension changes fastest, 'f' order means first one does,
+     * same as shape::ind2subC and shape::ind2sub respectively
+     */
+    class StridedIterator {
+    private:
+        int _rank;
+        int _shape[MAX_RANK];
+        int _stride[MAX_RANK];
+        int _coords[MAX_RANK];
+        Nd4jIndex _offset;
+
+        FORCEINLINE void carry() {
+            _coords[_rank - 1] = 0;
+            _offset -= (Nd4jIndex) (_shape[_rank - 1] - 1) * _stride[_rank - 1];
+
+            for (int e = _rank - 2; e >= 0; e--) {
+                if (++_coords[e] < _shape[e]) {
+                    _offset += _stride[e];
+                    return;
+                }
+
+                _coords[e] = 0;
+                _offset -= (Nd4jIndex) (_shape[e] - 1) * _stride[e];
+            }
+        }
+
+    public:
+        /**
+         * @param rank rank of the array
+         * @param shape shape of the array
+         * @param stride strides of the array
+         * @param start logical index of the first element to visit, so each thread can start mid-array
+         * @param order iteration order
+         */
+        StridedIterator(int rank, int *shape, int *stride, Nd4jIndex start = 0, char order = 'c') {
+            _rank = 0;
+
+            // iteration always goes over internal dimensions in c order, so f order is just reversed dimensions
+            for (int e = 0; e < rank; e++) {
+                int d = order == 'c' ? e : rank - 1 - e;
+
+                if (shape[d] == 1)
+                    continue;
+
+                // previous dimension is contiguous with this one, so they're merged
+                if (_rank > 0 && _stride[_rank - 1] == (Nd4jIndex) shape[d] * stride[d]) {
+                    _shape[_rank - 1] *= shape[d];
+                    _stride[_rank - 1] = stride[d];
+                    continue;
+                }
+
+                _shape[_rank] = shape[d];
+                _stride[_rank] = stride[d];
+                _rank++;
+            }
+
+            // scalar or array of unit dimensions
+            if (_rank == 0) {
+                _shape[0] = 1;
+                _stride[0] = 1;
+                _rank = 1;
+            }
+
+            seek(start);
+        }
+
+        StridedIterator(int *shapeInfo, Nd4jIndex start = 0, char order = 'c') : StridedIterator(shape::rank(shapeInfo), shape::shapeOf(shapeInfo), shape::stride(shapeInfo), start, order) {
+            //
+        }
+
+        /**
+         * This method moves iterator to given logical index
+         */
+        FORCEINLINE void seek(Nd4jIndex index) {
+            _offset = 0;
+            for (int e = _rank - 1; e >= 0; e--) {
+                _coords[e] = (int) (index % _shape[e]);
+                index /= _shape[e];
+                _offset += (Nd4jIndex) _coords[e] * _stride[e];
+            }
+        }
+
+        /**
+         * This method returns offset of current element, relative to the beginning of the array
+         */
+        FORCEINLINE Nd4jIndex offset() {
+            return _offset;
+        }
+
+        /**
+         * This method moves iterator to next element
+         */
+        FORCEINLINE void next() {
+            if (++_coords[_rank - 1] < _shape[_rank - 1]) {
+                _offset += _stride[_rank - 1];
+                return;
+            }
+
+            carry();
+        }
+
+        /**
+         * This method returns number of dimensions left after collapsing. 1 means array is effectively a strided vector
+         */
+        FORCEINLINE int rank() {
+            return _rank;
+        }
+
+        /**
+         * This method returns span of logical indices processed by given thread, when length elements are split evenly among numThreads
+         */
+        static FORCEINLINE void threadSpan(Nd4jIndex length, int threadId, int numThreads, Nd4jIndex &start, Nd4jIndex &end) {
+            Nd4jIndex span = length / numThreads;
+            Nd4jIndex tail = length % numThreads;
+
+            start = threadId * span + nd4j::math::nd4j_min<Nd4jIndex>(threadId, tail);
+            end = start + span + (threadId < tail ? 1 : 0);
+        }
+    };
+}
+
+#endif //LIBND4J_STRIDEDITERATOR_H
@@ -0,0 +1,84 @@
+//
+//  @author raver119@gmail.com
+//
+
+#ifndef LIBND4J_TADCACHE_H
+#define LIBND4J_TADCACHE_H
+
+#include <list>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <pointercast.h>
+#include <dll.h>
+
+namespace nd4j {
+
+    /**
+     * This class holds TAD shapeInfo and offsets built for some shapeInfo & dimensions pair
+     */
+    class ND4J_EXPORT TadPack {
+    private:
+        int* _tadOnlyShapeInfo = nullptr;
+        Nd4jIndex* _tadOffsets = nullptr;
+        Nd4jIndex _numTads = 0;
+        int _dimensionLength = 0;
+    public:
+        TadPack(int *shapeInfo, int *dimension, int dimensionLength);
+        ~TadPack();
+
+        int* primaryShapeInfo();
+        Nd4jIndex* primaryOffsets();
+
+        Nd4jIndex numberOfTads();
+
+        /**
+         * This method returns dimensionLength after TAD normalization, 0 or less means there's nothing to iterate over
+         */
+        int dimensionLength();
+
+        Nd4jIndex memoryFootprint();
+    };
+
+    /**
+     * Process-wide LRU cache of TAD descriptors, keyed by shapeInfo contents and dimensions.
+     * Returned packs stay valid as long as caller holds shared_ptr, even if entry gets evicted meanwhile
+     */
+    class ND4J_EXPORT TadCache {
+    private:
+        static TadCache* _INSTANCE;
+
+        std::mutex _lock;
+
+        // most recently used entries go first
+        std::list<std::pair<std::string, std::shared_ptr<TadPack>>> _entries;
+        std::unordered_map<std::string, std::list<std::pair<std::string, std::shared_ptr<TadPack>>>::iterator> _map;
+
+        Nd4jIndex _maxBytes;
+        Nd4jIndex _currentBytes = 0L;
+
+        TadCache();
+        ~TadCache() = default;
+
+        void evict();
+    public:
+        static TadCache* getInstance();
+
+        std::shared_ptr<TadPack> tadForDimensions(int *shapeInfo, int *dimension, int dimensionLength);
+        std::shared_ptr<TadPack> tadForDimensions(int *shapeInfo, int dimension);
+
+        /**
+         * Cache size limit in bytes, 0 disables caching
+         */
+        void setMaxBytes(Nd4jIndex numBytes);
+        Nd4jIndex maxBytes();
+
+        Nd4jIndex currentBytes();
+        int size();
+
+        void purge();
+    };
+}
+
+#endif //LIBND4J_TADCACHE_H
@@ -0,0 +1,12 @@
+//
+// Kernels built with -mavx2 -mfma
+//
+// @author raver119@gmail.com
+//
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+
+#define SIMD_NAMESPACE avx2
+#include "simd_kernels.h"
+
+#endif
@@ -0,0 +1,8 @@
+//
+// Baseline kernels, built with default compiler flags. Used on CPUs without SSE4.1, and on non-x86 platforms
+//
+// @author raver119@gmail.com
+//
+
+#define SIMD_NAMESPACE generic
+#include "simd_kernels.h"
@@ -0,0 +1,271 @@
+//
+// Vectorized transform kernels. This file is compiled once per instruction set, see simd_*.cpp,
+// so everything here lives in SIMD_NAMESPACE to avoid mixing up kernels built for different CPUs.
+//
+// There are no library calls and no branches in element functions, so loops below are vectorized by compiler
+// for whatever instruction set current translation unit is built for.
+//
+// Polynomials are from Cephes Math Library by Stephen L. Moshier.
+//
+// PLEASE NOTE: these translation units must be built without -fassociative-math,
+// otherwise Cody-Waite range reduction gets folded back into single multiplication
+//
+// @author raver119@gmail.com
+//
+
+#ifndef SIMD_NAMESPACE
+#error "SIMD_NAMESPACE should be defined before including simd_kernels.h"
+#endif
+
+#include <helpers/SimdHelper.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace nd4j {
+    namespace simd {
+        namespace SIMD_NAMESPACE {
+
+            static FORCEINLINE float asFloat(int32_t v) {
+                float r;
+                memcpy(&r, &v, sizeof(r));
+                return r;
+            }
+
+            static FORCEINLINE int32_t asInt(float v) {
+                int32_t r;
+                memcpy(&r, &v, sizeof(r));
+                return r;
+            }
+
+            static FORCEINLINE double asDouble(int64_t v) {
+                double r;
+                memcpy(&r, &v, sizeof(r));
+                return r;
+            }
+
+            static FORCEINLINE int64_t asLong(double v) {
+                int64_t r;
+                memcpy(&r, &v, sizeof(r));
+                return r;
+            }
+
+            static FORCEINLINE float simdExp(float x) {
+                // beyond these limits result is inf or 0 anyway. NaN is clamped as well, and restored at the end
+                float c = x > -104.0f ? x : -104.0f;
+                c = c < 89.0f ? c : 89.0f;
+
+                // x = n * ln(2) + r, |r| <= ln(2) / 2. n is rounded by adding 1.5 * 2^23, which leaves it in low mantissa bits:
+                // float to int conversion would stop compiler from vectorizing the loop
+                float t = c * 1.44269504088896341f + 12582912.0f;
+                int32_t n = asInt(t) - 0x4b400000;
+                float fn = t - 12582912.0f;
+
+                float r = c - fn * 0.693359375f;
+                r = r - fn * -2.12194440e-4f;
+
+                float p = 1.9875691500E-4f;
+                p = p * r + 1.3981999507E-3f;
+                p = p * r + 8.3334519073E-3f;
+                p = p * r + 4.1665795894E-2f;
+                p = p * r + 1.6666665459E-1f;
+                p = p * r + 5.0000001201E-1f;
+                p = p * r * r + r + 1.0f;
+
+                // 2^n is applied as two factors, so both overflow and subnormal results are rounded just once
+                int32_t n1 = n / 2;
+                int32_t n2 = n - n1;
+                float e = p * asFloat((n1 + 127) << 23) * asFloat((n2 + 127) << 23);
+
+                // NaN goes through multiplication, so selection doesn't turn into a branch
+                return e * (x != x ? x : 1.0f);
+            }
+
+            static FORCEINLINE double simdExp(double x) {
+                double c = x > -746.0 ? x : -746.0;
+                c = c < 710.0 ? c : 710.0;
+
+                // same rounding trick as above, with 1.5 * 2^52
+                double t = c * 1.4426950408889634073599 + 6755399441055744.0;
+                int32_t n = (int32_t) (asLong(t) - 0x4338000000000000LL);
+                double fn = t - 6755399441055744.0;
+
+                double r = c - fn * 6.93145751953125E-1;
+                r = r - fn * 1.42860682030941723212E-6;
+
+                // exp(r) = 1 + 2 * r P(r^2) / (Q(r^2) - r P(r^2))
+                double rr = r * r;
+                double px = r * ((1.26177193074810590878E-4 * rr + 3.02994407707441961300E-2) * rr + 9.99999999999999999910E-1);
+                double qx = ((3.00198505138664455042E-6 * rr + 2.52448340349684104192E-3) * rr + 2.27265548208155028766E-1) * rr + 2.00000000000000000009E0;
+                double p = 1.0 + 2.0 * (px / (qx - px));
+
+                int32_t n1 = n / 2;
+                int32_t n2 = n - n1;
+                double e = p * asDouble(((int64_t) (n1 + 1023)) << 52) * asDouble(((int64_t) (n2 + 1023)) << 52);
+
+                return e * (x != x ? x : 1.0);
+            }
+
+            static FORCEINLINE float simdLog(float x) {
+                // subnormals are scaled into normal range first
+                bool tiny = x < 1.17549435e-38f;
+                float s = tiny ? x * 8388608.0f : x;
+
+                // x = m * 2^e, sqrt(0.5) <= m < sqrt(2)
+                int32_t bits = asInt(s);
+                int32_t e = ((bits >> 23) & 0xff) - 126 - (tiny ? 23 : 0);
+                float m = asFloat((bits & 0x007fffff) | 0x3f000000);
+
+                bool below = m < 0.707106781186547524f;
+                e = below ? e - 1 : e;
+                m = below ? m + m - 1.0f : m - 1.0f;
+
+                float fe = (float) e;
+                float z = m * m;
+
+                float y = 7.0376836292E-2f;
+                y = y * m - 1.1514610310E-1f;
+                y = y * m + 1.1676998740E-1f;
+                y = y * m - 1.2420140846E-1f;
+                y = y * m + 1.4249322787E-1f;
+                y = y * m - 1.6668057665E-1f;
+                y = y * m + 2.0000714765E-1f;
+                y = y * m - 2.4999993993E-1f;
+                y = y * m + 3.3333331174E-1f;
+                y = y * m * z;
+
+                y = y + fe * -2.12194440e-4f;
+                y = y - 0.5f * z;
+
+                float r = m + y;
+                r = r + fe * 0.693359375f;
+
+                r = x == 0.0f ? -asFloat(0x7f800000) : r;
+                r = x < 0.0f ? asFloat(0x7fc00000) : r;
+                r = x == asFloat(0x7f800000) ? x : r;
+
+                return x != x ? x : r;
+            }
+
+            static FORCEINLINE double simdLog(double x) {
+                bool tiny = x < 2.2250738585072014e-308;
+                double s = tiny ? x * 4503599627370496.0 : x;
+
+                int64_t bits = asLong(s);
+                int32_t e = (int32_t) ((bits >> 52) & 0x7ff) - 1022 - (tiny ? 52 : 0);
+                double m = asDouble((bits & 0x000fffffffffffffLL) | 0x3fe0000000000000LL);
+
+                bool below = m < 0.70710678118654752440;
+                e = below ? e - 1 : e;
+                m = below ? m + m - 1.0 : m - 1.0;
+
+                double fe = (double) e;
+                double z = m * m;
+
+                // log(1 + m) = m - m^2 / 2 + m^3 P(m) / Q(m)
+                double p = 1.01875663804580931796E-4;
+                p = p * m + 4.97494994976747001425E-1;
+                p = p * m + 4.70579119878881725854E0;
+                p = p * m + 1.44989225341610930846E1;
+                p = p * m + 1.79368678507819816313E1;
+                p = p * m + 7.70838733755885391666E0;
+
+                double q = m + 1.12873587189167450590E1;
+                q = q * m + 4.52279145837532221105E1;
+                q = q * m + 8.29875266912776603211E1;
+                q = q * m + 7.11544750618563894466E1;
+                q = q * m + 2.31251620126765340583E1;
+
+                double y = m * (z * p / q);
+                y = y - fe * 2.121944400546905827679e-4;
+                y = y - 0.5 * z;
+
+                double r = m + y;
+                r = r + fe * 0.693359375;
+
+                r = x == 0.0 ? -asDouble(0x7ff0000000000000LL) : r;
+                r = x < 0.0 ? asDouble(0x7ff8000000000000LL) : r;
+                r = x == asDouble(0x7ff0000000000000LL) ? x : r;
+
+                return x != x ? x : r;
+            }
+
+            static FORCEINLINE float simdTanh(float x) {
+                float a = x < 0.0f ? -x : x;
+
+                // tanh(x) = 1 - 2 / (exp(2x) + 1) is precise enough away from 0. beyond 20 it's just 1
+                float s = simdExp(2.0f * (a > 20.0f ? 20.0f : a));
+                float big = 1.0f - 2.0f / (s + 1.0f);
+                big = x < 0.0f ? -big : big;
+
+                float z = x * x;
+                float small = -5.70498872745E-3f;
+                small = small * z + 2.06390887954E-2f;
+                small = small * z - 5.37397155531E-2f;
+                small = small * z + 1.33314422036E-1f;
+                small = small * z - 3.33332819422E-1f;
+                small = small * z * x + x;
+
+                return a >= 0.625f ? big : small;
+            }
+
+            static FORCEINLINE double simdTanh(double x) {
+                double a = x < 0.0 ? -x : x;
+
+                double s = simdExp(2.0 * (a > 40.0 ? 40.0 : a));
+                double big = 1.0 - 2.0 / (s + 1.0);
+                big = x < 0.0 ? -big : big;
+
+                // tanh(x) = x + x^3 P(x^2) / Q(x^2)
+                double z = x * x;
+                double p = (-9.64399179425052238628E-1 * z - 9.92877231001918586564E1) * z - 1.61468768441708447952E3;
+                double q = ((z + 1.12811678491632931402E2) * z + 2.23548839060100448583E3) * z + 4.84406305325125486048E3;
+                double small = x + x * z * (p / q);
+
+                return a >= 0.625 ? big : small;
+            }
+
+            template <typename T>
+            static FORCEINLINE T simdSigmoid(T x) {
+                // exp is taken of negative argument only, so it never overflows and tail isn't flushed to 0
+                T e = simdExp(x < (T) 0.0f ? x : -x);
+                T r = (T) 1.0f / ((T) 1.0f + e);
+                return x < (T) 0.0f ? e * r : r;
+            }
+
+            template <typename T>
+            static FORCEINLINE T simdSoftPlus(T x) {
+                return simdLog((T) 1.0f + simdExp(x));
+            }
+
+#define SIMD_KERNEL(NAME, FUNC) \
+            template <typename T> \
+            static void NAME(T *x, T *z, Nd4jIndex length) { \
+                _Pragma("omp simd") \
+                for (Nd4jIndex i = 0; i < length; i++) \
+                    z[i] = FUNC(x[i]); \
+            }
+
+            SIMD_KERNEL(expKernel, simdExp)
+            SIMD_KERNEL(logKernel, simdLog)
+            SIMD_KERNEL(tanhKernel, simdTanh)
+            SIMD_KERNEL(sigmoidKernel, simdSigmoid<T>)
+            SIMD_KERNEL(softPlusKernel, simdSoftPlus<T>)
+
+#undef SIMD_KERNEL
+
+            void registerKernels(SimdKernels &kernels) {
+                kernels.floats[SIMD_EXP] = expKernel<float>;
+                kernels.floats[SIMD_LOG] = logKernel<float>;
+                kernels.floats[SIMD_TANH] = tanhKernel<float>;
+                kernels.floats[SIMD_SIGMOID] = sigmoidKernel<float>;
+                kernels.floats[SIMD_SOFTPLUS] = softPlusKernel<float>;
+
+                kernels.doubles[SIMD_EXP] = expKernel<double>;
+                kernels.doubles[SIMD_LOG] = logKernel<double>;
+                kernels.doubles[SIMD_TANH] = tanhKernel<double>;
+                kernels.doubles[SIMD_SIGMOID] = sigmoidKernel<double>;
+                kernels.doubles[SIMD_SOFTPLUS] = softPlusKernel<double>;
+            }
+        }
+    }
+}
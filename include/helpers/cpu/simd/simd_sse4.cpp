@@ -0,0 +1,12 @@
+//
+// Kernels built with -msse4.1 -msse4.2
+//
+// @author raver119@gmail.com
+//
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+
+#define SIMD_NAMESPACE sse4
+#include "simd_kernels.h"
+
+#endif
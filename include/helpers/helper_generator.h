@@ -7,6 +7,7 @@
 
 #include <pointercast.h>
 #include <dll.h>
+#include <helpers/helper_philox.h>
 
 #ifdef _MSC_VER
 // include for uint64_t on MSVC
@@ -71,6 +72,7 @@ namespace nd4j {
             Nd4jIndex currentPosition;
             Nd4jIndex amplifier;
             unsigned int synchronizer;
+            uint64_t key;
 
 #ifdef __CUDACC__
             curandGenerator_t gen;
@@ -78,7 +80,10 @@ namespace nd4j {
 
         public:
             /**
-             * This method allocates buffer of size * sizeof(Nd4jIndex)
+             * Random values are produced by counter-based Philox generator: element at position X is computed
+             * from seed and offset + X, so nothing is pre-generated, and stream never wraps around.
+             *
+             * Buffer is kept for compatibility only, it's not read while generating values.
              *
              * @param size
              * @return
@@ -95,6 +100,7 @@ namespace nd4j {
                 this->amplifier = seed;
                 this->synchronizer = 0;
                 this->devBuffer = devBuffer;
+                this->key = mixKey(seed, seed);
 
                 cudaMalloc(&devHolder, sizeof(nd4j::random::RandomBuffer));
             }
@@ -126,6 +132,7 @@ namespace nd4j {
                 this->amplifier = seed;
                 this->synchronizer = 0;
                 this->devBuffer = buffer;
+                this->key = mixKey(seed, seed);
             }
 
 #ifdef __CUDACC__
@@ -177,6 +184,7 @@ namespace nd4j {
             void setSeed(Nd4jIndex seed) {
                 this->seed = seed;
                 this->amplifier = seed;
+                this->key = mixKey(seed, seed);
             }
 
 #ifdef __CUDACC__
@@ -205,61 +213,14 @@ namespace nd4j {
 #endif
             void reSeed(Nd4jIndex amplifier) {
                 this->amplifier = amplifier;
-            }
-
-#ifdef __CUDACC__
-            __device__
-#endif
-            inline uint64_t getElement(Nd4jIndex position) {
-
-                Nd4jIndex actualPosition = this->getOffset() + position;
-                Nd4jIndex tempGen = generation;
-                if (actualPosition >= this->size) {
-                    tempGen += actualPosition / this->size;
-                    actualPosition = actualPosition % this->size;
-                }
-#ifdef __CUDACC__
-                __syncthreads();
-
-//                int *intBuffer = (int *) devBuffer;
-
-                uint64_t ret = (uint64_t) devBuffer[actualPosition];
-#else
-                uint64_t ret = (uint64_t) buffer[actualPosition];
-#endif
-
-                if (tempGen != generation)
-                    ret = safeShift(ret, tempGen);
-
-                if(generation > 1)
-                    ret = safeShift(ret, generation);
-
-                if (amplifier != seed)
-                    ret = safeShift(ret, amplifier);
-
-#ifdef __CUDACC__
-                __syncthreads();
-#endif
-                if (amplifier != seed || generation > 1 || tempGen != generation)
-                    ret = next64(seedConv((Nd4jIndex) ret));
-
-
-                return ret;
+                this->key = mixKey(seed, amplifier);
             }
 
 #ifdef __CUDACC__
             __host__ __device__
 #endif
-            uint64_t next64(uint64_t shiftedSeed) {
-                const uint64_t s0 = (uint64_t) shiftedSeed;
-                uint64_t s1 = (uint64_t) shiftedSeed % MAX_INT + 11;
-                uint64_t r0, r1;
-
-                s1 ^= s0;
-                r0 = rotl(s0, 55) ^ s1 ^ (s1 << 14); // a, b
-                r1 = rotl(s1, 36); // c
-
-                return r0 + r1;
+            inline uint64_t getElement(Nd4jIndex position, unsigned int stream = 0) {
+                return Philox::element(key, stream, (uint64_t) (this->getOffset() + position));
             }
 
 #ifdef __CUDACC__
@@ -269,15 +230,6 @@ namespace nd4j {
                 return (x << k) | (x >> (64 - k));
             }
 
-#ifdef __CUDACC__
-            __host__ __device__
-#endif
-            uint64_t static inline safeShift(uint64_t x, uint64_t y) {
-                if (y != 0 && x > MAX_UINT / y) {
-                    return x / y + 11;
-                } else return (x * y) + 11;
-            }
-
 #ifdef __CUDACC__
             __host__ __device__
 #endif
@@ -289,6 +241,16 @@ namespace nd4j {
                 return z ^ (z >> 31);
             }
 
+            /**
+             * Philox key depends on both seed and amplifier, so reSeed() gives different stream without touching offset
+             */
+#ifdef __CUDACC__
+            __host__ __device__
+#endif
+            uint64_t mixKey(Nd4jIndex seed, Nd4jIndex amplifier) {
+                return seedConv(seed) ^ rotl(seedConv(amplifier), 29);
+            }
+
 #ifdef __CUDACC__
             __host__ __device__
 #endif
@@ -300,22 +262,14 @@ namespace nd4j {
             __host__ __device__
 #endif
             Nd4jIndex getNextIndex() {
-                currentPosition++;
-                if (currentPosition >= size) {
-                    currentPosition = 0;
-                    generation++;
-                }
-                Nd4jIndex ret = currentPosition;
-
-                return ret;
+                return ++currentPosition;
             }
 
 #ifdef __CUDACC__
             __host__ __device__
 #endif
             uint64_t getNextElement() {
-                // TODO: proper implementation needed here
-                return generation == 1 ? buffer[getNextIndex()] : buffer[getNextIndex()]  * generation;
+                return Philox::element(key, 0, (uint64_t) getNextIndex());
             }
 
 
@@ -341,13 +295,6 @@ namespace nd4j {
 					        synchronizer = 0;
 
 					        Nd4jIndex newPos = this->getOffset() + numberOfElements;
-                            if (newPos > this->getSize()) {
-                                generation += newPos / this->size;
-                                newPos = newPos % this->size;
-                            } else if (newPos == this->getSize()) {
-                                newPos = 0;
-                                generation++;
-                            }
 
                             this->setOffset(newPos);
 					    }
@@ -355,13 +302,6 @@ namespace nd4j {
                 } else {
                     if (threadIdx.x == 0) {
                         Nd4jIndex newPos = this->getOffset() + numberOfElements;
-                        if (newPos > this->getSize()) {
-                            generation += newPos / this->size;
-                            newPos = newPos % this->size;
-                        } else if (newPos == this->getSize()) {
-                            generation++;
-                            newPos = 0;
-                        }
 
                         this->setOffset(newPos);
                     }
@@ -369,17 +309,7 @@ namespace nd4j {
             }
 #endif
             void rewindH(Nd4jIndex numberOfElements) {
-                Nd4jIndex newPos = this->getOffset() + numberOfElements;
-                if (newPos > this->getSize()) {
-                    generation += newPos / this->size;
-                    newPos = newPos % this->size;
-                }
-                else if (newPos == this->getSize()) {
-                    generation++;
-                    newPos = 0;
-                }
-
-                this->setOffset(newPos);
+                this->setOffset(this->getOffset() + numberOfElements);
             }
 
 
@@ -463,7 +393,7 @@ namespace nd4j {
             __device__
 #endif
             T nextT() {
-                return (T) nextUInt() / (T) MAX_UINT;
+                return toUnit<T>(nextUInt());
             }
 
             /**
@@ -504,6 +434,17 @@ namespace nd4j {
                 return getElement(index);
             }
 
+            /**
+             * This method returns element from one of secondary streams, which never overlap with main one.
+             * It's meant for ops that might need more than one value per element, i.e. rejection sampling
+             */
+#ifdef __CUDACC__
+            __device__
+#endif
+            inline uint64_t relativeUInt(Nd4jIndex index, unsigned int stream) {
+                return getElement(index, stream);
+            }
+
             /**
              *  relative methods are made as workaround for lock-free concurrent execution
              */
@@ -570,10 +511,27 @@ namespace nd4j {
     __device__
 #endif
             T relativeT(Nd4jIndex index) {
-                if (sizeof(T) < 4) {
-                    // FIXME: this is fast hack for short types, like fp16. This should be improved.
-                    return (T)((float) relativeUInt(index) / (float) MAX_UINT);
-                } else return (T) relativeUInt(index) / (T) MAX_UINT;
+                return toUnit<T>(relativeUInt(index));
+            }
+
+            /**
+             * This method maps 64 random bits to T within [0..1): only as many top bits are used as fit into mantissa,
+             * so result is uniform and never rounds up to 1.0
+             *
+             * Bits are converted through 32-bit ints, since there's no vector conversion for 64-bit ones on most cpus
+             */
+            template <typename T>
+#ifdef __CUDACC__
+            __host__ __device__
+#endif
+            static inline T toUnit(uint64_t bits) {
+                if (sizeof(T) < 4)
+                    return (T) ((float) (int) (bits >> 53) * 4.8828125e-4f);
+
+                if (sizeof(T) < 8)
+                    return (T) ((float) (int) (bits >> 40) * 5.9604644775390625e-8f);
+
+                return (T) (((double) (int) (bits >> 38) * 134217728.0 + (double) (int) ((bits >> 11) & 0x7FFFFFF)) * 1.1102230246251565e-16);
             }
 
 /**
@@ -611,6 +569,23 @@ namespace nd4j {
                 return from + (relativeT<T>(index) * (to - from));
             }
 
+/**
+ * This method returns random T within [from..to], taken from given secondary stream
+ *
+ * @param index
+ * @param stream
+ * @param from
+ * @param to
+ * @return
+ */
+            template<typename T>
+#ifdef __CUDACC__
+            __device__
+#endif
+            T relativeT(Nd4jIndex index, unsigned int stream, T from, T to) {
+                return from + (toUnit<T>(relativeUInt(index, stream)) * (to - from));
+            }
+
         };
 
         class ND4J_EXPORT IGenerator {
@@ -0,0 +1,102 @@
+//
+// @author raver119@gmail.com
+//
+
+#ifndef LIBND4J_HELPER_PHILOX_H
+#define LIBND4J_HELPER_PHILOX_H
+
+#include <pointercast.h>
+#include <dll.h>
+
+#ifdef __GNUC__
+#include <inttypes.h>
+#else
+#include <stdint.h>
+#endif
+
+namespace nd4j {
+    namespace random {
+
+        /**
+         * This class implements Philox4x32-10 counter-based generator, as described in
+         * "Parallel Random Numbers: As Easy as 1, 2, 3" by Salmon et al.
+         *
+         * Each 128-bit counter is mapped to 128 random bits under 64-bit key, without any state,
+         * so any element of the stream can be computed on its own: threads don't have to share anything,
+         * and the same counter always gives the same bits, no matter how work was split.
+         *
+         * Rounds are plain 32-bit multiplications and xors, so loops over counters vectorize.
+         */
+        class ND4J_EXPORT Philox {
+        private:
+            static const uint32_t M0 = 0xD2511F53U;
+            static const uint32_t M1 = 0xCD9E8D57U;
+            static const uint32_t W0 = 0x9E3779B9U;
+            static const uint32_t W1 = 0xBB67AE85U;
+
+#ifdef __CUDACC__
+            __host__ __device__
+#endif
+            static inline void singleRound(uint32_t &c0, uint32_t &c1, uint32_t &c2, uint32_t &c3, const uint32_t k0, const uint32_t k1) {
+                const uint64_t p0 = (uint64_t) M0 * c0;
+                const uint64_t p1 = (uint64_t) M1 * c2;
+
+                const uint32_t r0 = (uint32_t) (p1 >> 32) ^ c1 ^ k0;
+                const uint32_t r2 = (uint32_t) (p0 >> 32) ^ c3 ^ k1;
+
+                c1 = (uint32_t) p1;
+                c3 = (uint32_t) p0;
+                c0 = r0;
+                c2 = r2;
+            }
+
+        public:
+            /**
+             * This method applies 10 rounds of Philox4x32 to counter, in place
+             *
+             * @param c0..c3 counter words, replaced with random bits
+             * @param key
+             */
+#ifdef __CUDACC__
+            __host__ __device__
+#endif
+            static inline void bijection(uint32_t &c0, uint32_t &c1, uint32_t &c2, uint32_t &c3, const uint64_t key) {
+                uint32_t k0 = (uint32_t) key;
+                uint32_t k1 = (uint32_t) (key >> 32);
+
+                for (int r = 0; r < 10; r++) {
+                    singleRound(c0, c1, c2, c3, k0, k1);
+                    k0 += W0;
+                    k1 += W1;
+                }
+            }
+
+            /**
+             * This method returns 64 random bits for given position within given stream.
+             * Every counter gives two consecutive elements: even positions get its lower half, odd positions - upper one
+             *
+             * @param key
+             * @param stream
+             * @param index
+             * @return
+             */
+#ifdef __CUDACC__
+            __host__ __device__
+#endif
+            static inline uint64_t element(const uint64_t key, const uint32_t stream, const uint64_t index) {
+                const uint64_t block = index >> 1;
+
+                uint32_t c0 = (uint32_t) block;
+                uint32_t c1 = (uint32_t) (block >> 32);
+                uint32_t c2 = stream;
+                uint32_t c3 = 0;
+
+                bijection(c0, c1, c2, c3, key);
+
+                return (index & 1) ? ((uint64_t) c3 << 32) | c2 : ((uint64_t) c1 << 32) | c0;
+            }
+        };
+    }
+}
+
+#endif //LIBND4J_HELPER_PHILOX_H
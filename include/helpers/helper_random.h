@@ -129,7 +129,7 @@ namespace nd4j {
             __device__
 #endif
             T nextT() {
-                return (T) nextUInt() / (T) MAX_UINT;
+                return nd4j::random::RandomBuffer::toUnit<T>(nextUInt());
             }
 
             /**
@@ -222,10 +222,7 @@ namespace nd4j {
             __device__
 #endif
             inline T relativeT(Nd4jIndex index) {
-                if (sizeof(T) < 4) {
-                    // FIXME: this is fast hack for short types, like fp16. This should be improved.
-                    return (T)((float) relativeUInt(index) / (float) MAX_UINT);
-                } else return (T) relativeUInt(index) / (T) MAX_UINT;
+                return nd4j::random::RandomBuffer::toUnit<T>(relativeUInt(index));
             }
 
             /**
@@ -0,0 +1,123 @@
+//
+//  @author raver119@gmail.com
+//
+
+#include <helpers/SimdHelper.h>
+#include <helpers/logger.h>
+#include <types/float16.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define SIMD_X86
+#endif
+
+namespace nd4j {
+    namespace simd {
+        namespace generic {
+            void registerKernels(SimdKernels &kernels);
+        }
+
+#ifdef SIMD_X86
+        namespace sse4 {
+            void registerKernels(SimdKernels &kernels);
+        }
+
+        namespace avx2 {
+            void registerKernels(SimdKernels &kernels);
+        }
+
+        namespace avx512 {
+            void registerKernels(SimdKernels &kernels);
+        }
+#endif
+    }
+
+    static int detectSimdLevel() {
+#if defined(SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+        __builtin_cpu_init();
+
+        // avx512 kernels are built with -mavx512dq as well, and some avx512f cpus (i.e. KNL) don't have it
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq"))
+            return SIMD_AVX512;
+
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+            return SIMD_AVX2;
+
+        if (__builtin_cpu_supports("sse4.2"))
+            return SIMD_SSE4;
+#endif
+        return SIMD_GENERIC;
+    }
+
+    SimdHelper::SimdHelper() {
+        simd::generic::registerKernels(_kernels[SIMD_GENERIC]);
+
+#ifdef SIMD_X86
+        simd::sse4::registerKernels(_kernels[SIMD_SSE4]);
+        simd::avx2::registerKernels(_kernels[SIMD_AVX2]);
+        simd::avx512::registerKernels(_kernels[SIMD_AVX512]);
+
+        _detected = detectSimdLevel();
+#else
+        _detected = SIMD_GENERIC;
+#endif
+        _level = _detected;
+
+        nd4j_debug("Using %s kernels for vectorized transforms\n", levelName(_level));
+    }
+
+    SimdHelper* SimdHelper::getInstance() {
+        if (_instance == 0)
+            _instance = new SimdHelper();
+
+        return _instance;
+    }
+
+    int SimdHelper::detectedLevel() {
+        return _detected;
+    }
+
+    int SimdHelper::level() {
+        return _level;
+    }
+
+    void SimdHelper::setLevel(int level) {
+        if (level < SIMD_GENERIC || level > _detected) {
+            nd4j_printf("SIMD level [%i] isn't supported by this CPU, keeping [%s]\n", level, levelName(_level));
+            return;
+        }
+
+        _level = level;
+    }
+
+    const char* SimdHelper::levelName(int level) {
+        switch (level) {
+            case SIMD_SSE4:
+                return "SSE4";
+            case SIMD_AVX2:
+                return "AVX2";
+            case SIMD_AVX512:
+                return "AVX-512";
+            default:
+                return "generic";
+        }
+    }
+
+    template <>
+    bool SimdHelper::transform<float>(int op, float *x, float *z, Nd4jIndex length) {
+        _kernels[_level].floats[op](x, z, length);
+        return true;
+    }
+
+    template <>
+    bool SimdHelper::transform<double>(int op, double *x, double *z, Nd4jIndex length) {
+        _kernels[_level].doubles[op](x, z, length);
+        return true;
+    }
+
+    template <>
+    bool SimdHelper::transform<float16>(int op, float16 *x, float16 *z, Nd4jIndex length) {
+        return false;
+    }
+
+    SimdHelper* SimdHelper::_instance = 0;
+}
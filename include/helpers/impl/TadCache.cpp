@@ -0,0 +1,164 @@
+//
+//  @author raver119@gmail.com
+//
+
+#include <helpers/TadCache.h>
+#include <helpers/TAD.h>
+#include <helpers/shape.h>
+#include <Environment.h>
+#include <cstring>
+
+// default cache limit, 64MB
+#define TAD_CACHE_SIZE 67108864L
+
+namespace nd4j {
+
+    TadPack::TadPack(int *shapeInfo, int *dimension, int dimensionLength) {
+        shape::TAD tad(shapeInfo, dimension, dimensionLength);
+        tad.createTadOnlyShapeInfo();
+        tad.createOffsets();
+
+        _dimensionLength = tad.dimensionLength;
+        _numTads = tad.numTads;
+
+        if (tad.tadOnlyShapeInfo == nullptr || tad.tadOffsets == nullptr) {
+            _numTads = 0;
+            return;
+        }
+
+        // TAD might point into original shapeInfo, so we always keep our own copies
+        int shapeLength = shape::shapeInfoLength(shape::rank(tad.tadOnlyShapeInfo));
+        _tadOnlyShapeInfo = new int[shapeLength];
+        memcpy(_tadOnlyShapeInfo, tad.tadOnlyShapeInfo, shapeLength * sizeof(int));
+
+        _tadOffsets = new Nd4jIndex[_numTads];
+        memcpy(_tadOffsets, tad.tadOffsets, _numTads * sizeof(Nd4jIndex));
+    }
+
+    TadPack::~TadPack() {
+        delete[] _tadOnlyShapeInfo;
+        delete[] _tadOffsets;
+    }
+
+    int* TadPack::primaryShapeInfo() {
+        return _tadOnlyShapeInfo;
+    }
+
+    Nd4jIndex* TadPack::primaryOffsets() {
+        return _tadOffsets;
+    }
+
+    Nd4jIndex TadPack::numberOfTads() {
+        return _numTads;
+    }
+
+    int TadPack::dimensionLength() {
+        return _dimensionLength;
+    }
+
+    Nd4jIndex TadPack::memoryFootprint() {
+        if (_tadOnlyShapeInfo == nullptr)
+            return 0L;
+
+        return shape::shapeInfoByteLength(_tadOnlyShapeInfo) + _numTads * sizeof(Nd4jIndex);
+    }
+
+    TadCache::TadCache() {
+        _maxBytes = TAD_CACHE_SIZE;
+    }
+
+    TadCache* TadCache::getInstance() {
+        if (_INSTANCE == 0)
+            _INSTANCE = new TadCache();
+
+        return _INSTANCE;
+    }
+
+    std::shared_ptr<TadPack> TadCache::tadForDimensions(int *shapeInfo, int dimension) {
+        return tadForDimensions(shapeInfo, &dimension, 1);
+    }
+
+    std::shared_ptr<TadPack> TadCache::tadForDimensions(int *shapeInfo, int *dimension, int dimensionLength) {
+        // key is raw shapeInfo contents followed by dimensions
+        int shapeLength = shape::shapeInfoLength(shape::rank(shapeInfo));
+        std::string key(reinterpret_cast<char *>(shapeInfo), shapeLength * sizeof(int));
+        key.append(reinterpret_cast<char *>(dimension), dimensionLength * sizeof(int));
+
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+
+            auto it = _map.find(key);
+            if (it != _map.end()) {
+                _entries.splice(_entries.begin(), _entries, it->second);
+                Environment::getInstance()->countTadCacheHit();
+
+                return it->second->second;
+            }
+        }
+
+        Environment::getInstance()->countTadCacheMiss();
+
+        // TAD is built outside of lock, concurrent misses for the same key just race to insert
+        auto pack = std::make_shared<TadPack>(shapeInfo, dimension, dimensionLength);
+
+        std::lock_guard<std::mutex> lock(_lock);
+        if (_maxBytes <= 0 || _map.count(key) > 0)
+            return pack;
+
+        _entries.emplace_front(key, pack);
+        _map[key] = _entries.begin();
+        _currentBytes += pack->memoryFootprint() + key.size();
+
+        evict();
+
+        return pack;
+    }
+
+    void TadCache::evict() {
+        // most recent entry is never evicted, so oversized pack still serves the caller
+        while (_currentBytes > _maxBytes && _entries.size() > 1) {
+            auto &last = _entries.back();
+            _currentBytes -= last.second->memoryFootprint() + last.first.size();
+            _map.erase(last.first);
+            _entries.pop_back();
+        }
+    }
+
+    void TadCache::setMaxBytes(Nd4jIndex numBytes) {
+        std::lock_guard<std::mutex> lock(_lock);
+
+        _maxBytes = numBytes;
+        if (_maxBytes <= 0) {
+            _entries.clear();
+            _map.clear();
+            _currentBytes = 0L;
+        } else
+            evict();
+    }
+
+    Nd4jIndex TadCache::maxBytes() {
+        return _maxBytes;
+    }
+
+    Nd4jIndex TadCache::currentBytes() {
+        std::lock_guard<std::mutex> lock(_lock);
+
+        return _currentBytes;
+    }
+
+    int TadCache::size() {
+        std::lock_guard<std::mutex> lock(_lock);
+
+        return (int) _entries.size();
+    }
+
+    void TadCache::purge() {
+        std::lock_guard<std::mutex> lock(_lock);
+
+        _entries.clear();
+        _map.clear();
+        _currentBytes = 0L;
+    }
+
+    nd4j::TadCache* nd4j::TadCache::_INSTANCE = 0;
+}
@@ -7,6 +7,18 @@
 
 #include <loops/type_conversions.h>
 
+/*
+ * Threshold encoding is done in 3 phases, on both backends:
+ *
+ * P1: per-block counts of elements with abs(x) >= threshold. z[0] holds total count, z[b + 1] holds count for block b
+ * P2: exclusive prefix sum over per-block counts, which gives offset of each block within encoded buffer
+ * P3: each block writes signed 1-based indices at its offset, and residual x -= sign(x) * threshold is kept in place
+ *
+ * Encoded buffer layout: [limit, length, threshold as float bits, reserved, indices...]
+ */
+#define THRESHOLD_BLOCK_SIZE 1024
+
+#ifdef __CUDACC__
 
 void prescanArrayRecursive(Nd4jPointer *extras, int *z, int *x, int numElements, int level) {
 
@@ -93,6 +105,127 @@ void prescanArrayRecursive(Nd4jPointer *extras, int *z, int *x, int numElements,
     }
 }
 
+#else
+
+#include <vector>
+#include <omp.h>
+
+template <typename T>
+void cpuEncodeThresholdP1Generic(T *dx, Nd4jIndex N, int *dz, float threshold) {
+    Nd4jIndex numBlocks = N / THRESHOLD_BLOCK_SIZE + (N % THRESHOLD_BLOCK_SIZE ? 1 : 0);
+    int total = 0;
+
+#pragma omp parallel for schedule(static) reduction(+:total) if(numBlocks > 1)
+    for (Nd4jIndex b = 0; b < numBlocks; b++) {
+        Nd4jIndex start = b * THRESHOLD_BLOCK_SIZE;
+        Nd4jIndex stop = nd4j::math::nd4j_min<Nd4jIndex>(start + THRESHOLD_BLOCK_SIZE, N);
+        int cnt = 0;
+
+#pragma omp simd reduction(+:cnt)
+        for (Nd4jIndex e = start; e < stop; e++)
+            cnt += nd4j::math::nd4j_abs<T>(dx[e]) >= (T) threshold ? 1 : 0;
+
+        dz[b + 1] = cnt;
+        total += cnt;
+    }
+
+    dz[0] = total;
+}
+
+/*
+ * Exclusive prefix sum: dz[b] = sum(dx[0 .. b-1]). Each thread scans its own chunk, and chunk sums are scanned serially.
+ */
+inline void cpuPrefixSum(int *dx, Nd4jIndex N, int *dz) {
+    if (N <= 0)
+        return;
+
+    int numThreads = N > 32768 ? omp_get_max_threads() : 1;
+    Nd4jIndex chunk = N / numThreads + (N % numThreads ? 1 : 0);
+    std::vector<int> sums(numThreads + 1, 0);
+
+#pragma omp parallel num_threads(numThreads)
+    {
+        int t = omp_get_thread_num();
+        Nd4jIndex start = t * chunk;
+        Nd4jIndex stop = nd4j::math::nd4j_min<Nd4jIndex>(start + chunk, N);
+
+        int running = 0;
+        for (Nd4jIndex e = start; e < stop; e++) {
+            int v = dx[e];
+            dz[e] = running;
+            running += v;
+        }
+        sums[t + 1] = running;
+
+#pragma omp barrier
+#pragma omp single
+        for (int i = 1; i <= numThreads; i++)
+            sums[i] += sums[i - 1];
+
+        int base = sums[t];
+        if (base != 0)
+            for (Nd4jIndex e = start; e < stop; e++)
+                dz[e] += base;
+    }
+}
+
+template <typename T>
+void cpuEncodeThresholdP3Generic(T *dx, int *offsets, Nd4jIndex N, int *dz) {
+    FloatBits fb;
+    int limit = dz[0];
+    fb.i_ = dz[2];
+    float threshold = fb.f_;
+
+    Nd4jIndex numBlocks = N / THRESHOLD_BLOCK_SIZE + (N % THRESHOLD_BLOCK_SIZE ? 1 : 0);
+
+#pragma omp parallel for schedule(static) if(numBlocks > 1)
+    for (Nd4jIndex b = 0; b < numBlocks; b++) {
+        int idx = offsets[b];
+
+        // blocks are laid out in order, so once we're past limit, the rest of this block won't fit either
+        if (idx >= limit)
+            continue;
+
+        Nd4jIndex start = b * THRESHOLD_BLOCK_SIZE;
+        Nd4jIndex stop = nd4j::math::nd4j_min<Nd4jIndex>(start + THRESHOLD_BLOCK_SIZE, N);
+
+        for (Nd4jIndex e = start; e < stop && idx < limit; e++) {
+            T value = dx[e];
+            if (nd4j::math::nd4j_abs<T>(value) >= (T) threshold) {
+                if (value > (T) 0.0f) {
+                    dz[idx + 4] = (int) (e + 1);
+                    dx[e] = value - (T) threshold;
+                } else {
+                    dz[idx + 4] = (int) -(e + 1);
+                    dx[e] = value + (T) threshold;
+                }
+                idx++;
+            }
+        }
+    }
+}
+
+/*
+ * PLEASE NOTE: encoded indices are unique, so decoding is race-free. dz is accumulated into, same as on CUDA
+ */
+template <typename T>
+void cpuDecodeThresholdGeneric(void *dx, Nd4jIndex N, T *dz) {
+    FloatBits fb;
+    int *x = reinterpret_cast<int *>(dx);
+    int limit = x[0];
+    fb.i_ = x[2];
+    float threshold = fb.f_;
+
+#pragma omp parallel for schedule(static) if(limit > 8192)
+    for (int e = 0; e < limit; e++) {
+        int el = x[e + 4];
+        int ael = nd4j::math::nd4j_abs<int>(el) - 1;
+        dz[ael] += el > 0 ? (T) threshold : (T) -threshold;
+    }
+}
+
+#endif
+
 
 
 
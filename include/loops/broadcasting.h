@@ -25,6 +25,8 @@
 #endif
 
 #include <helpers/TAD.h>
+#include <helpers/TadCache.h>
+#include <helpers/StridedIterator.h>
 
 #include "legacy_ops.h"
 
@@ -218,15 +220,13 @@ namespace functions {
                 //permuted version of the x shape info for setting up the tad problem
                 int *tadShapeShapeInfo = tadShapeInfo;
                 Nd4jIndex *tadOffsets = tadOffset;
-                shape::TAD *tad = nullptr;
+                std::shared_ptr<nd4j::TadPack> tadPack;
 
                 if (tadShapeInfo == nullptr || tadOffsets == nullptr) {
-                    tad = new shape::TAD(xShapeInfo, dimension, dimensionLength);
-                    tad->createTadOnlyShapeInfo();
-                    tad->createOffsets();
+                    tadPack = nd4j::TadCache::getInstance()->tadForDimensions(xShapeInfo, dimension, dimensionLength);
 
-                    tadShapeShapeInfo = tad->tadOnlyShapeInfo;
-                    tadOffsets = tad->tadOffsets;
+                    tadShapeShapeInfo = tadPack->primaryShapeInfo();
+                    tadOffsets = tadPack->primaryOffsets();
                 }
 
                 //int *resultStride = shape::stride(tadShapeShapeInfo);
@@ -270,50 +270,22 @@ namespace functions {
                         }
                     }
                     else {
-                        int *zShape = shape::shapeOf(tadShapeInfoZ);
-                        int *zStride = shape::stride(tadShapeInfoZ);
-                        int zRank = shape::rank(tadShapeInfoZ);
+                        // y is walked in the same order as x TAD
+                        char xOrder = shape::order(tadShapeShapeInfo);
 
-                        int *xShape = shape::shapeOf(tadShapeShapeInfo);
-                        int *xStride = shape::stride(tadShapeShapeInfo);
-                        int xRank = shape::rank(tadShapeShapeInfo);
+                        nd4j::StridedIterator xIter(tadShapeShapeInfo, 0, xOrder);
+                        nd4j::StridedIterator yIter(yShapeInfo, 0, xOrder);
+                        nd4j::StridedIterator zIter(tadShapeInfoZ, 0, shape::order(tadShapeInfoZ));
 
-                        int *yShape = shape::shapeOf(yShapeInfo);
-                        int *yStride = shape::stride(yShapeInfo);
-                        int yRank = shape::rank(yShapeInfo);
-
-                        int xCoord[MAX_RANK];
-                        int yCoord[MAX_RANK];
-                        int zCoord[MAX_RANK];
-
-
-// TODO: cover this codebranch with tests
-// all this stuff already happens within thread
                         for (int f = 0; f < tadLength; f++) {
-                            if (shape::order(tadShapeShapeInfo) == 'c') {
-                                shape::ind2subC(xRank, xShape, f, xCoord);
-                                shape::ind2subC(yRank, yShape, f, yCoord);
-                            } else {
-                                shape::ind2sub(xRank, xShape, f, xCoord);
-                                shape::ind2sub(yRank, yShape, f, yCoord);
-                            }
+                            result[offsetZ + zIter.offset()] = OpType::op(x[offset + xIter.offset()], y[yIter.offset()]);
 
-                            if (shape::order(tadShapeInfoZ) == 'c')
-                                shape::ind2subC(zRank, zShape, f, zCoord);
-                            else
-                                shape::ind2sub(zRank, zShape, f, zCoord);
-
-                            Nd4jIndex xOffset = shape::getOffset(offset, xShape, xStride, xCoord, xRank);
-                            Nd4jIndex zOffset = shape::getOffset(offsetZ, zShape, zStride, zCoord, zRank);
-                            Nd4jIndex yOffset = shape::getOffset(0, yShape, yStride, yCoord, yRank);
-
-                            result[zOffset] = OpType::op(x[xOffset], y[yOffset]);
+                            xIter.next();
+                            yIter.next();
+                            zIter.next();
                         }
                     }
                 }
-
-                if (tad != nullptr)
-                    delete tad;
             }
         };
     }
@@ -30,7 +30,7 @@ namespace functions {
 
             if (xEWS >= 1 && yEWS >= 1 && zEWS >= 1) {
                 if (xEWS == 1 && yEWS == 1 && zEWS == 1) {
-#pragma omp parallel for num_threads(_threads) if (_threads > 1) schedule(guided)
+#pragma omp parallel for simd num_threads(_threads) if (_threads > 1) schedule(guided)
                     for (Nd4jIndex e = 0; e < length; e++) {
                         z[e] = OpClass::op(x[e], y[e], e, length, buffer, extraArguments);
                     }
@@ -99,7 +99,7 @@ namespace functions {
 
             if (xEWS >= 1 && zEWS >= 1) {
                 if (xEWS == 1 && zEWS == 1) {
-#pragma omp parallel for num_threads(_threads) if (_threads > 1) schedule(guided)
+#pragma omp parallel for simd num_threads(_threads) if (_threads > 1) schedule(guided)
                     for (Nd4jIndex e = 0; e < length; e++) {
                         z[e] = OpClass::op(x[e], e, length,  buffer, extraArguments);
                     }
@@ -158,7 +158,8 @@ namespace functions {
 
             if (ews >= 1) {
                 if (ews == 1) {
-#pragma omp parallel for num_threads(_threads) if (_threads > 1) schedule(guided)
+                    // elements are independent counters of Philox stream, so this loop vectorizes
+#pragma omp parallel for simd num_threads(_threads) if (_threads > 1) schedule(guided)
                     for (Nd4jIndex x = 0; x < length; x++) {
                         z[x] = OpClass::op(x, length, buffer, extraArguments);
                     }
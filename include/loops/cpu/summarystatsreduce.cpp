@@ -6,6 +6,7 @@
 #include <loops/summarystatsreduce.h>
 #include <helpers/shape.h>
 #include <helpers/TAD.h>
+#include <helpers/StridedIterator.h>
 
 namespace functions {
     namespace summarystats {
@@ -28,6 +29,11 @@ namespace functions {
             startingIndex.initialize();
             Nd4jIndex length = shape::length(xShapeInfo);
             int xElementWiseStride = shape::elementWiseStride(xShapeInfo);
+
+            // whole array is single TAD here, so it's split into chunks if it's large enough
+            if (splitTads(1, length, ELEMENT_THRESHOLD))
+                return OpType::getValue(biasCorrected, execTadChunked<OpType>(x, xShapeInfo, xElementWiseStride == 1 ? 1 : 0, length, extraParams));
+
             if (xElementWiseStride == 1) {
                 for (Nd4jIndex i = 0; i < length; i++) {
                     SummaryStatsData<T> curr;
@@ -40,20 +46,14 @@ namespace functions {
                 return finalVal;
             }
             else {
-                int xCoords[MAX_RANK];
-
-                int *xShape = shape::shapeOf(xShapeInfo);
-                int *xStride = shape::stride(xShapeInfo);
-                int xRank = shape::rank(xShapeInfo);
-
+                nd4j::StridedIterator xIter(xShapeInfo);
 
                 for (Nd4jIndex i = 0; i < length; i++) {
-                    shape::ind2subC(xRank, xShape, i, xCoords);
-                    Nd4jIndex xOffset = shape::getOffset(0, xShape, xStride, xCoords, xRank);
-
                     SummaryStatsData<T> curr;
-                    curr.initWithValue(x[xOffset]);
+                    curr.initWithValue(x[xIter.offset()]);
                     startingIndex = update(startingIndex, curr, extraParams);
+
+                    xIter.next();
                 }
 
                 T finalVal = OpType::getValue(biasCorrected, startingIndex);
@@ -88,6 +88,19 @@ namespace functions {
                 return;
             }
 
+            int tadLength = shape::length(tad.tadOnlyShapeInfo);
+
+            // few large TADs: parallelism goes inside of each TAD instead
+            if (splitTads(tad.numTads, tadLength, ELEMENT_THRESHOLD)) {
+                int tadEWS = shape::elementWiseStride(tad.tadOnlyShapeInfo);
+                bool linearTad = dimensionLength == 1 && tadEWS > 0 && (tad.numTads == 1 || shape::isVector(tad.tadOnlyShapeInfo) || shape::isScalar(tad.tadOnlyShapeInfo));
+
+                for (int i = 0; i < resultLength; i++)
+                    result[i] = OpType::getValue(biasCorrected, execTadChunked<OpType>(x + tad.tadOffsets[i], tad.tadOnlyShapeInfo, linearTad ? tadEWS : 0, tadLength, extraParams));
+
+                return;
+            }
+
             if (!(shape::elementWiseStride(tad.tadOnlyShapeInfo) > 0 && (tad.numTads == 1 || shape::isVector(tad.tadOnlyShapeInfo) ||
                                                                          shape::isScalar(tad.tadOnlyShapeInfo) || tad.wholeThing)) && !(dimensionLength > 1)) {
 
@@ -147,7 +160,6 @@ namespace functions {
             else {
                 if (dimensionLength == 1) {
                     int tadElementWiseStride = shape::elementWiseStride(tad.tadOnlyShapeInfo);
-                    int tadLength = shape::length(tad.tadOnlyShapeInfo);
 
 #pragma omp parallel for schedule(guided) default(shared)
                     for (int i = 0; i < resultLength; i++) {
@@ -166,26 +178,19 @@ namespace functions {
                 } else {
                     int *tadShapeShapeInfo = tad.tadOnlyShapeInfo;
 
-                    int *tadShape = shape::shapeOf(tadShapeShapeInfo);
-                    int *tadStride = shape::stride(tadShapeShapeInfo);
-                    int tadRank = shape::rank(tadShapeShapeInfo);
-                    int tadLength = shape::length(tad.tadOnlyShapeInfo);
-
 #pragma omp parallel for schedule(guided) default(shared)
                     for (int r = 0; r < resultLength; r++) {
-                        int xCoord[MAX_RANK];
-                        Nd4jIndex tadOffsetForBlock = tad.tadOffsets[r];
+                        T *tadX = x + tad.tadOffsets[r];
+                        nd4j::StridedIterator tadIter(tadShapeShapeInfo, 1);
 
                         SummaryStatsData<T> comp;
-                        comp.initWithValue(x[tadOffsetForBlock]);
+                        comp.initWithValue(tadX[0]);
 
 // FIXME: reduction should be fixed
                         for (int i = 1; i < tadLength; i ++) {
-                            shape::ind2subC(tadRank, tadShape, i, xCoord);
-                            Nd4jIndex xOffset = shape::getOffset(tadOffsetForBlock, tadShape, tadStride, xCoord, tadRank);
-
                             SummaryStatsData <T> indexVal2;
-                            indexVal2.initWithValue(x[xOffset]);
+                            indexVal2.initWithValue(tadX[tadIter.offset()]);
+                            tadIter.next();
 
                             comp = update(comp, OpType::op(indexVal2, extraParams), extraParams);
                         }
@@ -195,6 +200,43 @@ namespace functions {
             }
         }
 
+        template <typename T>
+        template <typename OpType>
+        SummaryStatsData<T> SummaryStatsReduce<T>::execTadChunked(T *x, int *tadShapeInfo, int tadEWS, Nd4jIndex tadLength, T *extraParams) {
+            BlockInformation info(tadLength, ELEMENT_THRESHOLD);
+            auto partials = new SummaryStatsData<T>[info.chunks];
+
+#pragma omp parallel for schedule(static) num_threads(info.threads) if (info.threads > 1) default(shared)
+            for (Nd4jIndex c = 0; c < info.chunks; c++) {
+                Nd4jIndex start = c * info.items;
+                Nd4jIndex end = nd4j::math::nd4j_min<Nd4jIndex>(start + info.items, tadLength);
+                nd4j::StridedIterator tadIter(tadShapeInfo, start);
+
+                SummaryStatsData<T> local;
+                local.initialize();
+
+                for (Nd4jIndex j = start; j < end; j++) {
+                    SummaryStatsData<T> comp;
+                    comp.initWithValue(tadEWS > 0 ? x[j * tadEWS] : x[tadIter.offset()]);
+
+                    local = update(local, OpType::op(comp, extraParams), extraParams);
+                    tadIter.next();
+                }
+
+                partials[c] = local;
+            }
+
+            SummaryStatsData<T> result;
+            result.initialize();
+
+            for (Nd4jIndex c = 0; c < info.chunks; c++)
+                result = update(result, partials[c], extraParams);
+
+            delete[] partials;
+
+            return result;
+        }
+
 
         template class ND4J_EXPORT SummaryStatsReduce<float>;
         template class ND4J_EXPORT SummaryStatsReduce<float16>;
@@ -26,6 +26,8 @@
 #endif
 
 #include <helpers/TAD.h>
+#include <helpers/TadCache.h>
+#include <helpers/StridedIterator.h>
 
 
 #include "../pairwise_util.h"
@@ -406,20 +408,15 @@ template<typename OpType>
                 Nd4jIndex length = shape::length(xShapeInfo);
 				int xElementWiseStride = shape::elementWiseStride(xShapeInfo);
 				if(xElementWiseStride < 1) {
-                    int *xShape = shape::shapeOf(xShapeInfo);
-                    int *xStride = shape::stride(xShapeInfo);
-                    int tadRank = shape::rank(xShapeInfo);
-                    int xCoord[MAX_RANK];
+                    nd4j::StridedIterator xIter(xShapeInfo);
 
                     for (Nd4jIndex i = 0; i < length; i++) {
-                        shape::ind2subC(tadRank,xShape, i, xCoord);
-                        Nd4jIndex xOffset = shape::getOffset(0, xShape, xStride, xCoord, tadRank);
-
                         IndexValue<T> curr;
-                        curr.value = x[xOffset];
+                        curr.value = x[xIter.offset()];
                         curr.index = i;
 
                         startingIndex = OpType::update(startingIndex, curr, extraParams);
+                        xIter.next();
                     }
                     return startingIndex.index;
 				}
@@ -493,7 +490,48 @@ template<typename OpType>
 				return  startingIndex.index;
 			}
 
-			
+			/**
+			 * Finds index within single TAD split into chunks, which are processed in parallel.
+			 * Partial results are merged in chunk order, so ties are resolved the same way as in sequential loop
+			 * @param x pointer to the first element of the TAD
+			 * @param tadShapeInfo the TAD shape information
+			 * @param tadEWS TAD element wise stride, or 0 if TAD should be iterated by coordinates
+			 * @param tadLength the TAD length
+			 * @param extraParams the extra parameters
+			 */
+			template<typename OpType>
+			static inline T execTadChunked(T *x, int *tadShapeInfo, int tadEWS, Nd4jIndex tadLength, T *extraParams) {
+				BlockInformation info(tadLength, ELEMENT_THRESHOLD);
+				IndexValue<T> *partials = new IndexValue<T>[info.chunks];
+
+#pragma omp parallel for schedule(static) num_threads(info.threads) if (info.threads > 1) default(shared)
+				for (Nd4jIndex c = 0; c < info.chunks; c++) {
+					Nd4jIndex start = c * info.items;
+					Nd4jIndex end = nd4j::math::nd4j_min<Nd4jIndex>(start + info.items, tadLength);
+					IndexValue<T> local = OpType::startingIndexValue(x);
+					nd4j::StridedIterator tadIter(tadShapeInfo, start);
+
+					for (Nd4jIndex j = start; j < end; j++) {
+						IndexValue<T> comp;
+						comp.index = j;
+						comp.value = tadEWS > 0 ? x[j * tadEWS] : x[tadIter.offset()];
+
+						local = OpType::update(local, comp, extraParams);
+						tadIter.next();
+					}
+
+					partials[c] = local;
+				}
+
+				IndexValue<T> indexValue = OpType::startingIndexValue(x);
+				for (Nd4jIndex c = 0; c < info.chunks; c++)
+					indexValue = OpType::update(indexValue, partials[c], extraParams);
+
+				delete[] partials;
+
+				return indexValue.index;
+			}
+
 			template<typename OpType>
 #ifdef __CUDACC__
 			__host__
@@ -525,28 +563,36 @@ template<typename OpType>
 
 				int *tadOnlyShapeInfo = tadShapeInfo;
 				Nd4jIndex *tadOffsets = tadOffset;
-				shape::TAD *tad = nullptr;
+				std::shared_ptr<nd4j::TadPack> tadPack;
 
 				if (tadOnlyShapeInfo == nullptr || tadOffsets == nullptr) {
-					tad = new shape::TAD(xShapeInfo, dimension, dimensionLength);
-					tad->createTadOnlyShapeInfo();
-					tad->createOffsets();
+					tadPack = nd4j::TadCache::getInstance()->tadForDimensions(xShapeInfo, dimension, dimensionLength);
 
-					if (tad->dimensionLength < 1) {
-						delete tad;
+					if (tadPack->dimensionLength() < 1) {
 						delete[] startingIndex;
 						return;
 					}
 
-					tadOnlyShapeInfo = tad->tadOnlyShapeInfo;
-					tadOffsets = tad->tadOffsets;
+					tadOnlyShapeInfo = tadPack->primaryShapeInfo();
+					tadOffsets = tadPack->primaryOffsets();
 				}
 
 				int tadLength = shape::tadLength(xShapeInfo, dimension, dimensionLength);
 				int numTads = shape::length(xShapeInfo) / tadLength;
 
+				bool linearTad = shape::elementWiseStride(tadOnlyShapeInfo) > 0 && (numTads == 1 || shape::isVector(tadOnlyShapeInfo) || shape::isScalar(tadOnlyShapeInfo));
 
-				if(!(shape::elementWiseStride(tadOnlyShapeInfo) > 0 && (numTads == 1 || shape::isVector(tadOnlyShapeInfo) || shape::isScalar(tadOnlyShapeInfo)))) {
+				// few large TADs: parallelism goes inside of each TAD instead
+				if (splitTads(numTads, tadLength, ELEMENT_THRESHOLD)) {
+					int tadEWS = linearTad ? shape::elementWiseStride(tadOnlyShapeInfo) : 0;
+					for (Nd4jIndex i = 0; i < resultLength; i++)
+						result[i] = execTadChunked<OpType>(x + tadOffsets[i], tadOnlyShapeInfo, tadEWS, tadLength, extraParams);
+
+					delete[] startingIndex;
+					return;
+				}
+
+				if(!linearTad) {
 					/**
                                  * The element wise stride belong longs to a reduction index.
                                  * When used out of order, we can get rid of the data
@@ -557,29 +603,20 @@ template<typename OpType>
                                  * along long which to iterate.
                                  */
 
-					int *tadShapeShapeInfo = tadOnlyShapeInfo;
-					int *xShape = shape::shapeOf(tadShapeShapeInfo);
-					int *xStride = shape::stride(tadShapeShapeInfo);
-					int rank = shape::rank(tadShapeShapeInfo);
-
-
 #pragma omp  parallel for schedule(guided) if (resultLength > TAD_THRESHOLD) default(shared)
 					for(Nd4jIndex i = 0; i < resultLength; i++) {
-                        Nd4jIndex offset = tadOffsets[i];
-
-
-                        IndexValue<T> indexValue = OpType::startingIndexValue(&x[offset]);
+                        T *tad = x + tadOffsets[i];
+                        nd4j::StridedIterator tadIter(tadOnlyShapeInfo);
 
-                        int xCoord[MAX_RANK];
+                        IndexValue<T> indexValue = OpType::startingIndexValue(tad);
 
                         for(int j = 0; j < tadLength; j++) {
-                            shape::ind2subC(rank,xShape, j, xCoord);
-                            Nd4jIndex xOffset = shape::getOffset(offset, xShape, xStride, xCoord, rank);
-
                             IndexValue<T> comp;
                             comp.index = j;
-                            comp.value = x[xOffset];
+                            comp.value = tad[tadIter.offset()];
                             indexValue = OpType::update(indexValue,comp,extraParams);
+
+                            tadIter.next();
                         }
                         result[i] = indexValue.index;
 					}
@@ -13,6 +13,7 @@
 #include <templatemath.h>
 #include <helper_cuda.h>
 #include <helpers/shape.h>
+#include <helpers/StridedIterator.h>
 #include <pairwise_util.h>
 #include <dll.h>
 #include <stdio.h>
@@ -171,30 +172,24 @@ namespace functions {
                             result[e] = OpType::op(dx[e], y[0], extraParams);
                         }
                     } else {
-                        int xCoord[MAX_RANK];
-                        int resultCoord[MAX_RANK];
-
-                        int xRank = shape::rank(xShapeBuffer);
-                        int resultRank = shape::rank(resultShapeBuffer);
-
-                        int *xShape = shape::shapeOf(xShapeBuffer);
-                        int *xStride = shape::stride(xShapeBuffer);
-
-                        int *resultShape = shape::shapeOf(resultShapeBuffer);
-                        int *resultStride = shape::stride(resultShapeBuffer);
-
                         int elementsPerThread = n / ELEMENT_THRESHOLD;
                         int num_threads = nd4j::math::nd4j_max<int>(1, elementsPerThread);
                         num_threads = nd4j::math::nd4j_min<int>(num_threads, omp_get_max_threads());
 
-#pragma omp parallel for schedule(guided) num_threads(num_threads) if (num_threads > 1) proc_bind(AFFINITY) default(shared) private(xCoord, resultCoord)
-                        for (Nd4jIndex i = 0; i < n; i++) {
-                            shape::ind2subC(xRank,xShape, i, xCoord);
-                            shape::ind2subC(resultRank,resultShape, i, resultCoord);
+#pragma omp parallel num_threads(num_threads) if (num_threads > 1) proc_bind(AFFINITY) default(shared)
+                        {
+                            Nd4jIndex start, end;
+                            nd4j::StridedIterator::threadSpan(n, omp_get_thread_num(), omp_get_num_threads(), start, end);
+
+                            nd4j::StridedIterator xIter(xShapeBuffer, start);
+                            nd4j::StridedIterator resultIter(resultShapeBuffer, start);
 
-                            Nd4jIndex xOffset = shape::getOffset(0, xShape, xStride, xCoord, xRank);
-                            Nd4jIndex resultOffset = shape::getOffset(0, resultShape, resultStride, resultCoord, resultRank);
-                            result[resultOffset] = OpType::op(dx[xOffset], y[0], extraParams);
+                            for (Nd4jIndex i = start; i < end; i++) {
+                                result[resultIter.offset()] = OpType::op(dx[xIter.offset()], y[0], extraParams);
+
+                                xIter.next();
+                                resultIter.next();
+                            }
                         }
                     }
 
@@ -313,53 +308,36 @@ for (Nd4jIndex i = 0; i < xShape[0]; i++) {
                 }
 
                 else {
-                    Nd4jIndex len = n;
-                    int xRank = shape::rank(xShapeBuffer);
-                    int yRank = shape::rank(yShapeBuffer);
-                    int resultRank = shape::rank(resultShapeBuffer);
-
-                    int *xShape = shape::shapeOf(xShapeBuffer);
-                    int *xStride = shape::stride(xShapeBuffer);
-
-                    int *yShape = shape::shapeOf(yShapeBuffer);
-                    int *yStride = shape::stride(yShapeBuffer);
-
-                    int *resultShape = shape::shapeOf(resultShapeBuffer);
-                    int *resultStride = shape::stride(resultShapeBuffer);
-
                     int elementsPerThread = n / ELEMENT_THRESHOLD;
                     int num_threads = nd4j::math::nd4j_max<int>(1, elementsPerThread);
                     num_threads = nd4j::math::nd4j_min<int>(num_threads, omp_get_max_threads());
 
-                    int xCoord[MAX_RANK];
-                    int yCoord[MAX_RANK];
-
-                    if(dx == result) {
-#pragma omp parallel for schedule(guided) num_threads(num_threads) if (num_threads > 1) proc_bind(AFFINITY) default(shared) private(xCoord, yCoord)
-                        for (Nd4jIndex i = 0; i < len; i++) {
-                            shape::ind2subC(xRank,xShape, i, xCoord);
-                            shape::ind2subC(yRank,yShape, i, yCoord);
+#pragma omp parallel num_threads(num_threads) if (num_threads > 1) proc_bind(AFFINITY) default(shared)
+                    {
+                        Nd4jIndex start, end;
+                        nd4j::StridedIterator::threadSpan(n, omp_get_thread_num(), omp_get_num_threads(), start, end);
 
-                            Nd4jIndex xOffset = shape::getOffset(0, xShape, xStride, xCoord, xRank);
-                            Nd4jIndex yOffset = shape::getOffset(0, yShape, yStride, yCoord, yRank);
-                            result[xOffset] = OpType::op(dx[xOffset], y[yOffset], extraParams);
+                        nd4j::StridedIterator xIter(xShapeBuffer, start);
+                        nd4j::StridedIterator yIter(yShapeBuffer, start);
 
-                        }
-                    }
-                    else {
-                        int resultCoord[MAX_RANK];
+                        if (dx == result) {
+                            for (Nd4jIndex i = start; i < end; i++) {
+                                Nd4jIndex xOffset = xIter.offset();
+                                result[xOffset] = OpType::op(dx[xOffset], y[yIter.offset()], extraParams);
 
-#pragma omp parallel for schedule(guided) num_threads(num_threads) if (num_threads > 1) proc_bind(AFFINITY) default(shared) private(xCoord, yCoord, resultCoord)
-                        for (Nd4jIndex i = 0; i < len; i++) {
-                            shape::ind2subC(xRank,xShape, i, xCoord);
-                            shape::ind2subC(yRank,yShape, i, yCoord);
-                            shape::ind2subC(resultRank,resultShape, i, resultCoord);
+                                xIter.next();
+                                yIter.next();
+                            }
+                        } else {
+                            nd4j::StridedIterator resultIter(resultShapeBuffer, start);
 
-                            Nd4jIndex xOffset = shape::getOffset(0, xShape, xStride, xCoord, xRank);
-                            Nd4jIndex yOffset = shape::getOffset(0, yShape, yStride, yCoord, yRank);
-                            Nd4jIndex resultOffset = shape::getOffset(0, resultShape, resultStride, resultCoord, resultRank);
-                            result[resultOffset] = OpType::op(dx[xOffset], y[yOffset], extraParams);
+                            for (Nd4jIndex i = start; i < end; i++) {
+                                result[resultIter.offset()] = OpType::op(dx[xIter.offset()], y[yIter.offset()], extraParams);
 
+                                xIter.next();
+                                yIter.next();
+                                resultIter.next();
+                            }
                         }
                     }
                 }
@@ -6,6 +6,8 @@
 #include <helpers/sharedmem.h>
 #include <stdio.h>
 #include <helpers/shape.h>
+#include <helpers/TadCache.h>
+#include <helpers/StridedIterator.h>
 #ifdef _OPENMP
 #include <omp.h>
 #endif
@@ -516,20 +518,16 @@ template<typename OpType>
 
                 int *tadOnlyShapeInfo = tadShapeInfo;
                 Nd4jIndex *tadOffsets = tadOffset;
-                shape::TAD *tad = nullptr;
+                std::shared_ptr<nd4j::TadPack> tadPack;
 
                 if (tadOnlyShapeInfo == nullptr || tadOffsets == nullptr) {
-                    tad = new shape::TAD(xShapeInfo, dimension, dimensionLength);
-                    tad->createTadOnlyShapeInfo();
-                    tad->createOffsets();
+                    tadPack = nd4j::TadCache::getInstance()->tadForDimensions(xShapeInfo, dimension, dimensionLength);
 
-                    if (tad->dimensionLength < 1) {
-                        delete tad;
+                    if (tadPack->dimensionLength() < 1)
                         return;
-                    }
 
-                    tadOnlyShapeInfo = tad->tadOnlyShapeInfo;
-                    tadOffsets = tad->tadOffsets;
+                    tadOnlyShapeInfo = tadPack->primaryShapeInfo();
+                    tadOffsets = tadPack->primaryOffsets();
                 }
 
 
@@ -541,7 +539,17 @@ template<typename OpType>
                 int num_threads = nd4j::math::nd4j_max<int>(1, tadsPerThread);
                 num_threads = nd4j::math::nd4j_min<int>(num_threads, omp_get_max_threads());
 
-                if (tadEWS > 0 && (numTads == 1 || shape::isVector(tadOnlyShapeInfo) || shape::isScalar(tadOnlyShapeInfo))) {
+                bool linearTad = tadEWS > 0 && (numTads == 1 || shape::isVector(tadOnlyShapeInfo) || shape::isScalar(tadOnlyShapeInfo));
+
+                // few large TADs: parallelism goes inside of each TAD instead
+                if (splitTads(numTads, tadLength, ELEMENT_THRESHOLD)) {
+                    for (int i = 0; i < resultLength; i++)
+                        result[i] = execTadChunked<OpType>(x + tadOffsets[i], tadOnlyShapeInfo, linearTad ? tadEWS : 0, tadLength, extraParams);
+
+                    return;
+                }
+
+                if (linearTad) {
 
 #pragma omp parallel for schedule(guided) num_threads(num_threads) if (num_threads > 1) proc_bind(AFFINITY) default(shared)
                     for (int i = 0; i < resultLength; i++) {
@@ -565,30 +573,64 @@ template<typename OpType>
                     }
                 }
                 else {
-                    int *tadShape = shape::shapeOf(tadOnlyShapeInfo);
-                    int *tadStride = shape::stride(tadOnlyShapeInfo);
-                    int tadRank = shape::rank(tadOnlyShapeInfo);
-
 #pragma omp  parallel for schedule(guided) num_threads(num_threads) if (num_threads > 1) proc_bind(AFFINITY) default(shared)
                     for (int i = 0; i < resultLength; i++) {
-                        Nd4jIndex offset = tadOffsets[i];
-                        int xCoord[MAX_RANK];
+                        T *tad = x + tadOffsets[i];
+                        nd4j::StridedIterator tadIter(tadOnlyShapeInfo);
 
-                        T start = OpType::startingValue(x + offset);
+                        T start = OpType::startingValue(tad);
 
                         for (int j = 0; j < tadLength; j++) {
-                            shape::ind2subC(tadRank, tadShape, j, xCoord);
-                            Nd4jIndex xOffset = shape::getOffset(offset, tadShape, tadStride, xCoord, tadRank);
-
-                            start = OpType::update(start, OpType::op(x[xOffset], extraParams), extraParams);
+                            start = OpType::update(start, OpType::op(tad[tadIter.offset()], extraParams), extraParams);
+                            tadIter.next();
                         }
 
                         result[i] = OpType::postProcess(start, tadLength, extraParams);;
                     }
                 }
+            }
+
+            /**
+             * Reduces single TAD split into chunks, which are processed in parallel.
+             * Partial results are merged in chunk order with OpType::update, and post-processed once
+             * @param x pointer to the first element of the TAD
+             * @param tadShapeInfo the TAD shape information
+             * @param tadEWS TAD element wise stride, or 0 if TAD should be iterated by coordinates
+             * @param tadLength the TAD length
+             * @param extraParams the extra parameters
+             */
+            template<typename OpType>
+            static T _CUDA_H execTadChunked(T *x, int *tadShapeInfo, int tadEWS, Nd4jIndex tadLength, T *extraParams) {
+                BlockInformation info(tadLength, ELEMENT_THRESHOLD);
+                T *partials = new T[info.chunks];
+
+#pragma omp parallel for schedule(static) num_threads(info.threads) if (info.threads > 1) proc_bind(AFFINITY) default(shared)
+                for (Nd4jIndex c = 0; c < info.chunks; c++) {
+                    Nd4jIndex start = c * info.items;
+                    Nd4jIndex end = nd4j::math::nd4j_min<Nd4jIndex>(start + info.items, tadLength);
+                    T local = OpType::startingValue(x);
+
+                    if (tadEWS > 0) {
+                        for (Nd4jIndex j = start; j < end; j++)
+                            local = OpType::update(local, OpType::op(x[j * tadEWS], extraParams), extraParams);
+                    } else {
+                        nd4j::StridedIterator tadIter(tadShapeInfo, start);
+                        for (Nd4jIndex j = start; j < end; j++) {
+                            local = OpType::update(local, OpType::op(x[tadIter.offset()], extraParams), extraParams);
+                            tadIter.next();
+                        }
+                    }
+
+                    partials[c] = local;
+                }
+
+                T finalVal = OpType::startingValue(x);
+                for (Nd4jIndex c = 0; c < info.chunks; c++)
+                    finalVal = OpType::update(finalVal, partials[c], extraParams);
+
+                delete[] partials;
 
-                if (tad != nullptr)
-                    delete tad;
+                return OpType::postProcess(finalVal, tadLength, extraParams);
             }
 
             /**
@@ -19,6 +19,8 @@
 #include <pairwise_util.h>
 #include <dll.h>
 #include <helpers/shape.h>
+#include <helpers/TadCache.h>
+#include <helpers/StridedIterator.h>
 #include <ops/ops.h>
 #include <op_boilerplate.h>
 
@@ -886,33 +888,86 @@ template<typename OpType>
 
 
                 else {
-                    int xCoords[MAX_RANK];
-                    int yCoords[MAX_RANK];
+                    nd4j::StridedIterator xIter(xShapeInfo);
+                    nd4j::StridedIterator yIter(yShapeInfo);
 
-                    int xRank = shape::rank(xShapeInfo);
-                    int yRank = shape::rank(yShapeInfo);
+                    for(Nd4jIndex i = 0 ;i < length; i++) {
+                        startingVal = OpType::update(startingVal, OpType::op(x[xIter.offset()], y[yIter.offset()], extraParamsVals), extraParamsVals);
 
-                    int *xShape = shape::shapeOf(xShapeInfo);
-                    int *xStride = shape::stride(xShapeInfo);
-                    int *yShape = shape::shapeOf(yShapeInfo);
-                    int *yStride = shape::stride(yShapeInfo);
+                        xIter.next();
+                        yIter.next();
+                    }
+                }
+
+                return OpType::postProcess(startingVal, length, extraParamsVals);;
+
+
+            }
+
+
+            /**
+             * Reduces single pair of TADs split into chunks, which are processed in parallel.
+             * Each chunk accumulates its own extra params, partial results are merged in chunk order
+             * with OpType::update and OpType::aggregateExtraParams, and post-processed once
+             * @param x pointer to the first element of x TAD
+             * @param xTadShapeInfo x TAD shape information
+             * @param xEWS x TAD element wise stride, or 0 if TADs should be iterated by coordinates
+             * @param y pointer to the first element of y TAD
+             * @param yTadShapeInfo y TAD shape information
+             * @param yEWS y TAD element wise stride, or 0 if TADs should be iterated by coordinates
+             * @param tadLength the TAD length
+             * @param startingVal initial value for extra params
+             */
+            template<typename OpType>
+            static T execTadChunked(T *x, int *xTadShapeInfo, int xEWS, T *y, int *yTadShapeInfo, int yEWS, Nd4jIndex tadLength, T startingVal) {
+                BlockInformation info(tadLength, ELEMENT_THRESHOLD);
+
+                // 3 extra params per chunk, same as extraParamsVals everywhere else
+                T *partials = new T[info.chunks];
+                T *extras = new T[info.chunks * 3];
+
+#pragma omp parallel for schedule(static) num_threads(info.threads) if (info.threads > 1) proc_bind(AFFINITY) default(shared)
+                for (Nd4jIndex c = 0; c < info.chunks; c++) {
+                    Nd4jIndex start = c * info.items;
+                    Nd4jIndex end = nd4j::math::nd4j_min<Nd4jIndex>(start + info.items, tadLength);
 
-                    for(unsigned int i = 0 ;i < length; i++) {
-                        shape::ind2subC(xRank, xShape, i, xCoords);
-                        shape::ind2subC(yRank, yShape, i, yCoords);
+                    T *localExtraParams = extras + c * 3;
+                    for (int e = 0; e < 3; e++)
+                        localExtraParams[e] = startingVal;
 
-                        Nd4jIndex offset = shape::getOffset(0, xShape, xStride, xCoords, xRank);
-                        Nd4jIndex yOffset = shape::getOffset(0, yShape, yStride, yCoords, yRank);
+                    T local = OpType::startingValue(x);
 
-                        startingVal = OpType::update(startingVal, OpType::op(x[offset], y[yOffset], extraParamsVals), extraParamsVals);
+                    if (xEWS > 0 && yEWS > 0) {
+                        for (Nd4jIndex j = start; j < end; j++)
+                            local = OpType::update(local, OpType::op(x[j * xEWS], y[j * yEWS], localExtraParams), localExtraParams);
+                    } else {
+                        nd4j::StridedIterator xIter(xTadShapeInfo, start);
+                        nd4j::StridedIterator yIter(yTadShapeInfo, start);
+
+                        for (Nd4jIndex j = start; j < end; j++) {
+                            local = OpType::update(local, OpType::op(x[xIter.offset()], y[yIter.offset()], localExtraParams), localExtraParams);
+
+                            xIter.next();
+                            yIter.next();
+                        }
                     }
+
+                    partials[c] = local;
                 }
 
-                return OpType::postProcess(startingVal, length, extraParamsVals);;
+                T finalVal = partials[0];
+                for (Nd4jIndex c = 1; c < info.chunks; c++) {
+                    finalVal = OpType::update(finalVal, partials[c], extras);
+                    OpType::aggregateExtraParams(extras, extras + c * 3);
+                }
 
+                finalVal = OpType::postProcess(finalVal, tadLength, extras);
 
-            }
+                delete[] partials;
+                delete[] extras;
 
+                return finalVal;
+            }
 
             template<typename OpType>
             static void execAll(
@@ -1043,6 +1098,14 @@ template<typename OpType>
                 //shape::printShapeInfoLinear(resultShapeInfoBuffer);
                 //shape::printShapeInfoLinear(tadShapeInfo);
 
+                // few large TADs: parallelism goes inside of each TAD instead. coordinates are built in c order there
+                if (shape::order(tadShapeInfo) == 'c' && splitTads(tads, tadLength, ELEMENT_THRESHOLD)) {
+                    for (int r = 0; r < tads; r++)
+                        result[r] = execTadChunked<OpType>(x + tadOffsets[r], tadShapeInfo, 0, y, yShapeInfo, 0, tadLength, startingVal);
+
+                    return;
+                }
+
                 int xCoord[MAX_RANK];
                 int yCoord[MAX_RANK];
 
@@ -1181,14 +1244,10 @@ template<typename OpType>
                     T startingVal = OpType::startingValue(x);
 
                     Nd4jIndex resultLength = shape::length(resultShapeInfoBuffer);
-                    shape::TAD xTad(xShapeInfo, dimension, dimensionLength);
-                    xTad.createTadOnlyShapeInfo();
-                    xTad.createOffsets();
+                    auto xTad = nd4j::TadCache::getInstance()->tadForDimensions(xShapeInfo, dimension, dimensionLength);
 
 
-                    shape::TAD yTad(yShapeInfo, dimension, dimensionLength);
-                    yTad.createTadOnlyShapeInfo();
-                    yTad.createOffsets();
+                    auto yTad = nd4j::TadCache::getInstance()->tadForDimensions(yShapeInfo, dimension, dimensionLength);
 
                     /**
                      * The element wise stride belong longs to a reduction index.
@@ -1201,16 +1260,16 @@ template<typename OpType>
                      */
                     int largerElementWiseStride;
                     int smallerElementWiseStride;
-                    int xElementWiseStride = shape::elementWiseStride(xTad.tadOnlyShapeInfo);
-                    int yElementWiseStride = shape::elementWiseStride(yTad.tadOnlyShapeInfo);
+                    int xElementWiseStride = shape::elementWiseStride(xTad->primaryShapeInfo());
+                    int yElementWiseStride = shape::elementWiseStride(yTad->primaryShapeInfo());
                     int tadLength;
                     int xModLength;
                     int yModLength;
                     int *iterationTadInfo;
                     bool xTadBigger;
                     if(shape::length(xShapeInfo) > shape::length(yShapeInfo)) {
-                        tadLength = shape::length(xTad.tadOnlyShapeInfo);
-                        iterationTadInfo = xTad.tadOnlyShapeInfo;
+                        tadLength = shape::length(xTad->primaryShapeInfo());
+                        iterationTadInfo = xTad->primaryShapeInfo();
                         largerElementWiseStride = shape::elementWiseStride(xShapeInfo);
                         smallerElementWiseStride = shape::elementWiseStride(yShapeInfo);
                         xModLength = 1;
@@ -1219,8 +1278,8 @@ template<typename OpType>
 
                     }
                     else {
-                        tadLength = shape::length(yTad.tadOnlyShapeInfo);
-                        iterationTadInfo = yTad.tadOnlyShapeInfo;
+                        tadLength = shape::length(yTad->primaryShapeInfo());
+                        iterationTadInfo = yTad->primaryShapeInfo();
                         largerElementWiseStride = shape::elementWiseStride(yShapeInfo);
                         smallerElementWiseStride = shape::elementWiseStride(xShapeInfo);
                         xModLength = tadLength;
@@ -1231,7 +1290,19 @@ template<typename OpType>
 
 
 
-                    if (largerElementWiseStride >= 1 && smallerElementWiseStride >= 1 && xElementWiseStride >= 1 && yElementWiseStride >= 1) {
+                    bool linearTads = largerElementWiseStride >= 1 && smallerElementWiseStride >= 1 && xElementWiseStride >= 1 && yElementWiseStride >= 1;
+
+                    // few large TADs: parallelism goes inside of each pair of TADs instead
+                    if (shape::length(xShapeInfo) == shape::length(yShapeInfo) && splitTads(resultLength, tadLength, ELEMENT_THRESHOLD)) {
+                        for (Nd4jIndex i = 0; i < resultLength; i++)
+                            result[i] = execTadChunked<OpType>(x + xTad->primaryOffsets()[i], xTad->primaryShapeInfo(), linearTads ? xElementWiseStride : 0,
+                                                               y + yTad->primaryOffsets()[i], yTad->primaryShapeInfo(), linearTads ? yElementWiseStride : 0,
+                                                               tadLength, startingVal);
+
+                        return;
+                    }
+
+                    if (linearTads) {
                         if(shape::length(xShapeInfo) == shape::length(yShapeInfo)) {
                             //#pragma omp parallel for proc_bind(AFFINITY) default(shared)
                             for (Nd4jIndex i = 0; i < resultLength; i++) {
@@ -1242,8 +1313,8 @@ template<typename OpType>
                                     localExtraParams[extraParamsIdx] = startingVal;
                                 }
 
-                                Nd4jIndex offset = xTad.tadOffsets[i];
-                                Nd4jIndex yOffset = yTad.tadOffsets[i];
+                                Nd4jIndex offset = xTad->primaryOffsets()[i];
+                                Nd4jIndex yOffset = yTad->primaryOffsets()[i];
                                 result[i] = OpType::op(x[offset], y[yOffset], localExtraParams);
                                 for (int j = 1; j < tadLength; j++) {
                                     int xIdx = (offset + xElementWiseStride * j);
@@ -1267,29 +1338,29 @@ template<typename OpType>
 
 //#pragma omp  parallel for schedule(guided) num_threads(num_threads) if (num_threads > 1) proc_bind(AFFINITY) default(shared)
                             for (int i = 0; i < resultLength; i++) {
-                                Nd4jIndex xOffset = xTadBigger ? xTad.tadOffsets[i] : 0;
-                                Nd4jIndex yOffset = !xTadBigger ? yTad.tadOffsets[i] : 0;
-                                int *xShape = xTadBigger ? xTad.tadShape : shape::shapeOf(xShapeInfo);
-                                int *yShape = !xTadBigger ? yTad.tadShape : shape::shapeOf(yShapeInfo);
-                                int *xStride = xTadBigger ? xTad.tadStride : shape::stride(xShapeInfo);
-                                int *yStride = !xTadBigger ? yTad.tadStride : shape::stride(yShapeInfo);
-                                int xRank = xTadBigger ? shape::rank(xTad.tadOnlyShapeInfo) : shape::rank(xShapeInfo);
-                                int yRank = !xTadBigger ? shape::rank(yTad.tadOnlyShapeInfo) : shape::rank(yShapeInfo);
+                                Nd4jIndex xOffset = xTadBigger ? xTad->primaryOffsets()[i] : 0;
+                                Nd4jIndex yOffset = !xTadBigger ? yTad->primaryOffsets()[i] : 0;
+                                int *xShape = xTadBigger ? shape::shapeOf(xTad->primaryShapeInfo()) : shape::shapeOf(xShapeInfo);
+                                int *yShape = !xTadBigger ? shape::shapeOf(yTad->primaryShapeInfo()) : shape::shapeOf(yShapeInfo);
+                                int *xStride = xTadBigger ? shape::stride(xTad->primaryShapeInfo()) : shape::stride(xShapeInfo);
+                                int *yStride = !xTadBigger ? shape::stride(yTad->primaryShapeInfo()) : shape::stride(yShapeInfo);
+                                int xRank = xTadBigger ? shape::rank(xTad->primaryShapeInfo()) : shape::rank(xShapeInfo);
+                                int yRank = !xTadBigger ? shape::rank(yTad->primaryShapeInfo()) : shape::rank(yShapeInfo);
                                 int coord[MAX_RANK];
                                 int yCoord[MAX_RANK];
                                 T start = 0.0;
 
                                 for (int j = 0; j < tadLength; j++) {
                                     if(xTadBigger) {
-                                        shape::ind2subC(shape::rank(xTad.tadOnlyShapeInfo),
-                                                        xTad.tadStride, j, coord);
+                                        shape::ind2subC(shape::rank(xTad->primaryShapeInfo()),
+                                                        shape::stride(xTad->primaryShapeInfo()), j, coord);
                                         shape::ind2subC(shape::rank(yShapeInfo),
                                                         shape::shapeOf(yShapeInfo), j, yCoord);
                                     }
                                     else {
                                         shape::ind2subC(shape::rank(xShapeInfo), shape::shapeOf(xShapeInfo), j, coord);
-                                        shape::ind2subC(shape::rank(yTad.tadOnlyShapeInfo),
-                                                        yTad.tadShape, j, yCoord);
+                                        shape::ind2subC(shape::rank(yTad->primaryShapeInfo()),
+                                                        shape::shapeOf(yTad->primaryShapeInfo()), j, yCoord);
                                     }
 
 
@@ -1304,14 +1375,10 @@ template<typename OpType>
                         }
 
                     } else {
-                        shape::TAD xTad(xShapeInfo, dimension, dimensionLength);
-                        xTad.createTadOnlyShapeInfo();
-                        xTad.createOffsets();
+                        auto xTad = nd4j::TadCache::getInstance()->tadForDimensions(xShapeInfo, dimension, dimensionLength);
 
 
-                        shape::TAD yTad(yShapeInfo, dimension, dimensionLength);
-                        yTad.createTadOnlyShapeInfo();
-                        yTad.createOffsets();
+                        auto yTad = nd4j::TadCache::getInstance()->tadForDimensions(yShapeInfo, dimension, dimensionLength);
                         int tadsPerThread = resultLength / TAD_THRESHOLD;
                         int num_threads = nd4j::math::nd4j_max<int>(1, tadsPerThread);
                         num_threads = nd4j::math::nd4j_min<int>(num_threads, omp_get_max_threads());
@@ -1320,16 +1387,16 @@ template<typename OpType>
 
 //#pragma omp  parallel for schedule(guided) num_threads(num_threads) if (num_threads > 1) proc_bind(AFFINITY) default(shared) private(coord)
                         for (int i = 0; i < resultLength; i++) {
-                            Nd4jIndex xOffset = xTad.tadOffsets[i];
-                            Nd4jIndex yOffset = yTad.tadOffsets[i];
+                            Nd4jIndex xOffset = xTad->primaryOffsets()[i];
+                            Nd4jIndex yOffset = yTad->primaryOffsets()[i];
 
 
                             T start = OpType::startingValue(x + xOffset);
 
                             for (int j = 0; j < tadLength; j++) {
                                 shape::ind2subC(shape::rank(iterationTadInfo), shape::shapeOf(iterationTadInfo), j, coord);
-                                Nd4jIndex xOffset2 = shape::getOffset(xOffset,shape::shapeOf(xTad.tadOnlyShapeInfo),shape::stride(xTad.tadOnlyShapeInfo),coord,shape::rank(xTad.tadOnlyShapeInfo));
-                                Nd4jIndex yOffset2 = shape::getOffset(yOffset,shape::shapeOf(yTad.tadOnlyShapeInfo),shape::stride(yTad.tadOnlyShapeInfo),coord,shape::rank(yTad.tadOnlyShapeInfo));
+                                Nd4jIndex xOffset2 = shape::getOffset(xOffset,shape::shapeOf(xTad->primaryShapeInfo()),shape::stride(xTad->primaryShapeInfo()),coord,shape::rank(xTad->primaryShapeInfo()));
+                                Nd4jIndex yOffset2 = shape::getOffset(yOffset,shape::shapeOf(yTad->primaryShapeInfo()),shape::stride(yTad->primaryShapeInfo()),coord,shape::rank(yTad->primaryShapeInfo()));
                                 start = OpType::update(start, OpType::op(x[xOffset2], y[yOffset2],extraParamsVals), extraParamsVals);
                             }
 
@@ -299,6 +299,13 @@ namespace functions {
             template<typename OpType>
             static void exec(const bool biasCorrected, T *x, int *xShapeInfo, T *extraParams, T *result, int *resultShapeInfoBuffer, int *dimension, int dimensionLength);
 
+            /**
+             * Accumulates stats of single TAD split into chunks, which are processed in parallel and merged in chunk order.
+             * tadEWS equal to 0 means TAD is iterated by coordinates
+             */
+            template<typename OpType>
+            static SummaryStatsData<T> execTadChunked(T *x, int *tadShapeInfo, int tadEWS, Nd4jIndex tadLength, T *extraParams);
+
         };
     }
 }
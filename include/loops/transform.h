@@ -21,6 +21,7 @@
 #include <loops/scalar.h>
 #include <loops/indexreduce.h>
 #include <loops/broadcasting.h>
+#include <helpers/SimdHelper.h>
 
 #ifdef __CUDACC__
 #include <cuda.h>
@@ -39,6 +40,39 @@
 namespace functions {
     namespace transform {
 
+        /**
+         * Maps ops to vectorized kernels in SimdHelper. Ops without kernel keep scalar loop
+         */
+        template<typename OpType>
+        struct SimdTransformOp {
+            static const int op = -1;
+        };
+
+        template<typename X>
+        struct SimdTransformOp<simdOps::Exp<X>> {
+            static const int op = nd4j::SIMD_EXP;
+        };
+
+        template<typename X>
+        struct SimdTransformOp<simdOps::Log<X>> {
+            static const int op = nd4j::SIMD_LOG;
+        };
+
+        template<typename X>
+        struct SimdTransformOp<simdOps::Tanh<X>> {
+            static const int op = nd4j::SIMD_TANH;
+        };
+
+        template<typename X>
+        struct SimdTransformOp<simdOps::Sigmoid<X>> {
+            static const int op = nd4j::SIMD_SIGMOID;
+        };
+
+        template<typename X>
+        struct SimdTransformOp<simdOps::SoftPlus<X>> {
+            static const int op = nd4j::SIMD_SOFTPLUS;
+        };
+
         template<typename T>
         class Transform {
         public:
@@ -332,6 +366,7 @@ template<typename OpType>
                 int span = (n / num_threads) + 8;
 
                 if (xStride == 1 && resultStride == 1) {
+                    nd4j::SimdHelper *simd = SimdTransformOp<OpType>::op >= 0 ? nd4j::SimdHelper::getInstance() : nullptr;
 
 #pragma omp parallel num_threads(num_threads) if (num_threads>1) proc_bind(AFFINITY) default(shared)
                     {
@@ -340,9 +375,14 @@ template<typename OpType>
                         int end = span * (tid + 1);
                         if (end > n) end = n;
 
+                        // transcendental ops can't be vectorized by compiler, so we use dedicated kernels for them
+                        bool vectorized = simd != nullptr && simd->template transform<T>(SimdTransformOp<OpType>::op, dx + start, result + start, end - start);
+
+                        if (!vectorized) {
 #pragma omp simd
-                        for (Nd4jIndex i = start; i < end; i++) {
-                            result[i] = OpType::op(dx[i], extraParams);
+                            for (Nd4jIndex i = start; i < end; i++) {
+                                result[i] = OpType::op(dx[i], extraParams);
+                            }
                         }
                     }
                 } else {
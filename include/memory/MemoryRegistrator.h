@@ -6,17 +6,31 @@
 #define LIBND4J_MEMORYREGISTRATOR_H
 
 #include "Workspace.h"
-#include <map>
+#include <unordered_map>
 #include <mutex>
 
 namespace nd4j {
     namespace memory {
+        /**
+         * This class keeps memory footprints of graphs, keyed by graph hash.
+         *
+         * Footprints are split into shards by hash, each shard with its own lock,
+         * so concurrent executions of different graphs don't wait for each other.
+         */
         class MemoryRegistrator {
         protected:
+            static const int NUM_SHARDS = 16;
+
+            struct Shard {
+                std::unordered_map<Nd4jIndex, Nd4jIndex> footprint;
+                std::mutex lock;
+            };
+
             static MemoryRegistrator* _INSTANCE;
             Workspace* _workspace;
-            std::map<Nd4jIndex, Nd4jIndex> _footprint;
-            std::mutex _lock;
+            Shard _shards[NUM_SHARDS];
+
+            Shard& shardOf(Nd4jIndex hash);
 
             MemoryRegistrator();
             ~MemoryRegistrator() = default;
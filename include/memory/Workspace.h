@@ -16,6 +16,15 @@
 #include <types/float16.h>
 #include <memory/ExternalWorkspace.h>
 
+// default alignment for workspace allocations: cache line, and widest SIMD register
+#define WORKSPACE_ALIGNMENT 64
+
+// size of per-thread sub-arena, carved out of workspace buffer. Used only for workspaces of 16+ arenas
+#define WORKSPACE_ARENA_SIZE 65536
+
+// number of sub-arenas each thread keeps, one per workspace it allocates from
+#define WORKSPACE_ARENA_SLOTS 4
+
 namespace nd4j {
     namespace memory {
 
@@ -39,21 +48,56 @@ namespace nd4j {
             Nd4jIndex _initialSize = 0L;
             Nd4jIndex _currentSize = 0L;
 
-            std::mutex _mutexAllocation;
-            std::mutex _mutexSpills;
-
             bool _externalized = false;
 
-            std::vector<void*> _spills;
+            Nd4jIndex _alignment = WORKSPACE_ALIGNMENT;
+            Nd4jIndex _arenaSize = 0L;
+
+            // true if host buffer is backed by anonymous mmap
+            bool _mapped = false;
+
+            // memory above this offset was never handed out, so it gets zeroed on first use
+            Nd4jIndex _cleanFrom = 0L;
+
+            // growth statistics
+            Nd4jIndex _growths = 0L;
+            Nd4jIndex _grownBytes = 0L;
+
+            // buffers replaced while arrays might still live there, released on next scopeIn()
+            struct RetiredBuffer {
+                char* pointer;
+                Nd4jIndex size;
+                bool mapped;
+            };
+            std::vector<RetiredBuffer> _retired;
 
+            // bumped on every reset/reallocation, so stale thread arenas are never reused
+            std::atomic<Nd4jIndex> _generation;
+
+            // lock-free list of spilled allocations
+            std::atomic<void*> _spills;
+
+            std::atomic<Nd4jIndex> _usedSize;
             std::atomic<Nd4jIndex> _spillsSize;
             std::atomic<Nd4jIndex> _cycleAllocations;
 
             void init(Nd4jIndex bytes);
             void freeSpills();
+            void freeRetired();
+            void resetCounters();
+
+            void allocateBuffer(Nd4jIndex bytes);
+            void releaseBuffer();
+
+            // zeroes part of [offset, offset + numBytes) that was never handed out before
+            void zeroFresh(Nd4jIndex offset, Nd4jIndex numBytes);
+
+            // returns offset of aligned block of given size within buffer, or -1 if there's not enough space left
+            Nd4jIndex bump(Nd4jIndex numBytes);
+            void* spill(Nd4jIndex numBytes);
         public:
             explicit Workspace(ExternalWorkspace *external);
-            explicit Workspace(Nd4jIndex initialSize = 0);
+            explicit Workspace(Nd4jIndex initialSize = 0, int alignment = WORKSPACE_ALIGNMENT);
             ~Workspace();
 
             Nd4jIndex getAllocatedSize();
@@ -61,10 +105,18 @@ namespace nd4j {
             Nd4jIndex getCurrentOffset();
             Nd4jIndex getSpilledSize();
             Nd4jIndex getUsedSize();
+            int getAlignment();
 
             void expandBy(Nd4jIndex numBytes);
             void expandTo(Nd4jIndex numBytes);
 
+            /**
+             * These methods return number of times this workspace was grown, and total number of bytes added by growth.
+             * Growth never copies contents: buffer that might be in use is retired till next scopeIn()
+             */
+            Nd4jIndex getNumberOfGrowths();
+            Nd4jIndex getGrownBytes();
+
 //            bool resizeSupported();
 
             void* allocateBytes(Nd4jIndex numBytes);
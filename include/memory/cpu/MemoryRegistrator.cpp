@@ -34,38 +34,35 @@ namespace nd4j {
             _workspace = nullptr;
         }
 
+        MemoryRegistrator::Shard& MemoryRegistrator::shardOf(Nd4jIndex hash) {
+            // graph hashes aren't guaranteed to have good low bits, so upper half is folded in
+            auto h = (uint64_t) hash;
+            return _shards[(h ^ (h >> 32) ^ (h >> 17)) & (NUM_SHARDS - 1)];
+        }
+
         void MemoryRegistrator::setGraphMemoryFootprint(Nd4jIndex hash, Nd4jIndex bytes) {
-            _lock.lock();
-    
-            _footprint[hash] = bytes;
+            auto &shard = shardOf(hash);
+            std::lock_guard<std::mutex> lock(shard.lock);
 
-            _lock.unlock();
+            shard.footprint[hash] = bytes;
         }
 
         void MemoryRegistrator::setGraphMemoryFootprintIfGreater(Nd4jIndex hash, Nd4jIndex bytes) {
-            _lock.lock();
+            auto &shard = shardOf(hash);
+            std::lock_guard<std::mutex> lock(shard.lock);
 
-            if (_footprint.count(hash) == 0)
-                _footprint[hash] = bytes;
-            else {
-                Nd4jIndex cv = _footprint[hash];
-                if (bytes > cv)
-                    _footprint[hash] = bytes;
-            }
-
-            _lock.unlock();
+            // single lookup: new entry starts from 0, so it's always updated
+            auto &current = shard.footprint[hash];
+            if (bytes > current)
+                current = bytes;
         }
 
         Nd4jIndex MemoryRegistrator::getGraphMemoryFootprint(Nd4jIndex hash) {
-            _lock.lock();
-            
-            Nd4jIndex result = 0L;
-            if (_footprint.count(hash) > 0)
-                result = _footprint[hash];
-        
-            _lock.unlock();
-
-            return result;
+            auto &shard = shardOf(hash);
+            std::lock_guard<std::mutex> lock(shard.lock);
+
+            auto it = shard.footprint.find(hash);
+            return it == shard.footprint.end() ? 0L : it->second;
         }
 
         MemoryRegistrator* MemoryRegistrator::_INSTANCE = 0;
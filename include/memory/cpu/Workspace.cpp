@@ -9,59 +9,198 @@
 #include <atomic>
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include "../Workspace.h"
 #include <helpers/logger.h>
 #include <templatemath.h>
 #include <cstring>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
 
 
 namespace nd4j {
     namespace memory {
+
+        // spilled allocations are linked through this header, placed right before user memory
+        struct SpillHeader {
+            SpillHeader* next;
+        };
+
+        // per-thread sub-arena: [position, limit) range of workspace buffer, valid only for given generation
+        struct ThreadArena {
+            Nd4jIndex generation;
+            Nd4jIndex position;
+            Nd4jIndex limit;
+            Nd4jIndex lastUse;
+        };
+
+        static thread_local ThreadArena _threadArenas[WORKSPACE_ARENA_SLOTS];
+        static thread_local Nd4jIndex _threadArenaUses = 0;
+
+        // arena of given generation, or least recently used one if there's none, so thread switching between workspaces keeps their carves
+        static FORCEINLINE ThreadArena& threadArena(Nd4jIndex generation) {
+            int victim = 0;
+            for (int e = 0; e < WORKSPACE_ARENA_SLOTS; e++) {
+                if (_threadArenas[e].generation == generation) {
+                    victim = e;
+                    break;
+                }
+
+                if (_threadArenas[e].lastUse < _threadArenas[victim].lastUse)
+                    victim = e;
+            }
+
+            _threadArenas[victim].lastUse = ++_threadArenaUses;
+            return _threadArenas[victim];
+        }
+
+        // generations are unique across all workspaces, so arena of destroyed workspace can't match new one
+        static std::atomic<Nd4jIndex> _generations(1);
+
+        static void* alignedMalloc(Nd4jIndex bytes, Nd4jIndex alignment) {
+#ifdef _WIN32
+            return _aligned_malloc((size_t) bytes, (size_t) alignment);
+#else
+            void *ptr = nullptr;
+            if (posix_memalign(&ptr, (size_t) alignment, (size_t) bytes) != 0)
+                return nullptr;
+
+            return ptr;
+#endif
+        }
+
+        static void alignedFree(void *ptr) {
+#ifdef _WIN32
+            _aligned_free(ptr);
+#else
+            free(ptr);
+#endif
+        }
+
         Workspace::Workspace(ExternalWorkspace *external) {
+            resetCounters();
+
             if (external->sizeHost() > 0) {
                 _ptrHost = (char *) external->pointerHost();
                 _ptrDevice = (char *) external->pointerDevice();
 
                 _initialSize = external->sizeHost();
                 _currentSize = external->sizeHost();
-                _offset = 0L;
-                this->_cycleAllocations = 0;
-                this->_spillsSize = 0;
+
+                // we never zero memory we don't own
+                _cleanFrom = _currentSize;
 
                 _externalized = true;
             }
         };
 
-        Workspace::Workspace(Nd4jIndex initialSize) {
-            if (initialSize > 0) {
-                this->_ptrHost = (char *) malloc(initialSize);
+        Workspace::Workspace(Nd4jIndex initialSize, int alignment) {
+            if (alignment < (int) sizeof(void *) || (alignment & (alignment - 1)) != 0)
+                throw std::invalid_argument("Workspace alignment should be power of 2");
 
-                CHECK_ALLOC(this->_ptrHost, "Failed to allocate new workspace");
+            _alignment = alignment;
+            resetCounters();
 
-                memset(this->_ptrHost, 0, initialSize);
+            if (initialSize > 0) {
+                allocateBuffer(initialSize);
                 this->_allocatedHost = true;
             } else
                 this->_allocatedHost = false;
 
             this->_initialSize = initialSize;
             this->_currentSize = initialSize;
+            this->_arenaSize = initialSize >= 16 * WORKSPACE_ARENA_SIZE ? WORKSPACE_ARENA_SIZE : 0L;
+        }
+
+        void Workspace::resetCounters() {
             this->_offset = 0;
+            this->_usedSize = 0;
             this->_cycleAllocations = 0;
             this->_spillsSize = 0;
+            this->_spills = nullptr;
+            this->_generation = _generations++;
+        }
+
+        void Workspace::allocateBuffer(Nd4jIndex bytes) {
+            _mapped = false;
+
+#ifndef _WIN32
+            if (nd4j::Environment::getInstance()->isWorkspaceMmap()) {
+                // pages are committed on first touch only
+                void *ptr = mmap(nullptr, (size_t) bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+                if (ptr != MAP_FAILED) {
+#ifdef MADV_HUGEPAGE
+                    madvise(ptr, (size_t) bytes, MADV_HUGEPAGE);
+#endif
+                    _ptrHost = (char *) ptr;
+                    _mapped = true;
+
+                    // anonymous mappings are zeroed by kernel
+                    _cleanFrom = bytes;
+                    return;
+                }
+
+                nd4j_debug("mmap failed for %lld bytes, falling back to malloc\n", bytes);
+            }
+#endif
+
+            _ptrHost = (char *) alignedMalloc(bytes, _alignment);
+
+            CHECK_ALLOC(_ptrHost, "Failed to allocate new workspace");
+
+            _cleanFrom = 0L;
+        }
+
+        void Workspace::releaseBuffer() {
+            if (!_allocatedHost || _externalized || _ptrHost == nullptr)
+                return;
+
+#ifndef _WIN32
+            if (_mapped) {
+                munmap(_ptrHost, (size_t) _currentSize);
+                return;
+            }
+#endif
+            alignedFree(_ptrHost);
+        }
+
+        void Workspace::freeRetired() {
+            for (auto &v: _retired) {
+#ifndef _WIN32
+                if (v.mapped) {
+                    munmap(v.pointer, (size_t) v.size);
+                    continue;
+                }
+#endif
+                alignedFree(v.pointer);
+            }
+
+            _retired.clear();
         }
 
         void Workspace::init(Nd4jIndex bytes) {
             if (this->_currentSize < bytes) {
-                if (this->_allocatedHost && !_externalized)
-                    free((void *)this->_ptrHost);
+                // arrays might still live in current buffer, so we keep it till the end of the cycle
+                if (_offset.load() > 0 && this->_allocatedHost && !_externalized) {
+                    RetiredBuffer retired = {_ptrHost, _currentSize, _mapped};
+                    _retired.emplace_back(retired);
+                } else
+                    releaseBuffer();
 
-                this->_ptrHost =(char *) malloc(bytes);
+                allocateBuffer(bytes);
 
-                CHECK_ALLOC(this->_ptrHost, "Failed to allocate new workspace");
+                _growths++;
+                _grownBytes += bytes - _currentSize;
 
-                memset(this->_ptrHost, 0, bytes);
+                this->_offset = 0;
                 this->_currentSize = bytes;
                 this->_allocatedHost = true;
+                this->_externalized = false;
+                this->_arenaSize = bytes >= 16 * WORKSPACE_ARENA_SIZE ? WORKSPACE_ARENA_SIZE : 0L;
+                this->_generation = _generations++;
             }
         }
 
@@ -76,24 +215,23 @@ namespace nd4j {
         void Workspace::freeSpills() {
             _spillsSize = 0;
 
-            if (_spills.size() < 1)
-                return;
-
-            for (auto v:_spills)
-                free(v);
-
-            _spills.clear();
+            auto header = reinterpret_cast<SpillHeader *>(_spills.exchange(nullptr));
+            while (header != nullptr) {
+                auto next = header->next;
+                alignedFree(header);
+                header = next;
+            }
         }
 
         Workspace::~Workspace() {
-            if (this->_allocatedHost && !_externalized)
-                free((void *)this->_ptrHost);
+            releaseBuffer();
 
+            freeRetired();
             freeSpills();
         }
 
         Nd4jIndex Workspace::getUsedSize() {
-            return getCurrentOffset();
+            return _usedSize.load();
         }
 
         Nd4jIndex Workspace::getCurrentSize() {
@@ -104,6 +242,65 @@ namespace nd4j {
             return _offset.load();
         }
 
+        int Workspace::getAlignment() {
+            return (int) _alignment;
+        }
+
+        Nd4jIndex Workspace::getNumberOfGrowths() {
+            return _growths;
+        }
+
+        Nd4jIndex Workspace::getGrownBytes() {
+            return _grownBytes;
+        }
+
+        void Workspace::zeroFresh(Nd4jIndex offset, Nd4jIndex numBytes) {
+            // _cleanFrom changes only between cycles, so concurrent callers always zero disjoint ranges
+            Nd4jIndex from = nd4j::math::nd4j_max<Nd4jIndex>(offset, _cleanFrom);
+            Nd4jIndex to = offset + numBytes;
+
+            if (from < to)
+                memset(_ptrHost + from, 0, (size_t) (to - from));
+        }
+
+        Nd4jIndex Workspace::bump(Nd4jIndex numBytes) {
+            auto base = reinterpret_cast<uintptr_t>(_ptrHost);
+            auto mask = (uintptr_t) (_alignment - 1);
+
+            Nd4jIndex current = _offset.load(std::memory_order_relaxed);
+            while (true) {
+                // we align actual address, since external buffers are not guaranteed to be aligned
+                auto start = (Nd4jIndex) (((base + (uintptr_t) current + mask) & ~mask) - base);
+
+                if (start + numBytes > _currentSize)
+                    return -1;
+
+                if (_offset.compare_exchange_weak(current, start + numBytes, std::memory_order_relaxed)) {
+                    // padding is zeroed as well, since next cycle might hand it out
+                    zeroFresh(current, start + numBytes - current);
+                    return start;
+                }
+            }
+        }
+
+        void* Workspace::spill(Nd4jIndex numBytes) {
+            nd4j_debug("Allocating %lld bytes in spills\n", numBytes);
+
+            // header takes whole alignment unit, so user pointer stays aligned
+            auto p = (char *) alignedMalloc(numBytes + _alignment, _alignment);
+
+            CHECK_ALLOC(p, "Failed to allocate new workspace");
+
+            auto header = reinterpret_cast<SpillHeader *>(p);
+            void *head = _spills.load();
+            do {
+                header->next = reinterpret_cast<SpillHeader *>(head);
+            } while (!_spills.compare_exchange_weak(head, (void *) header));
+
+            _spillsSize += numBytes;
+
+            return p + _alignment;
+        }
 
         void* Workspace::allocateBytes(Nd4jIndex numBytes) {
             if (numBytes < 1) {
@@ -111,35 +308,50 @@ namespace nd4j {
                 throw std::invalid_argument("Number of bytes for allocation should be positive");
             }
 
-            //numBytes += 32;
-            void* result = nullptr;
-            this->_cycleAllocations += numBytes;
-            this->_mutexAllocation.lock();
-
-            if (_offset.load() + numBytes > _currentSize) {
-                nd4j_debug("Allocating %lld bytes in spills\n", numBytes);
-                this->_mutexAllocation.unlock();
+            Nd4jIndex alignedBytes = (numBytes + _alignment - 1) & ~(_alignment - 1);
 
-                void *p = malloc(numBytes);
+            if (_ptrHost == nullptr) {
+                this->_cycleAllocations += alignedBytes;
+                return spill(numBytes);
+            }
 
-                CHECK_ALLOC(p, "Failed to allocate new workspace");
+            // small allocations are served from thread's own sub-arena, without touching shared offset
+            if (_arenaSize > 0 && alignedBytes <= _arenaSize / 8) {
+                Nd4jIndex generation = _generation.load();
+                auto &arena = threadArena(generation);
+
+                if (arena.generation != generation || arena.position + alignedBytes > arena.limit) {
+                    Nd4jIndex start = bump(_arenaSize);
+                    if (start >= 0) {
+                        arena.generation = generation;
+                        arena.position = start;
+                        arena.limit = start + _arenaSize;
+
+                        // leftover of previous carve is abandoned, so whole carve is counted
+                        this->_cycleAllocations += _arenaSize;
+                    }
+                }
+
+                if (arena.generation == generation && arena.position + alignedBytes <= arena.limit) {
+                    void *result = (void *)(_ptrHost + arena.position);
+                    arena.position += alignedBytes;
+                    _usedSize += numBytes;
+
+                    return result;
+                }
+            }
 
-                _mutexSpills.lock();
-                _spills.push_back(p);
-                _mutexSpills.unlock();
+            this->_cycleAllocations += alignedBytes;
 
-                _spillsSize += numBytes;
+            Nd4jIndex start = bump(numBytes);
+            if (start < 0)
+                return spill(numBytes);
 
-                return p;
-            }
+            _usedSize += numBytes;
 
-            result = (void *)(_ptrHost + _offset.load());
-            _offset += numBytes;
-            //memset(result, 0, (int) numBytes);
+            void *result = (void *)(_ptrHost + start);
 
-            nd4j_debug("Allocating %lld bytes from workspace; Current PTR: %p; Current offset: %lld\n", numBytes, result, _offset.load());
-
-            this->_mutexAllocation.unlock();
+            nd4j_debug("Allocating %lld bytes from workspace; Current PTR: %p; Current offset: %lld\n", numBytes, result, start + numBytes);
 
             return result;
         }
@@ -150,12 +362,22 @@ namespace nd4j {
 
         void Workspace::scopeIn() {
             freeSpills();
-            init(_cycleAllocations.load());
+            freeRetired();
+
+            // geometric growth: if this cycle didn't fit, next ones will probably need a bit more as well
+            Nd4jIndex required = _cycleAllocations.load();
+            if (required > _currentSize)
+                required = nd4j::math::nd4j_max<Nd4jIndex>(required, _currentSize * 2);
+
+            init(required);
             _cycleAllocations = 0;
         }
 
         void Workspace::scopeOut() {
+            _cleanFrom = nd4j::math::nd4j_max<Nd4jIndex>(_cleanFrom, _offset.load());
             _offset = 0;
+            _usedSize = 0;
+            _generation = _generations++;
         }
 
         Nd4jIndex Workspace::getSpilledSize() {
@@ -171,9 +393,8 @@ namespace nd4j {
 
         Workspace* Workspace::clone() {
             // for clone we take whatever is higher: current allocated size, or allocated size of current loop
-            Workspace* res = new Workspace(nd4j::math::nd4j_max<Nd4jIndex >(this->getCurrentSize(), this->_cycleAllocations.load()));
+            Workspace* res = new Workspace(nd4j::math::nd4j_max<Nd4jIndex >(this->getCurrentSize(), this->_cycleAllocations.load()), (int) _alignment);
             return res;
         }
     }
 }
-
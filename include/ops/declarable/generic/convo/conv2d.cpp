@@ -58,12 +58,26 @@ CUSTOM_OP_IMPL(conv2d, 2, 1, false, 0, 9) {
     if(isSameMode)                       // SAME        
         ConvolutionUtils<T>::_calcPadding2D(pH, pW, oH, oW, iH, iW, kH, kW, sH, sW, dH, dW);
 
-    NDArray<T> columns(input->ordering(), {bS, iC, kH, kW, oH, oW}, block.getWorkspace());        
-
     //----- calculation of output -----//
-    std::vector<T> extrasIm2Col({(T) kH, (T) kW, (T) sH, (T) sW, (T) pH, (T) pW, (T) dH, (T) dW});
-    input->template applyTransform<simdOps::Im2col<T>>(&columns, extrasIm2Col.data());                          // [bS, iC, iH, iW] is convoluted to [bS, iC, kH, kW, oH, oW]
-    nd4j::NDArrayFactory<T>::tensorDot(&columns, weights, output, {1,2,3}, weightsAxesForDot, permutForOutput); // [bS, iC, kH, kW, oH, oW] x [kH, kW, iC, oC]/[oC, iC, kH, kW] = [bS, oH, oW, oC]
+    const ConvAlgorithm algorithm = ConvolutionUtils<T>::conv2dAlgorithm(iC, oC, oH, oW, kH, kW, sH, sW, dH, dW);
+    if(algorithm != CONV_IM2COL) {
+        NDArray<T>* weightsOIHW = isNCHW ? weights : weights->permute({3, 2, 0, 1});      // [kH, kW, iC, oC] -> [oC, iC, kH, kW] if NHWC
+        NDArray<T>* outputNCHW  = isNCHW ? output  : output->permute({0, 3, 1, 2});       // [bS, oH, oW, oC] -> [bS, oC, oH, oW] if NHWC
+
+        ConvolutionUtils<T>::conv2d(algorithm, *input, *weightsOIHW, *outputNCHW, kH, kW, sH, sW, pH, pW, dH, dW, block.getWorkspace());
+
+        if(!isNCHW) {
+            delete weightsOIHW;
+            delete outputNCHW;
+        }
+    }
+    else {
+        NDArray<T> columns(input->ordering(), {bS, iC, kH, kW, oH, oW}, block.getWorkspace());
+
+        std::vector<T> extrasIm2Col({(T) kH, (T) kW, (T) sH, (T) sW, (T) pH, (T) pW, (T) dH, (T) dW});
+        input->template applyTransform<simdOps::Im2col<T>>(&columns, extrasIm2Col.data());                          // [bS, iC, iH, iW] is convoluted to [bS, iC, kH, kW, oH, oW]
+        nd4j::NDArrayFactory<T>::tensorDot(&columns, weights, output, {1,2,3}, weightsAxesForDot, permutForOutput); // [bS, iC, kH, kW, oH, oW] x [kH, kW, iC, oC]/[oC, iC, kH, kW] = [bS, oH, oW, oC]
+    }
 
     //----- add biases if required -----//
     if(bias)
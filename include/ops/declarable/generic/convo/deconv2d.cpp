@@ -51,14 +51,27 @@ namespace nd4j {
             if(isSameMode)                       // SAME        
                 ConvolutionUtils<T>::_calcPadding2D(pH, pW, oH, oW, iH, iW, kH, kW, sH, sW, dH, dW);                
             
-            NDArray<T> columns(input->ordering(), {bS, oC, kH, kW, iH, iW}, block.getWorkspace());        
-            std::vector<T> extrasCol2Im({(T) sH, (T) sW, (T) pH, (T) pW, (T) oH, (T) oW, (T) dH, (T) dW});          
-
             //----- calculation of output -----//
-            // NHWC: [kH, kW, oC, iC] x [bS, iH, iW, iC] = [kH, kW, oC, bS, iH, iW]
-            // NCHW: [iC, oC, kH, kW] x [bS, iC, iH, iW] = [oC, kH, kW, bS, iH, iW]
-            nd4j::NDArrayFactory<T>::tensorDot(weights, input, &columns, {indWiC}, {indIOioC}, permutForColumns);  
-            columns.template applyTransform<simdOps::Col2Im<T>>(output, extrasCol2Im.data());                            // [bS, oC, kH, kW, iH, iW] is de-convoluted to [bS, oC, oH, oW]
+            if(kH == 1 && kW == 1 && sH == 1 && sW == 1 && pH == 0 && pW == 0) {
+                // 1x1 deconvolution is 1x1 convolution with transposed weights, so no columns are needed
+                NDArray<T>* inputNCHW   = isNCHW ? input : input->permute({0, 3, 1, 2});                     // [bS, iH, iW, iC] -> [bS, iC, iH, iW]
+                NDArray<T>* weightsOIHW = isNCHW ? weights->permute({1, 0, 2, 3}) : weights->permute({2, 3, 0, 1}); // [iC, oC, kH, kW] / [kH, kW, oC, iC] -> [oC, iC, kH, kW]
+
+                ConvolutionUtils<T>::conv2d(CONV_DIRECT, *inputNCHW, *weightsOIHW, *output, kH, kW, sH, sW, pH, pW, dH, dW, block.getWorkspace());
+
+                if(!isNCHW)
+                    delete inputNCHW;
+                delete weightsOIHW;
+            }
+            else {
+                NDArray<T> columns(input->ordering(), {bS, oC, kH, kW, iH, iW}, block.getWorkspace());
+                std::vector<T> extrasCol2Im({(T) sH, (T) sW, (T) pH, (T) pW, (T) oH, (T) oW, (T) dH, (T) dW});
+
+                // NHWC: [kH, kW, oC, iC] x [bS, iH, iW, iC] = [kH, kW, oC, bS, iH, iW]
+                // NCHW: [iC, oC, kH, kW] x [bS, iC, iH, iW] = [oC, kH, kW, bS, iH, iW]
+                nd4j::NDArrayFactory<T>::tensorDot(weights, input, &columns, {indWiC}, {indIOioC}, permutForColumns);
+                columns.template applyTransform<simdOps::Col2Im<T>>(output, extrasCol2Im.data());                            // [bS, oC, kH, kW, iH, iW] is de-convoluted to [bS, oC, oH, oW]
+            }
            
             //----- add biases if required -----//
             if(bias)
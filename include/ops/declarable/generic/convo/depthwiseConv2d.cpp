@@ -44,39 +44,31 @@ CUSTOM_OP_IMPL(depthwise_conv2d, 2, 1, false, 0, 9) {
     if (bias)
         REQUIRE_TRUE(bias->rankOf() <= 2 && oC == bias->lengthOf(), 0, "CUSTOM DEPTHWISECONV2D OP: wrong shape of array with biases, expected rank, length: <=2, %i, but got %i, %i instead !", oC, bias->rankOf(), bias->lengthOf());
     
-    std::vector<std::vector<int>> modifColumns = {{1,0,4,5,2,3}, {iC,bS*oH*oW,kH*kW}};  // [bS,iC,kH,kW,oH,oW] -> [iC,bS,oH,oW,kH,kW] -> [iC,bS*oH*oW,kH*kW]
-    std::vector<std::vector<int>> modifWeights, modifOutput;
-    std::vector<int> outReShape;
-
-    if(!isNCHW) {        
-        input = input->permute({0, 3, 1, 2});                                           // [bS,iH,iW,iC]    -> [bS,iC,iH,iW] 
-        outReShape = {bS, oH, oW, iC, mC};                                              // [bS,oH,oW,iC*mC] -> [bS,oH,oW,iC,mC]
-        modifOutput = {{3,0,1,2,4},{iC, bS*oH*oW, mC}};                                 // [bS,oH,oW,iC,mC] -> [iC,bS,oH,oW,mC] -> [iC,bS*oH*oW,mC]
-        modifWeights = {{2,0,1,3},{iC,kH*kW,mC}};                                       // [kH,kW,iC,mC]    -> [iC,kH,kW,mC]    -> [iC,kH*kW,mC]
-    }
-    else {
-        outReShape = {bS, iC, mC, oH, oW};                                              // [bS,iC*mC,oH,oW] -> [bS,iC,mC,oH,oW]
-        modifOutput = {{1,0,3,4,2},{iC, bS*oH*oW, mC}};                                 // [bS,iC,mC,oH,oW] -> [iC,bS,oH,oW,mC] -> [iC,bS*oH*oW,mC]
-        modifWeights = {{1,2,3,0},{iC,kH*kW,mC}};                                       // [mC,iC,kH,kW]    -> [iC,kH,kW,mC]    -> [iC,kH*kW,mC]           
+    NDArray<T>* weightsIMHW;
+    NDArray<T>* outputNCHW = output;
+    if(!isNCHW) {
+        input = input->permute({0, 3, 1, 2});                                           // [bS,iH,iW,iC]    -> [bS,iC,iH,iW]
+        outputNCHW = output->permute({0, 3, 1, 2});                                     // [bS,oH,oW,iC*mC] -> [bS,iC*mC,oH,oW]
+        weightsIMHW = weights->permute({2, 3, 0, 1});                                   // [kH,kW,iC,mC]    -> [iC,mC,kH,kW]
     }
+    else
+        weightsIMHW = weights->permute({1, 0, 2, 3});                                   // [mC,iC,kH,kW]    -> [iC,mC,kH,kW]
 
     if(isSameMode)                       // SAME        
         ConvolutionUtils<T>::_calcPadding2D(pH, pW, oH, oW, iH, iW, kH, kW, sH, sW, dH, dW);
 
-    NDArray<T> columns(input->ordering(), {bS, iC, kH, kW, oH, oW}, block.getWorkspace());                
-    NDArray<T>* outputReshaped = output->reshape(output->ordering(), outReShape);
-    std::vector<T> extrasIm2Col({(T) kH, (T) kW, (T) sH, (T) sW, (T) pH, (T) pW, (T) dH, (T) dW});
-
-    input->template applyTransform<simdOps::Im2col<T>>(&columns, extrasIm2Col.data());                                 // [bS, iC, iH, iW] is convoluted to [bS, iC, kH, kW, oH, oW]    
-    nd4j::NDArrayFactory<T>::tensorDot(&columns, weights, outputReshaped, modifColumns, modifWeights, modifOutput);    // [iC, bS*oH*oW, kW*kH] x [iC, kH*kW, mC] = [iC, bS*oH*oW, mC]
+    // each output channel is convolved with its own input channel only, so it's computed directly instead of per-channel GEMMs over columns
+    ConvolutionUtils<T>::depthwiseConv2dDirect(*input, *weightsIMHW, *outputNCHW, kH, kW, sH, sW, pH, pW, dH, dW);
     
     if(bias)
         output->template applyBroadcast<simdOps::Add<T>>({indIOioC}, bias);
 
-    if(!isNCHW)
-        delete input;                  
+    if(!isNCHW) {
+        delete input;
+        delete outputNCHW;
+    }
     
-    delete outputReshaped;
+    delete weightsIMHW;
 
     return Status::OK();
 }
@@ -4,75 +4,48 @@
 
 #include <ops/declarable/CustomOperations.h>
 #include <ops/declarable/generic/helpers/convolutions.h>
+#include <ops/declarable/helpers/pooling2d.h>
 
 namespace nd4j {
     namespace ops {
         CUSTOM_OP_IMPL(avgpool2d, 1, 1, false, 0, 11) {
 
             NDArray<T> *x = INPUT_VARIABLE(0);
+            auto z = OUTPUT_VARIABLE(0);
 
             REQUIRE_TRUE(x->rankOf() == 4, 0, "Input should have rank of 4, but got %i instead", x->rankOf());
 
-            // 0,1 - kernel Height/Width; 2,3 - stride Height/Width; 4,5 - pad Height/Width; 6,7 - dilation Height/Width; 8 - same mode;
+            // 0,1 - kernel Height/Width; 2,3 - stride Height/Width; 4,5 - pad Height/Width; 6,7 - dilation Height/Width; 8 - same mode; 9 - divisor mode: 0 - padding excluded, 1 - included; 10 - data format;
             std::vector<int> argI = *(block.getIArguments());
-            auto z = OUTPUT_VARIABLE(0);
-
-            int kY = argI[0];
-            int kX = argI[1];
-
-            int sY = argI[2];
-            int sX = argI[3];
 
-            int pY = argI[4];
-            int pX = argI[5];
-
-            int dY = argI[6];
-            int dX = argI[7];
-
-            int oY = 0;
-            int oX = 0;
+            int kH = argI[0];
+            int kW = argI[1];
+            int sH = argI[2];
+            int sW = argI[3];
+            int pH = argI[4];
+            int pW = argI[5];
+            int dH = argI[6];
+            int dW = argI[7];
+            const bool isSameMode = INT_ARG(8) > 0;
 
             bool isNCHW = true;
             if (block.getIArguments()->size() > 10)
                 isNCHW = INT_ARG(10) == 0;
 
-            const int inY = isNCHW ? x->sizeAt(2) : x->sizeAt(1);
-            const int inX = isNCHW ? x->sizeAt(3) : x->sizeAt(2);
-
-            if (!isNCHW) {
-                x = x->permute({0, 3, 1, 2});
-
-                // FIXME: eventually we want NWHC impl
-                z->permutei({0, 3, 1, 2});
-                z->streamline('c');
-            }
-
-            const bool isSameMode = INT_ARG(8) > 0;
-
-            ConvolutionUtils<T>::calcOutSizePool2D(oY, oX, kY, kX, sY, sX, pY, pX, dY, dX, inY, inX, isSameMode);
+            const int iH = isNCHW ? x->sizeAt(2) : x->sizeAt(1);
+            const int iW = isNCHW ? x->sizeAt(3) : x->sizeAt(2);
 
-            if (isSameMode) {
-                ConvolutionUtils<T>::_calcPadding2D(pY, pX, oY, oX, inY, inX, argI[0], argI[1],
-                                                    argI[2], argI[3], argI[6], argI[7]);
-            }
-
-            // 0,1 - kernel Height/Width; 2,3 - stride Height/Width; 4,5 - pad Height/Width; 6,7 - dilation Height/Width; 8,9 - poolingMode; 10 - divisor;
-            std::vector<T> argT = {(T) kY, (T) kX, (T) sY, (T) sX, (T) pY, (T) pX, (T) dY, (T)dX, (T)1.f, (T)1.f, (T) argI[9], (T) oY, (T) oX};
+            int oH, oW;
+            ConvolutionUtils<T>::calcOutSizePool2D(oH, oW, kH, kW, sH, sW, pH, pW, dH, dW, iH, iW, isSameMode);
 
+            if (isSameMode)
+                ConvolutionUtils<T>::_calcPadding2D(pH, pW, oH, oW, iH, iW, kH, kW, sH, sW, dH, dW);
 
-            x->template applyTransform<simdOps::Pooling2D<T>>(z, argT.data());
+            // both layouts are handled in place, so NHWC input isn't permuted and copied anymore
+            helpers::pooling2d(*x, *z, kH, kW, sH, sW, pH, pW, dH, dW, 1, (T) argI[9], isNCHW);
 
             STORE_RESULT(*z);
 
-            if (!isNCHW) {
-                delete x;
-                z->permutei({0, 2, 3, 1});
-                z->streamline('c');
-
-                //z->printShapeInfo("avg pool shape");
-                //z->printIndexedBuffer("avg pool final");
-            }
-
             return ND4J_STATUS_OK;
         }
 
@@ -141,6 +114,7 @@ namespace nd4j {
             REQUIRE_TRUE(input->rankOf() == 4, 0, "Input should have rank of 4, but got %i instead", input->rankOf());
             NDArray<T>* epsilon = INPUT_VARIABLE(1);
             NDArray<T>* outEpsilon = OUTPUT_VARIABLE(0);
+            // 0,1 - kernel Height/Width; 2,3 - stride Height/Width; 4,5 - pad Height/Width; 6,7 - dilation Height/Width; 8 - same mode; 9 - divisor mode; 10 - data format;
             std::vector<int> argI = *(block.getIArguments());
 
             int kH = argI[0];
@@ -152,67 +126,29 @@ namespace nd4j {
             int dH = argI[6];
             int dW = argI[7];
             int isSameMode = argI[8];
+            bool isNCHW = true;
+            if (block.getIArguments()->size() > 10)
+                isNCHW = INT_ARG(10) == 0;
 
-            int bS = input->getShapeInfo()[1];
-            int iD = input->getShapeInfo()[2];
-            int iH = input->getShapeInfo()[3];
-            int iW = input->getShapeInfo()[4];
+            const int iH = isNCHW ? input->sizeAt(2) : input->sizeAt(1);
+            const int iW = isNCHW ? input->sizeAt(3) : input->sizeAt(2);
 
             // calculate output Height/Width
             int oH, oW;
             ConvolutionUtils<T>::calcOutSizePool2D(oH, oW, kH, kW, sH, sW, pH, pW, dH, dW, iH, iW, isSameMode);
 
-            bool cOrderStrides = false;
-            bool isEpsilonDup = false;
-            if (epsilon->ordering() != 'c') {
-                epsilon = epsilon->dup('c');
-                cOrderStrides = true;
-                isEpsilonDup = true;
-            }
-
-            int strideToCompare[] = {oH*oW, iD*oH*oW, oW, 1};
-            if (!cOrderStrides && shape::strideDescendingCAscendingF(epsilon->getShapeInfo())) {
-                cOrderStrides = true;
-            }
-            else if (!shape::strideEquals(strideToCompare, 4, epsilon->stridesOf(), epsilon->rankOf())) {
-                epsilon = epsilon->dup('c');
-                cOrderStrides = true;
-                isEpsilonDup = true;
-            }
-
-            NDArray<T>* col6d = nullptr;
-            NDArray<T>* col6dPermuted = nullptr;
-            NDArray<T>* epsilon1d = nullptr;
+            if (isSameMode)
+                ConvolutionUtils<T>::_calcPadding2D(pH, pW, oH, oW, iH, iW, kH, kW, sH, sW, dH, dW);
 
-            if (cOrderStrides) {
-                col6d = new NDArray<T>('c', {bS, iD, oH, oW, kH, kW}, block.getWorkspace());
-                col6dPermuted = col6d->permute({0, 1, 4, 5, 2, 3});
-                epsilon1d = epsilon->reshape('c', {(int) epsilon->lengthOf(), 1}); //zero copy reshape
-            }
-            else {
-                col6d = new NDArray<T>('c', {iD, bS, oH, oW, kH, kW}, block.getWorkspace());
-                col6dPermuted = col6d->permute({1, 0, 4, 5, 2, 3});
-                NDArray<T>* epsilonTemp = epsilon->permute({1, 0, 2, 3});
-                epsilon1d = epsilonTemp->reshape('c', {(int) epsilon->lengthOf(), 1}); //Should be a zero-copy reshape always
-                delete epsilonTemp;
-            }
+            REQUIRE_TRUE(epsilon->sizeAt(isNCHW ? 2 : 1) == oH && epsilon->sizeAt(isNCHW ? 3 : 2) == oW, 0, "Epsilon should have spatial shape [%i, %i], but got [%i, %i] instead", oH, oW, epsilon->sizeAt(isNCHW ? 2 : 1), epsilon->sizeAt(isNCHW ? 3 : 2));
 
-            NDArray<T>* col2d = col6d->reshape('c', {bS*iD*oH*oW, kH*kW});
-            col2d->addiColumnVector(epsilon1d);
+            // divisor includes padding unless told otherwise, same as before
+            const int divisorMode = argI.size() > 9 ? argI[9] : 1;
 
-            T extraParams3[] = {(T)sH, (T)sW, (T)pH, (T)pW, (T)iH, (T)iW, (T)dH, (T)dW};   			// ??? zeros
-            col6dPermuted->template applyTransform<simdOps::Col2Im<T>>(outEpsilon, extraParams3);
-            outEpsilon->template applyScalar<simdOps::Divide<T>>((T) kH*kW, outEpsilon);
+            helpers::pooling2dBP(*input, *epsilon, *outEpsilon, kH, kW, sH, sW, pH, pW, dH, dW, 1, (T) divisorMode, (T) 0.0f, isNCHW);
 
             STORE_RESULT(*outEpsilon);
 
-            if(isEpsilonDup)
-                delete epsilon;
-            delete col6d;
-            delete col6dPermuted;
-            delete epsilon1d;
-            delete col2d;
-
             return ND4J_STATUS_OK;
         }
 
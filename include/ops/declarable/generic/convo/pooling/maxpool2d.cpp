@@ -4,7 +4,7 @@
 
 #include <ops/declarable/CustomOperations.h>
 #include <ops/declarable/generic/helpers/convolutions.h>
-#include <ops/declarable/helpers/max_pooling.h>
+#include <ops/declarable/helpers/pooling2d.h>
 
 namespace nd4j {
     namespace ops {
@@ -14,7 +14,7 @@ namespace nd4j {
             REQUIRE_TRUE(input->rankOf() == 4, 0, "Input should have rank of 4, but got %i instead", input->rankOf());
             NDArray<T>* epsilon = INPUT_VARIABLE(1);
             NDArray<T>* outEpsilon = this->getZ(block);
-            // 0,1 - kernel Height/Width; 2,3 - stride Height/Width; 4,5 - pad Height/Width; 6,7 - dilation Height/Width; 8 - same mode;
+            // 0,1 - kernel Height/Width; 2,3 - stride Height/Width; 4,5 - pad Height/Width; 6,7 - dilation Height/Width; 8 - same mode; 10 - data format;
             std::vector<int> argI = *(block.getIArguments());
 
             int kH = argI[0];
@@ -30,71 +30,22 @@ namespace nd4j {
             if (block.getIArguments()->size() > 10)
                 isNCHW = INT_ARG(10) == 0;
 
-            int bS = input->getShapeInfo()[1];
-            int iD = input->getShapeInfo()[2];
-            int iH = input->getShapeInfo()[3];
-            int iW = input->getShapeInfo()[4];
+            const int iH = isNCHW ? input->sizeAt(2) : input->sizeAt(1);
+            const int iW = isNCHW ? input->sizeAt(3) : input->sizeAt(2);
 
             // calculate output Height/Width
             int oH, oW;
             ConvolutionUtils<T>::calcOutSizePool2D(oH, oW, kH, kW, sH, sW, pH, pW, dH, dW, iH, iW, isSameMode);
 
-            bool cOrderStrides = false;
-            bool isEpsilonDup = false;
-            if (epsilon->ordering() != 'c') {
-                epsilon->streamline('c');
-                cOrderStrides = true;
-                isEpsilonDup = true;
-            }
-
-            int strideToCompare[] = {oH*oW, iD*oH*oW, oW, 1};
-            if (!cOrderStrides && shape::strideDescendingCAscendingF(epsilon->getShapeInfo())) {
-                cOrderStrides = true;
-            }
-            else if (!shape::strideEquals(strideToCompare, 4, epsilon->stridesOf(), epsilon->rankOf())) {
-                epsilon = epsilon->dup('c');
-                cOrderStrides = true;
-                isEpsilonDup = true;
-            }
-
-            NDArray<T>* col6d = nullptr;
-            NDArray<T>* col6dPermuted = nullptr;
-            NDArray<T>* epsilon1d = nullptr;
-
-            if (cOrderStrides) {
-                col6d = new NDArray<T>('c', {bS, iD, oH, oW, kH, kW}, block.getWorkspace());
-                col6dPermuted = col6d->permute({0, 1, 4, 5, 2, 3});
-                epsilon1d = epsilon->reshape('c', {(int) epsilon->lengthOf(), 1}); //zero copy reshape
-            }
-            else {
-                col6d = new NDArray<T>('c', {iD, bS, oH, oW, kH, kW}, block.getWorkspace());
-                col6dPermuted = col6d->permute({1, 0, 4, 5, 2, 3});
-                NDArray<T>* epsilonTemp = epsilon->permute({1, 0, 2, 3});
-                epsilon1d = epsilonTemp->reshape('c', {(int) epsilon->lengthOf(), 1}); //Should be a zero-copy reshape always
-                delete epsilonTemp;
-            }
+            if (isSameMode)
+                ConvolutionUtils<T>::_calcPadding2D(pH, pW, oH, oW, iH, iW, kH, kW, sH, sW, dH, dW);
 
-            NDArray<T>* col2d = col6d->reshape('c', {bS*iD*oH*oW, kH*kW});
+            REQUIRE_TRUE(epsilon->sizeAt(isNCHW ? 2 : 1) == oH && epsilon->sizeAt(isNCHW ? 3 : 2) == oW, 0, "Epsilon should have spatial shape [%i, %i], but got [%i, %i] instead", oH, oW, epsilon->sizeAt(isNCHW ? 2 : 1), epsilon->sizeAt(isNCHW ? 3 : 2));
 
-            T extraParams1[] = {(T)kH, (T)kW, (T)sH, (T)sW, (T)pH, (T)pW, (T)dH, (T)dW, (T)0.0};
-            input->template applyTransform<simdOps::Im2col<T>>(col6dPermuted, extraParams1);
+            // each gradient value goes straight to max element of its window
+            helpers::pooling2dBP(*input, *epsilon, *outEpsilon, kH, kW, sH, sW, pH, pW, dH, dW, 0, (T) 1.0f, (T) 0.0f, isNCHW);
 
-            //FIXME: this op should be moved to CustomOps
-            T extraParams2[] = {(T)1.f, (T)1.f};
-            col2d->template applyTransform<simdOps::IsMax<T>>(extraParams2);
-            col2d->muliColumnVector(epsilon1d);
-
-            T extraParams3[] = {(T) sH, (T)sW, (T)pH, (T)pW, (T)iH, (T)iW, (T)dH, (T)dW};   			// ??? zeros
-            col6dPermuted->template applyTransform<simdOps::Col2Im<T>>(outEpsilon, extraParams3);
-
-            STORE_RESULT(*outEpsilon);		// ???
-
-            //if(isEpsilonDup)
-                //delete epsilon;
-            delete col6d;
-            delete col6dPermuted;
-            delete epsilon1d;
-            delete col2d;
+            STORE_RESULT(*outEpsilon);
 
             return ND4J_STATUS_OK;
         }
@@ -120,36 +71,36 @@ namespace nd4j {
 
             REQUIRE_TRUE(x->rankOf() == 4, 0, "Input should have rank of 4, but got %i instead", x->rankOf());
 
+            // 0,1 - kernel Height/Width; 2,3 - stride Height/Width; 4,5 - pad Height/Width; 6,7 - dilation Height/Width; 8 - same mode; 9 - unused; 10 - data format;
+            std::vector<int> argI = *(block.getIArguments());
+
+            int kH = argI[0];
+            int kW = argI[1];
+            int sH = argI[2];
+            int sW = argI[3];
+            int pH = argI[4];
+            int pW = argI[5];
+            int dH = argI[6];
+            int dW = argI[7];
+            const bool isSameMode = INT_ARG(8) > 0;
+
             bool isNCHW = true;
             if (block.getIArguments()->size() > 10)
                 isNCHW = INT_ARG(10) == 0;
 
-            if (!isNCHW) {
-                x = x->permute({0, 3, 1, 2});
-                //x = x->dup('c');
-
-                // FIXME: eventually we want NWHC impl
-                z->permutei({0, 3, 1, 2});
-                z->streamline('c');
-            }
-        
-
-            std::vector<int> argI = *(block.getIArguments());
+            const int iH = isNCHW ? x->sizeAt(2) : x->sizeAt(1);
+            const int iW = isNCHW ? x->sizeAt(3) : x->sizeAt(2);
 
-            helpers::maxPoolingFunctor(x, z, argI, (NDArray<T>*)nullptr);
-            STORE_RESULT(*z);
+            int oH, oW;
+            ConvolutionUtils<T>::calcOutSizePool2D(oH, oW, kH, kW, sH, sW, pH, pW, dH, dW, iH, iW, isSameMode);
 
-            //z->printShapeInfo("MaxPool2D result shape");
-            
-            if (!isNCHW) {
-                delete x;
+            if (isSameMode)
+                ConvolutionUtils<T>::_calcPadding2D(pH, pW, oH, oW, iH, iW, kH, kW, sH, sW, dH, dW);
 
-                z->permutei({0, 2, 3, 1});
-                z->streamline('c');
+            // both layouts are handled in place, so NHWC input isn't permuted and copied anymore
+            helpers::pooling2d(*x, *z, kH, kW, sH, sW, pH, pW, dH, dW, 0, (T) 1.0f, isNCHW);
 
-                //z->printShapeInfo("max pool shape");
-                //z->printIndexedBuffer("maxpool final");
-            }
+            STORE_RESULT(*z);
 
             return ND4J_STATUS_OK;
         }
@@ -4,6 +4,7 @@
 
 #include <ops/declarable/CustomOperations.h>
 #include <ops/declarable/generic/helpers/convolutions.h>
+#include <ops/declarable/helpers/pooling2d.h>
 
 namespace nd4j {
     namespace ops {
@@ -16,63 +17,37 @@ namespace nd4j {
 
             REQUIRE_TRUE(x->rankOf() == 4, 0, "Input should have rank of 4, but got %i instead", x->rankOf());
 
-            std::vector<int> argI = *(block.getIArguments()); // 0,1 - kernel Height/Width; 2,3 - stride Height/Width; 4,5 - pad Height/Width; 6,7 - dilation Height/Width; 8 - same mode; 9 - extraParam0 for pnorm case;
-
-            int kY = argI[0];
-            int kX = argI[1];
-
-            int sY = argI[2];
-            int sX = argI[3];
-
-            int pY = argI[4];
-            int pX = argI[5];
-
-            int dY = argI[6];
-            int dX = argI[7];
-
-            int oY = 0;
-            int oX = 0;
+            // 0,1 - kernel Height/Width; 2,3 - stride Height/Width; 4,5 - pad Height/Width; 6,7 - dilation Height/Width; 8 - same mode; 9 - p; 10 - data format;
+            std::vector<int> argI = *(block.getIArguments());
 
+            int kH = argI[0];
+            int kW = argI[1];
+            int sH = argI[2];
+            int sW = argI[3];
+            int pH = argI[4];
+            int pW = argI[5];
+            int dH = argI[6];
+            int dW = argI[7];
             const bool isSameMode = INT_ARG(8) > 0;
 
             bool isNCHW = true;
             if (block.getIArguments()->size() > 10)
                 isNCHW = INT_ARG(10) == 0;
 
-            const int inY = isNCHW ? x->sizeAt(2) : x->sizeAt(1);
-            const int inX = isNCHW ? x->sizeAt(3) : x->sizeAt(2);
-
-            if (!isNCHW) {
-                x = x->permute({0, 3, 1, 2});
-
-                // FIXME: eventually we want NWHC impl
-                auto tz = z->permute({0, 3, 1, 2});
-                z = tz->dup('c');
+            const int iH = isNCHW ? x->sizeAt(2) : x->sizeAt(1);
+            const int iW = isNCHW ? x->sizeAt(3) : x->sizeAt(2);
 
-                delete tz;
-            }
-
-            ConvolutionUtils<T>::calcOutSizePool2D(oY, oX, kY, kX, sY, sX, pY, pX, dY, dX, inY, inX, isSameMode);
-
-            if (isSameMode) {
-                ConvolutionUtils<T>::_calcPadding2D(pY, pX, oY, oX, inY, inX, argI[0], argI[1],
-                                                    argI[2], argI[3], argI[6], argI[7]);
-            }
+            int oH, oW;
+            ConvolutionUtils<T>::calcOutSizePool2D(oH, oW, kH, kW, sH, sW, pH, pW, dH, dW, iH, iW, isSameMode);
 
-            std::vector<T> argT = {(T) kY, (T) kX, (T) sY, (T) sX, (T) pY, (T) pX, (T) dY, (T)dX, (T)1.f, (T)2.f, (T) argI[9], (T) oY, (T) oX};
+            if (isSameMode)
+                ConvolutionUtils<T>::_calcPadding2D(pH, pW, oH, oW, iH, iW, kH, kW, sH, sW, dH, dW);
 
-            x->template applyTransform<simdOps::Pooling2D<T>>(z, argT.data());
+            // both layouts are handled in place, so NHWC input isn't permuted and copied anymore
+            helpers::pooling2d(*x, *z, kH, kW, sH, sW, pH, pW, dH, dW, 2, (T) argI[9], isNCHW);
 
             STORE_RESULT(*z);
 
-            if (!isNCHW) {
-                delete x;
-                z->permutei({0, 2, 3, 1});
-
-                //z->printShapeInfo("pnorm pool shape");
-                //z->printIndexedBuffer("pnorm pool final");
-            }
-
             return ND4J_STATUS_OK;
         }
         DECLARE_SYN(PnormPool2D, pnormpool2d);
@@ -136,8 +111,11 @@ namespace nd4j {
             auto input = INPUT_VARIABLE(0);
             auto epsilon = INPUT_VARIABLE(1);
             auto outEpsilon = OUTPUT_VARIABLE(0);
+
+            REQUIRE_TRUE(input->rankOf() == 4, 0, "Input should have rank of 4, but got %i instead", input->rankOf());
+
+            // 0,1 - kernel Height/Width; 2,3 - stride Height/Width; 4,5 - pad Height/Width; 6,7 - dilation Height/Width; 8 - same mode; 9 - p; 10 - data format;
             std::vector<int> argI = *(block.getIArguments());
-            std::vector<T>   argT = *(block.getTArguments());
 
             int kH = argI[0];
             int kW = argI[1];
@@ -148,101 +126,29 @@ namespace nd4j {
             int dH = argI[6];
             int dW = argI[7];
             int isSameMode = argI[8];
-            int pnorm = argI[9];
-            T eps = argT[0];
+            bool isNCHW = true;
+            if (block.getIArguments()->size() > 10)
+                isNCHW = INT_ARG(10) == 0;
 
-            int bS = input->getShapeInfo()[1];
-            int iD = input->getShapeInfo()[2];
-            int iH = input->getShapeInfo()[3];
-            int iW = input->getShapeInfo()[4];
+            const int iH = isNCHW ? input->sizeAt(2) : input->sizeAt(1);
+            const int iW = isNCHW ? input->sizeAt(3) : input->sizeAt(2);
 
             // calculate output Height/Width
             int oH, oW;
             ConvolutionUtils<T>::calcOutSizePool2D(oH, oW, kH, kW, sH, sW, pH, pW, dH, dW, iH, iW, isSameMode);
 
-            bool cOrderStrides = false;
-            bool isEpsilonDup = false;
-            if (epsilon->ordering() != 'c') {
-                epsilon = epsilon->dup('c');
-                cOrderStrides = true;
-                isEpsilonDup = true;
-            }
+            if (isSameMode)
+                ConvolutionUtils<T>::_calcPadding2D(pH, pW, oH, oW, iH, iW, kH, kW, sH, sW, dH, dW);
 
-            int strideToCompare[] = {oH*oW, iD*oH*oW, oW, 1};
-            if (!cOrderStrides && shape::strideDescendingCAscendingF(epsilon->getShapeInfo())) {
-                cOrderStrides = true;
-            }
-            else if (!shape::strideEquals(strideToCompare, 4, epsilon->stridesOf(), epsilon->rankOf())) {
-                epsilon = epsilon->dup('c');
-                cOrderStrides = true;
-                isEpsilonDup = true;
-            }
-
-            NDArray<T>* col6d = nullptr;
-            NDArray<T>* col6dPermuted = nullptr;
-            NDArray<T>* epsilon1d = nullptr;
-
-            if (cOrderStrides) {
-                col6d = new NDArray<T>('c', {bS, iD, oH, oW, kH, kW}, block.getWorkspace());
-                col6dPermuted = col6d->permute({0, 1, 4, 5, 2, 3});
-                epsilon1d = epsilon->reshape('c', {(int) epsilon->lengthOf(), 1}); //zero copy reshape
-            }
-            else {
-                col6d = new NDArray<T>('c', {iD, bS, oH, oW, kH, kW}, block.getWorkspace());
-                col6dPermuted = col6d->permute({1, 0, 4, 5, 2, 3});
-                NDArray<T>* epsilonTemp = epsilon->permute({1, 0, 2, 3});
-                epsilon1d = epsilonTemp->reshape('c', {(int) epsilon->lengthOf(), 1}); //Should be a zero-copy reshape always
-                delete epsilonTemp;
-            }
-
-            NDArray<T>* col2d = col6d->reshape('c', {bS*iD*oH*oW, kH*kW});
-
-            T extraParams1[] = {(T)kH, (T)kW, (T)sH, (T)sW, (T)pH, (T)pW, (T)dH, (T)dW, (T)0.0};
-            input->template applyTransform<simdOps::Im2col<T>>(col6dPermuted, extraParams1);
-
-            NDArray<T>* pNorm = new NDArray<T>(col2d->getShapeInfo(), block.getWorkspace());
-            col2d->template applyTransform<simdOps::Abs<T>>(pNorm, nullptr);
-
-            T extraParams11[] = {(T)pnorm};
-            pNorm->template applyTransform<simdOps::Pow<T>>(extraParams11);
-            NDArray<T>* sumArr = pNorm->sum({1});
-            *pNorm = *sumArr;
-            T extraParams2[] = {1.f/pnorm};
-            pNorm->template applyTransform<simdOps::Pow<T>>(extraParams2);
-
-            NDArray<T>* numerator = new NDArray<T>(col2d->getShapeInfo(), block.getWorkspace());
-            if (pnorm != 2) {
-                NDArray<T>* absp2 = new NDArray<T>(col2d->getShapeInfo(), block.getWorkspace());
-                col2d->template applyTransform<simdOps::Abs<T>>(absp2, nullptr);
-                T extraParams3[] = {(T) (pnorm - 2)};
-                absp2->template applyTransform<simdOps::Pow<T>>(extraParams3);
-                nd4j::NDArrayFactory<T>::mmulHelper(col2d, absp2, numerator, (T)1.f, (T)0.f);
-                delete absp2;
-            }
-            NDArray<T>* denom = new NDArray<T>(pNorm->getShapeInfo(), block.getWorkspace());
-            T extraParams4[] = {(T) (pnorm - 1)};
+            REQUIRE_TRUE(epsilon->sizeAt(isNCHW ? 2 : 1) == oH && epsilon->sizeAt(isNCHW ? 3 : 2) == oW, 0, "Epsilon should have spatial shape [%i, %i], but got [%i, %i] instead", oH, oW, epsilon->sizeAt(isNCHW ? 2 : 1), epsilon->sizeAt(isNCHW ? 3 : 2));
 
-            pNorm->template applyTransform<simdOps::Pow<T>>(denom, extraParams4);
-            denom->template applyScalar<simdOps::Max<T>>(eps); // in case of 0
-            denom->template applyPairwiseTransform<simdOps::Divide<T>>(epsilon1d, denom, nullptr);
-            numerator->muliColumnVector(denom);
+            int pnorm = argI[9];
+            T eps = T_ARG(0);
 
-            T extraParams5[] = {(T)sH, (T)sW, (T)pH, (T)pW, (T)iH, (T)iW, (T)dH, (T)dW};   			// ??? zeros
-            col6dPermuted->template applyTransform<simdOps::Col2Im<T>>(outEpsilon, extraParams5);
+            helpers::pooling2dBP(*input, *epsilon, *outEpsilon, kH, kW, sH, sW, pH, pW, dH, dW, 2, (T) pnorm, eps, isNCHW);
 
             STORE_RESULT(*outEpsilon);
 
-            if(isEpsilonDup)
-                delete epsilon;
-            delete sumArr;
-            delete col6d;
-            delete col6dPermuted;
-            delete epsilon1d;
-            delete pNorm;
-            delete numerator;
-            delete denom;
-            delete col2d;
-
             return ND4J_STATUS_OK;
         }
 
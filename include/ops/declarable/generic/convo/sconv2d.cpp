@@ -72,9 +72,10 @@ CUSTOM_OP_IMPL(sconv2d, 2, 1, false, 0, 9) {
 
     NDArray<T>* outputDepth = output;
     if(weightsPoint)                        // if pointwise convolution is expected
-        outputDepth = new NDArray<T>(output->ordering(), !isNCHW ? std::vector<int>({bS, oH, oW, iC*mC}) : std::vector<int>({bS, iC*mC, oH, oW}));    
+        outputDepth = new NDArray<T>(output->ordering(), !isNCHW ? std::vector<int>({bS, oH, oW, iC*mC}) : std::vector<int>({bS, iC*mC, oH, oW}), block.getWorkspace());
 
     // ----- perform depthwise convolution (if weightsPoint is absent then oC = iC*mC) ----- //
+    // both steps go through convolution engines: depthwise part is computed directly, pointwise part is 1x1 GEMM
     nd4j::ops::depthwise_conv2d<T> op;
     Nd4jStatus status = op.execute({input, weightsDepth, weightsPoint ? nullptr : bias}, {outputDepth}, {}, {kH,kW, sH,sW, pH,pW, dH,dW, isSameMode, !isNCHW});                                   
     if (status != ND4J_STATUS_OK) 
@@ -7,6 +7,10 @@
 #include <op_boilerplate.h>
 #include <NDArray.h>
 #include <NDArrayFactory.h>
+#include <ops/declarable/helpers/gather.h>
+#include <templatemath.h>
+#include <memory>
+#include <omp.h>
 
 
 namespace nd4j {
@@ -14,74 +18,69 @@ namespace nd4j {
 
         template <typename T>
         class ScatterHelper {
+        private:
+            template <typename OpClass>
+            static FORCEINLINE void apply(T *z, T *u, const Nd4jIndex length) {
+#pragma omp simd
+                for (Nd4jIndex i = 0; i < length; i++)
+                    z[i] = OpClass::op(z[i], u[i], nullptr);
+            }
+
         public:
+            /**
+             * This method applies updates to rows of output picked by indices: output[indices[e]] = op(output[indices[e]], updates[e])
+             * Output is seen as [rows x rowLength] matrix: vectors are updated element-wise, other arrays along first dimension.
+             *
+             * Duplicate indices are applied in their order, as sequential loop would do: each thread owns range of output rows,
+             * so there are no races, and long rows are split between threads instead
+             */
             template <typename OpClass>
             static FORCEINLINE Nd4jStatus scatter_apply(NDArray<T>* output, NDArray<T>* indices, NDArray<T>* updates) {
-                NDArray<T>* input = output;
-                int indicesLength = (int) indices->lengthOf();
-
-            if ((indices->isVector() && input->isVector() && updates->isVector()) ||
-                (input->isScalar() && input->isScalar() && updates->isScalar()) ||
-                (input->isVector() && indices->isScalar() && updates->isScalar()) ) {
-                
-                for (int e = 0; e < indicesLength; e++) {
-                    int idx = (int) indices->getScalar(e);
-                    
-                    T t0 = input->getScalar(idx);
-                    T t1 = updates->getScalar(e);
-                    
-                    output->putScalar(idx, OpClass::op(t0, t1, nullptr));
+                const Nd4jIndex rows = output->isVector() || output->isScalar() ? output->lengthOf() : output->sizeAt(0);
+                const Nd4jIndex rowLength = output->lengthOf() / rows;
+
+                std::vector<Nd4jIndex> idx;
+                REQUIRE_TRUE(helpers::readIndices(*indices, idx, rows), 0, "scatter: indices should be within [0, %i) range", (int) rows);
+
+                const Nd4jIndex numIndices = (Nd4jIndex) idx.size();
+                REQUIRE_TRUE(updates->lengthOf() == numIndices * rowLength, 0, "scatter: updates shapes should match");
+
+                // other layouts are updated through c-ordered copies
+                std::unique_ptr<NDArray<T>> zCopy;
+                std::unique_ptr<NDArray<T>> uCopy;
+
+                T *z = helpers::linearBuffer(*output, zCopy);
+                T *u = helpers::linearBuffer(*updates, uCopy);
+                const Nd4jIndex *p = idx.data();
+
+                if (rowLength > ELEMENT_THRESHOLD) {
+                    for (Nd4jIndex e = 0; e < numIndices; e++) {
+                        T *zRow = z + p[e] * rowLength;
+                        T *uRow = u + e * rowLength;
+
+#pragma omp parallel for simd schedule(static)
+                        for (Nd4jIndex i = 0; i < rowLength; i++)
+                            zRow[i] = OpClass::op(zRow[i], uRow[i], nullptr);
+                    }
+                } else {
+#pragma omp parallel if (numIndices * rowLength > ELEMENT_THRESHOLD)
+                    {
+                        const Nd4jIndex numThreads = omp_get_num_threads();
+                        const Nd4jIndex span = (rows + numThreads - 1) / numThreads;
+                        const Nd4jIndex start = omp_get_thread_num() * span;
+                        const Nd4jIndex end = nd4j::math::nd4j_min<Nd4jIndex>(rows, start + span);
+
+                        for (Nd4jIndex e = 0; e < numIndices; e++)
+                            if (p[e] >= start && p[e] < end)
+                                apply<OpClass>(z + p[e] * rowLength, u + e * rowLength, rowLength);
+                    }
                 }
-            } else if (indices->isVector() || indices->isScalar()) {
-                std::vector<int> idc;
-                std::vector<int> idcU;
 
-                for (int e = 0; e < indicesLength; e++) {
-                    idc.push_back((int) indices->getScalar(e));
-                    idcU.push_back(e);
-                }
+                if (zCopy)
+                    output->assign(zCopy.get());
 
-                std::vector<int> tadDimension = ShapeUtils<T>::convertAxisToTadTarget(input->rankOf(), {0});
-                auto tadsOperand = NDArrayFactory<T>::multipleTensorsAlongDimension(output, idc, tadDimension);
-                auto tadsUpdate = NDArrayFactory<T>::multipleTensorsAlongDimension(updates, idcU, tadDimension);
-
-                auto z0 = tadsOperand->at(0);
-                auto z1 = tadsUpdate->at(0);
-
-                REQUIRE_TRUE(z0->isSameShape(z1), 0, "scatter_add: updates shapes should match");
-
-                for (int e = 0; e < tadsOperand->size(); e++) {
-                    auto t0 = tadsOperand->at(e);
-                    auto t1 = tadsUpdate->at(e);
-                    
-                    t0->template applyPairwiseTransform<OpClass>(t1, nullptr);
-                }
-
-                delete tadsOperand;
-                delete tadsUpdate;
-            }  else if (indices->isMatrix() || indices->rankOf() >= 2) {
-                auto _input = input->reshape(input->ordering(), {input->sizeAt(0), -1});
-                auto _updates = updates->reshape(updates->ordering(), {indicesLength, (int) updates->lengthOf() / indicesLength});
-
-                auto tadsOperand = NDArrayFactory<T>::allTensorsAlongDimension(_input, {1});
-                auto tadsUpdates = NDArrayFactory<T>::allTensorsAlongDimension(_updates, {1});
-
-                for (int e = 0; e < indicesLength; e++) {
-                    int idx = indices->getScalar(e);
-                    
-                    auto t0 = tadsOperand->at(idx);
-                    auto t1 = tadsUpdates->at(e);
-
-                    t0->template applyPairwiseTransform<OpClass>(t1, nullptr);
-                }
-
-                delete _input;
-                delete _updates;
-
-                delete tadsOperand;
-                delete tadsUpdates;
-            }
+                return ND4J_STATUS_OK;
             }
         };
     }
-}
\ No newline at end of file
+}
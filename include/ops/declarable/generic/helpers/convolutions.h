@@ -10,6 +10,13 @@
 namespace nd4j {
     namespace ops {
 
+        // algorithms available to conv2d-like ops, see ConvolutionUtils::conv2dAlgorithm()
+        enum ConvAlgorithm {
+            CONV_IM2COL = 0,        // im2col + GEMM, works for any configuration
+            CONV_DIRECT = 1,        // 1x1 kernels: GEMM straight over input whenever layout allows it
+            CONV_WINOGRAD = 2,      // Winograd F(2x2, 3x3): 3x3 kernels with unit strides and dilations
+        };
+
         template <typename T>
         class ConvolutionUtils {
         public:
@@ -78,6 +85,21 @@ namespace nd4j {
             
             // evaluates sizes values and indexes using input and output arrays depending on data format
             static void getSizesAndIndexesConv3d(const bool isNCDHW, const NDArray<T>& input, const NDArray<T>& output, int& bS, int& iC, int& iD, int& iH, int& iW, int& oC, int& oD, int& oH, int& oW, int& indIOioC, int& indIOioD, int& indWiC, int& indWoC, int& indWkD);
+
+            // picks algorithm for 2D convolution with given configuration
+            static ConvAlgorithm conv2dAlgorithm(const int iC, const int oC, const int oH, const int oW, const int kH, const int kW, const int sH, const int sW, const int dH, const int dW);
+
+            // input [bS, iC, iH, iW], weights [oC, iC, kH, kW], output [bS, oC, oH, oW]; arrays can be views with any strides (e.g. permuted NHWC), so nothing is copied
+            static void conv2d(const ConvAlgorithm algorithm, NDArray<T>& input, NDArray<T>& weights, NDArray<T>& output, const int kH, const int kW, const int sH, const int sW, const int pH, const int pW, const int dH, const int dW, nd4j::memory::Workspace* workspace = nullptr);
+
+            // input [bS, iC, iH, iW], weights [oC, iC, 1, 1], output [bS, oC, oH, oW]
+            static void conv2dDirect(NDArray<T>& input, NDArray<T>& weights, NDArray<T>& output, const int sH, const int sW, const int pH, const int pW, nd4j::memory::Workspace* workspace = nullptr);
+
+            // input [bS, iC, iH, iW], weights [oC, iC, 3, 3], output [bS, oC, oH, oW]; strides and dilations are 1
+            static void conv2dWinograd(NDArray<T>& input, NDArray<T>& weights, NDArray<T>& output, const int pH, const int pW, nd4j::memory::Workspace* workspace = nullptr);
+
+            // input [bS, iC, iH, iW], weights [iC, mC, kH, kW], output [bS, iC*mC, oH, oW]
+            static void depthwiseConv2dDirect(NDArray<T>& input, NDArray<T>& weights, NDArray<T>& output, const int kH, const int kW, const int sH, const int sW, const int pH, const int pW, const int dH, const int dW);
     };
 
 }
@@ -3,10 +3,37 @@
 //
 
 #include <ops/declarable/generic/helpers/convolutions.h>
+#include <NDArrayFactory.h>
+#include <stdexcept>
 
 namespace nd4j {
 namespace ops  {
 
+//////////////////////////////////////////////////////////////////////////
+// C = A x B for row-major buffers. It's computed as C^T = B^T x A^T over column-major views of the same buffers, so nothing is copied
+template<typename T>
+static void gemmRowMajor(T* a, T* b, T* c, const int M, const int N, const int K, nd4j::memory::Workspace* workspace) {
+    // vector shapes would be routed to gemv/dot, so they're handled here
+    if (M == 1 || N == 1 || K == 1) {
+        for (int i = 0; i < M; i++) {
+            for (int j = 0; j < N; j++) {
+                T sum = (T) 0.0f;
+                for (int k = 0; k < K; k++)
+                    sum += a[(Nd4jIndex) i * K + k] * b[(Nd4jIndex) k * N + j];
+                c[(Nd4jIndex) i * N + j] = sum;
+            }
+        }
+        return;
+    }
+
+    NDArray<T> aT(a, 'f', {K, M}, workspace);
+    NDArray<T> bT(b, 'f', {N, K}, workspace);
+    NDArray<T> cT(c, 'f', {N, M}, workspace);
+
+    NDArrayFactory<T>::mmulHelper(&bT, &aT, &cT, (T) 1.0f, (T) 0.0f);
+}
+
+
 //////////////////////////////////////////////////////////////////////////
         template<typename T>
         void ConvolutionUtils<T>::_im2col(const T* data_im, const int channels,
@@ -1272,6 +1299,301 @@ void ConvolutionUtils<T>::getSizesAndIndexesConv3d(const bool isNCDHW, const NDA
 }
  
 
+//////////////////////////////////////////////////////////////////////////
+template<typename T>
+ConvAlgorithm ConvolutionUtils<T>::conv2dAlgorithm(const int iC, const int oC, const int oH, const int oW, const int kH, const int kW, const int sH, const int sW, const int dH, const int dW) {
+
+    // 1x1 kernel is plain channels reduction, so columns would be just a copy of input
+    if (kH == 1 && kW == 1)
+        return CONV_DIRECT;
+
+    // transforms have fixed cost per tile, so they pay off only when there are enough channels to reduce over
+    if (kH == 3 && kW == 3 && sH == 1 && sW == 1 && dH == 1 && dW == 1 && iC >= 16 && oC >= 16 && oH >= 4 && oW >= 4)
+        return CONV_WINOGRAD;
+
+    return CONV_IM2COL;
+}
+
+//////////////////////////////////////////////////////////////////////////
+template<typename T>
+void ConvolutionUtils<T>::conv2d(const ConvAlgorithm algorithm, NDArray<T>& input, NDArray<T>& weights, NDArray<T>& output, const int kH, const int kW, const int sH, const int sW, const int pH, const int pW, const int dH, const int dW, nd4j::memory::Workspace* workspace) {
+
+    switch (algorithm) {
+        case CONV_DIRECT:
+            conv2dDirect(input, weights, output, sH, sW, pH, pW, workspace);
+            break;
+        case CONV_WINOGRAD:
+            conv2dWinograd(input, weights, output, pH, pW, workspace);
+            break;
+        default:
+            throw std::invalid_argument("ConvolutionUtils::conv2d: im2col algorithm is implemented by ops themselves");
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+template<typename T>
+void ConvolutionUtils<T>::conv2dDirect(NDArray<T>& input, NDArray<T>& weights, NDArray<T>& output, const int sH, const int sW, const int pH, const int pW, nd4j::memory::Workspace* workspace) {
+
+    // input [bS, iC, iH, iW], weights [oC, iC, 1, 1], output [bS, oC, oH, oW], any strides
+    const int bS = input.sizeAt(0);
+    const int iC = input.sizeAt(1);
+    const int iH = input.sizeAt(2);
+    const int iW = input.sizeAt(3);
+    const int oC = output.sizeAt(1);
+    const int oH = output.sizeAt(2);
+    const int oW = output.sizeAt(3);
+
+    const int* xS = input.stridesOf();
+    const int* wS = weights.stridesOf();
+    const int* zS = output.stridesOf();
+
+    if (sH == 1 && sW == 1 && pH == 0 && pW == 0) {
+        const int plane = iH * iW;
+
+        // NHWC: pixels of whole batch form [bS*iH*iW, iC] matrix, so single GEMM does everything
+        if (xS[1] == 1 && xS[3] == iC && xS[2] == iW * iC && xS[0] == plane * iC && zS[1] == 1 && zS[3] == oC && zS[2] == oW * oC && zS[0] == plane * oC) {
+            NDArray<T> wT('c', {iC, oC}, workspace);
+            for (int o = 0; o < oC; o++)
+                for (int c = 0; c < iC; c++)
+                    wT.getBuffer()[c * oC + o] = weights.getBuffer()[o * wS[0] + c * wS[1]];
+
+            gemmRowMajor<T>(input.getBuffer(), wT.getBuffer(), output.getBuffer(), bS * plane, oC, iC, workspace);
+            return;
+        }
+
+        // NCHW: each image is [iC, iH*iW] matrix
+        if (xS[3] == 1 && xS[2] == iW && xS[1] == plane && zS[3] == 1 && zS[2] == oW && zS[1] == plane) {
+            NDArray<T> w('c', {oC, iC}, workspace);
+            for (int o = 0; o < oC; o++)
+                for (int c = 0; c < iC; c++)
+                    w.getBuffer()[o * iC + c] = weights.getBuffer()[o * wS[0] + c * wS[1]];
+
+            for (int b = 0; b < bS; b++)
+                gemmRowMajor<T>(w.getBuffer(), input.getBuffer() + b * xS[0], output.getBuffer() + b * zS[0], oC, plane, iC, workspace);
+            return;
+        }
+    }
+
+    // strided or padded 1x1 convolution: every output pixel is dot product over input channels
+    T* x = input.getBuffer();
+    T* w = weights.getBuffer();
+    T* z = output.getBuffer();
+
+#pragma omp parallel for collapse(2) schedule(guided) if ((Nd4jIndex) bS * oC * oH * oW * iC > ELEMENT_THRESHOLD)
+    for (int b = 0; b < bS; b++) {
+        for (int o = 0; o < oC; o++) {
+            T* zP = z + b * zS[0] + o * zS[1];
+            for (int y = 0; y < oH; y++) {
+                const int iy = y * sH - pH;
+                for (int xx = 0; xx < oW; xx++) {
+                    const int ix = xx * sW - pW;
+                    T sum = (T) 0.0f;
+                    if (iy >= 0 && iy < iH && ix >= 0 && ix < iW) {
+                        T* xP = x + b * xS[0] + iy * xS[2] + ix * xS[3];
+                        for (int c = 0; c < iC; c++)
+                            sum += xP[c * xS[1]] * w[o * wS[0] + c * wS[1]];
+                    }
+                    zP[y * zS[2] + xx * zS[3]] = sum;
+                }
+            }
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+template<typename T>
+void ConvolutionUtils<T>::conv2dWinograd(NDArray<T>& input, NDArray<T>& weights, NDArray<T>& output, const int pH, const int pW, nd4j::memory::Workspace* workspace) {
+
+    // Winograd F(2x2, 3x3): each 2x2 output tile is computed from 4x4 input tile as A^T [(G g G^T) . (B^T d B)] A,
+    // where elementwise products summed over input channels become 16 independent GEMMs
+    // input [bS, iC, iH, iW], weights [oC, iC, 3, 3], output [bS, oC, oH, oW], any strides
+    const int bS = input.sizeAt(0);
+    const int iC = input.sizeAt(1);
+    const int iH = input.sizeAt(2);
+    const int iW = input.sizeAt(3);
+    const int oC = output.sizeAt(1);
+    const int oH = output.sizeAt(2);
+    const int oW = output.sizeAt(3);
+
+    const int tH = (oH + 1) / 2;
+    const int tW = (oW + 1) / 2;
+    const int numTiles = bS * tH * tW;
+
+    const int* xS = input.stridesOf();
+    const int* wS = weights.stridesOf();
+    const int* zS = output.stridesOf();
+
+    NDArray<T> U('c', {16, oC, iC}, workspace);
+    NDArray<T> V('c', {16, iC, numTiles}, workspace);
+    NDArray<T> M('c', {16, oC, numTiles}, workspace);
+
+    T* w = weights.getBuffer();
+    T* u = U.getBuffer();
+    const Nd4jIndex uStride = (Nd4jIndex) oC * iC;
+
+    // weights transform: G g G^T, G = [[1, 0, 0], [1/2, 1/2, 1/2], [1/2, -1/2, 1/2], [0, 0, 1]]
+#pragma omp parallel for collapse(2) schedule(guided) if ((Nd4jIndex) oC * iC * 16 > ELEMENT_THRESHOLD)
+    for (int o = 0; o < oC; o++) {
+        for (int c = 0; c < iC; c++) {
+            T g[3][3], t[4][3];
+            for (int i = 0; i < 3; i++)
+                for (int j = 0; j < 3; j++)
+                    g[i][j] = w[o * wS[0] + c * wS[1] + i * wS[2] + j * wS[3]];
+
+            for (int j = 0; j < 3; j++) {
+                t[0][j] = g[0][j];
+                t[1][j] = (g[0][j] + g[1][j] + g[2][j]) * (T) 0.5f;
+                t[2][j] = (g[0][j] - g[1][j] + g[2][j]) * (T) 0.5f;
+                t[3][j] = g[2][j];
+            }
+
+            T* uP = u + (Nd4jIndex) o * iC + c;
+            for (int i = 0; i < 4; i++) {
+                uP[(i * 4 + 0) * uStride] = t[i][0];
+                uP[(i * 4 + 1) * uStride] = (t[i][0] + t[i][1] + t[i][2]) * (T) 0.5f;
+                uP[(i * 4 + 2) * uStride] = (t[i][0] - t[i][1] + t[i][2]) * (T) 0.5f;
+                uP[(i * 4 + 3) * uStride] = t[i][2];
+            }
+        }
+    }
+
+    T* x = input.getBuffer();
+    T* v = V.getBuffer();
+    const Nd4jIndex vStride = (Nd4jIndex) iC * numTiles;
+
+    // input transform: B^T d B, B^T = [[1, 0, -1, 0], [0, 1, 1, 0], [0, -1, 1, 0], [0, 1, 0, -1]]
+#pragma omp parallel for collapse(2) schedule(guided) if ((Nd4jIndex) numTiles * iC * 16 > ELEMENT_THRESHOLD)
+    for (int c = 0; c < iC; c++) {
+        for (int tile = 0; tile < numTiles; tile++) {
+            const int b = tile / (tH * tW);
+            const int ty = (tile / tW) % tH;
+            const int tx = tile % tW;
+            const int y0 = ty * 2 - pH;
+            const int x0 = tx * 2 - pW;
+
+            T d[4][4], t[4][4];
+            T* xP = x + b * xS[0] + c * xS[1];
+            for (int i = 0; i < 4; i++) {
+                const int iy = y0 + i;
+                for (int j = 0; j < 4; j++) {
+                    const int ix = x0 + j;
+                    d[i][j] = iy >= 0 && iy < iH && ix >= 0 && ix < iW ? xP[iy * xS[2] + ix * xS[3]] : (T) 0.0f;
+                }
+            }
+
+            for (int j = 0; j < 4; j++) {
+                t[0][j] = d[0][j] - d[2][j];
+                t[1][j] = d[1][j] + d[2][j];
+                t[2][j] = d[2][j] - d[1][j];
+                t[3][j] = d[1][j] - d[3][j];
+            }
+
+            T* vP = v + (Nd4jIndex) c * numTiles + tile;
+            for (int i = 0; i < 4; i++) {
+                vP[(i * 4 + 0) * vStride] = t[i][0] - t[i][2];
+                vP[(i * 4 + 1) * vStride] = t[i][1] + t[i][2];
+                vP[(i * 4 + 2) * vStride] = t[i][2] - t[i][1];
+                vP[(i * 4 + 3) * vStride] = t[i][1] - t[i][3];
+            }
+        }
+    }
+
+    // [oC, iC] x [iC, numTiles] for each of 16 positions within tile
+    const Nd4jIndex mStride = (Nd4jIndex) oC * numTiles;
+    for (int e = 0; e < 16; e++)
+        gemmRowMajor<T>(u + e * uStride, v + e * vStride, M.getBuffer() + e * mStride, oC, numTiles, iC, workspace);
+
+    T* m = M.getBuffer();
+    T* z = output.getBuffer();
+
+    // output transform: A^T m A, A^T = [[1, 1, 1, 0], [0, 1, -1, -1]]
+#pragma omp parallel for collapse(2) schedule(guided) if ((Nd4jIndex) numTiles * oC * 16 > ELEMENT_THRESHOLD)
+    for (int o = 0; o < oC; o++) {
+        for (int tile = 0; tile < numTiles; tile++) {
+            const int b = tile / (tH * tW);
+            const int ty = (tile / tW) % tH;
+            const int tx = tile % tW;
+
+            T s[4][4], t[2][4];
+            T* mP = m + (Nd4jIndex) o * numTiles + tile;
+            for (int i = 0; i < 4; i++)
+                for (int j = 0; j < 4; j++)
+                    s[i][j] = mP[(i * 4 + j) * mStride];
+
+            for (int j = 0; j < 4; j++) {
+                t[0][j] = s[0][j] + s[1][j] + s[2][j];
+                t[1][j] = s[1][j] - s[2][j] - s[3][j];
+            }
+
+            T* zP = z + b * zS[0] + o * zS[1];
+            for (int i = 0; i < 2; i++) {
+                const int y = ty * 2 + i;
+                if (y >= oH)
+                    continue;
+
+                const T r[2] = {t[i][0] + t[i][1] + t[i][2], t[i][1] - t[i][2] - t[i][3]};
+                for (int j = 0; j < 2; j++) {
+                    const int xx = tx * 2 + j;
+                    if (xx < oW)
+                        zP[y * zS[2] + xx * zS[3]] = r[j];
+                }
+            }
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+template<typename T>
+void ConvolutionUtils<T>::depthwiseConv2dDirect(NDArray<T>& input, NDArray<T>& weights, NDArray<T>& output, const int kH, const int kW, const int sH, const int sW, const int pH, const int pW, const int dH, const int dW) {
+
+    // input [bS, iC, iH, iW], weights [iC, mC, kH, kW], output [bS, iC*mC, oH, oW], any strides
+    const int bS = input.sizeAt(0);
+    const int iC = input.sizeAt(1);
+    const int iH = input.sizeAt(2);
+    const int iW = input.sizeAt(3);
+    const int mC = weights.sizeAt(1);
+    const int oH = output.sizeAt(2);
+    const int oW = output.sizeAt(3);
+
+    const int* xS = input.stridesOf();
+    const int* wS = weights.stridesOf();
+    const int* zS = output.stridesOf();
+
+    T* x = input.getBuffer();
+    T* w = weights.getBuffer();
+    T* z = output.getBuffer();
+
+    // every output channel depends on single input channel, so there's nothing to reduce over and no columns are needed
+#pragma omp parallel for collapse(3) schedule(guided) if ((Nd4jIndex) bS * iC * mC * oH * oW * kH * kW > ELEMENT_THRESHOLD)
+    for (int b = 0; b < bS; b++) {
+        for (int c = 0; c < iC; c++) {
+            for (int m = 0; m < mC; m++) {
+                T* xP = x + b * xS[0] + c * xS[1];
+                T* wP = w + c * wS[0] + m * wS[1];
+                T* zP = z + b * zS[0] + (c * mC + m) * zS[1];
+
+                for (int y = 0; y < oH; y++) {
+                    for (int xx = 0; xx < oW; xx++) {
+                        T sum = (T) 0.0f;
+                        for (int ky = 0; ky < kH; ky++) {
+                            const int iy = y * sH - pH + ky * dH;
+                            if (iy < 0 || iy >= iH)
+                                continue;
+
+                            for (int kx = 0; kx < kW; kx++) {
+                                const int ix = xx * sW - pW + kx * dW;
+                                if (ix >= 0 && ix < iW)
+                                    sum += xP[iy * xS[2] + ix * xS[3]] * wP[ky * wS[2] + kx * wS[3]];
+                            }
+                        }
+                        zP[y * zS[2] + xx * zS[3]] = sum;
+                    }
+                }
+            }
+        }
+    }
+}
+
 
 template class ND4J_EXPORT ConvolutionUtils<float>;
 template class ND4J_EXPORT ConvolutionUtils<float16>;
@@ -3,6 +3,7 @@
 //
 
 #include <ops/declarable/CustomOperations.h>
+#include <ops/declarable/helpers/softmax.h>
 
 namespace nd4j {
     namespace ops {
@@ -28,29 +29,16 @@ CUSTOM_OP_IMPL(softmax_cross_entropy_loss, 3, 1, false, 1, 1) {
     	for (int i = 0; i < weights->rankOf(); ++i)
         	REQUIRE_TRUE(!(weights->shapeOf()[i] != output->shapeOf()[i] && weights->shapeOf()[i] != 1 && !output->isScalar()), 0, "CUSTOM_OP loss function softmax_cross_entropy_loss: shapes of weights array is not broadcastable to output shape!");
 
-	// If label_smoothing is nonzero, smooth the labels towards 1/num_classes: new_onehot_labels = onehot_labels * (1 - label_smoothing) + label_smoothing / num_classes
-	NDArray<T>* newLabels = labels;
-	if(labelsSmoothing != (T)0.) {
-		T numClasses = (T)labels->sizeAt(1);
-		auto smooth = LAMBDA_T(value, labelsSmoothing, numClasses) { return value * ((T)1. - labelsSmoothing) + labelsSmoothing/numClasses; };
-    	newLabels = new NDArray<T>(labels);
-    	newLabels->applyLambda(smooth);  
-	}	
-		
+	// If label_smoothing is nonzero, labels are smoothed towards 1/num_classes on the fly: new_onehot_labels = onehot_labels * (1 - label_smoothing) + label_smoothing / num_classes
+	T numClasses = (T)labels->sizeAt(1);
+
 	std::vector<int> dimensions = {-1};
-	// Find the max in each batch, resulting in a tensor of shape [batch]
-	NDArray<T> logitsMax = logits->template reduceAlongDims<simdOps::Max<T>>(dimensions, true);
-	// Subtract the max in batch b from every element in batch b, broadcasts along the batch dimension.
-	NDArray<T> shiftedLogits = *logits - logitsMax;
-	// exp(logits - max_logits)
-	NDArray<T> expShiftedLogits = shiftedLogits.template transform<simdOps::Exp<T>>();
-	// sum_{class} (exp(logits - max_logits))
-	NDArray<T> sumExp = expShiftedLogits.template reduceAlongDims<simdOps::Sum<T>>(dimensions, true);	
-	// log(sum(exp(logits - max_logits)))
-	NDArray<T> logSumExp = sumExp.template transform<simdOps::Log<T>>();
-	// sum(-labels *((logits - max_logits) - log(sum(exp(logits - max_logits))))) along classes
-	// The subtraction broadcasts along the batch dimension
-	NDArray<T> weightedLosses = ((-*newLabels)*(shiftedLogits - logSumExp)).template reduceAlongDims<simdOps::Sum<T>>(dimensions);
+	int* lossesShapeInfo = ShapeUtils<T>::evalReduceShapeInfo('c', dimensions, *logits, false, false, block.getWorkspace());
+	NDArray<T> weightedLosses(lossesShapeInfo, false, block.getWorkspace());
+	RELEASE(lossesShapeInfo, block.getWorkspace());
+
+	// sum(-labels * log(softmax(logits))) along classes, computed in single pass without softmax temporaries
+	helpers::softmaxCrossEntropy<T>(*logits, *labels, weightedLosses, -1, labelsSmoothing, numClasses);
 	
 	// perform weights broadcasting/tile to weightedLosses if needed	
 	NDArray<T>* weightsBroad = weights;	
@@ -116,8 +104,6 @@ CUSTOM_OP_IMPL(softmax_cross_entropy_loss, 3, 1, false, 1, 1) {
 
     if(weightsBroad != weights)
     	delete weightsBroad;
-    if(newLabels != labels)
-    	delete newLabels; 
    		
     return ND4J_STATUS_OK;
 }
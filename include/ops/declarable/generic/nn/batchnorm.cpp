@@ -3,6 +3,7 @@
 //
 
 #include <ops/declarable/CustomOperations.h>
+#include <ops/declarable/helpers/batchnorm.h>
 
 namespace nd4j {
 namespace ops {
@@ -25,15 +26,21 @@ CUSTOM_OP_IMPL(batchnorm, 5, 1, false, 1, 2) {
     const T    epsilon     = T_ARG(0);
 
     // normalized output = gamma * ((input - mean) / sqrt(variance + epsilon)) + beta
-    
-    NDArray<T> inv = (*variance + epsilon).template transform<simdOps::RSqrt<T>>();
-    if(applyScale)
-        inv *= *gamma;
-    
-    if (applyOffset)
-        *output = (*input) * inv - (*mean) * inv + *beta;
-    else 
-        *output = (*input) * inv - (*mean) * inv;
+
+    // per-channel params, i.e. all of them are vectors along the same axis of input: single pass without temporaries
+    const int axis = helpers::channelAxis<T>(*input, {mean, variance, applyScale ? gamma : nullptr, applyOffset ? beta : nullptr});
+    if (axis >= 0 && output->isSameShape(input))
+        helpers::batchnorm<T>(*input, *mean, *variance, applyScale ? gamma : nullptr, applyOffset ? beta : nullptr, *output, axis, epsilon);
+    else {
+        NDArray<T> inv = (*variance + epsilon).template transform<simdOps::RSqrt<T>>();
+        if(applyScale)
+            inv *= *gamma;
+
+        if (applyOffset)
+            *output = (*input) * inv - (*mean) * inv + *beta;
+        else
+            *output = (*input) * inv - (*mean) * inv;
+    }
 
     STORE_RESULT(*output);
  
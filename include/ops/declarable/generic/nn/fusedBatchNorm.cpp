@@ -3,6 +3,7 @@
 //
 
 #include <ops/declarable/CustomOperations.h>
+#include <ops/declarable/helpers/batchnorm.h>
 
 namespace nd4j {
 namespace ops {
@@ -59,35 +60,26 @@ CUSTOM_OP_IMPL(fused_batch_norm, 3, 1, false, 0, 2) {
         epsilon = 0.001;
     
     const int restSize = x->lengthOf() / iD;    
-    NDArray<T> xAffected(x->ordering(), {restSize, iD}, block.getWorkspace());
-    xAffected.assign(x);
-
     const int restSizeMinusOne = (restSize > 1) ? (restSize - 1) : 1;
-    const T restSizeInv = (T)1.0 / restSize;
     const T restSizeAdjust = (T)restSize / restSizeMinusOne;
 
+    // statistics are gathered over all dimensions but channels one
+    const int axis = dataFormat ? 1 : 3;
+    std::vector<int> dimensions = dataFormat ? std::vector<int>({0, 2, 3}) : std::vector<int>({0, 1, 2});
+
     if(isTraining) {
-        NDArray<T>* sum = xAffected.sum({0});
-        mean->assign((*sum) * restSizeInv);
+        mean->assign(x->template reduceAlongDims<simdOps::Mean<T>>(dimensions));
         *batchMean = *mean;
-        delete sum;
+
+        x->template varianceAlongDimension<simdOps::SummaryStatsVariance<T>>(variance, false, dimensions);
+        *batchVar = (*variance) * restSizeAdjust;
     }
-    else 
+    else {
         *batchMean = 0.;
-    
-    xAffected -= *mean;
-
-    if(isTraining) {        
-        T power = 2.;
-        NDArray<T>* sum = xAffected.template transform<simdOps::Pow<T>>(&power).sum({0});
-        variance->assign((*sum) * restSizeInv);
-        *batchVar  = (*variance) * restSizeAdjust;
-        delete sum;
+        *batchVar  = 0.;
     }
-    else 
-        *batchVar  = 0.;      
 
-    y->assign( xAffected * (*variance + epsilon).template transform<simdOps::RSqrt<T>>() * (*scale) + (*offset) );    
+    helpers::batchnorm<T>(*x, *mean, *variance, scale, offset, *y, axis, epsilon);
 
     if(isTraining) {
         delete mean;
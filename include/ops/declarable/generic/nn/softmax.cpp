@@ -3,7 +3,7 @@
 //
 
 #include <ops/declarable/CustomOperations.h>
-#include <ops/declarable/helpers/softMaxForVector.h>
+#include <ops/declarable/helpers/softmax.h>
 
 namespace nd4j {
 namespace ops {
@@ -19,19 +19,7 @@ CONFIGURABLE_OP_IMPL(softmax, 1, 1, true, 0, 0) {
 
     REQUIRE_TRUE(dim < rank, 0, "SOFTMAX op: the value of input integer parameter (dimension) must be less than rank of input array !");
 
-    if(input->isVector()) {
-        
-        if(rank == 1 || input->sizeAt(dim) != 1)
-            helpers::softMaxForVector<T>(*input, *output);
-        else
-            *output = 1.;
-    }
-    else {
-        
-        NDArray<T> exponents = input->template transform<simdOps::Exp<T>>();
-        NDArray<T> sumAlongDim = exponents.template reduceAlongDims<simdOps::Sum<T>>({dim}, true);        
-        output->assign(exponents / sumAlongDim);
-    }
+    helpers::softmax<T>(*input, *output, dim);
     
     return Status::OK();
 }
@@ -45,17 +33,14 @@ CONFIGURABLE_OP_IMPL(softmax_bp, 2, 1, true, 0, 0) {
 
     int rank = input->rankOf();
     int dim  = block.getIArguments()->size() > 0 ? INT_ARG(0) : rank - 1;
-    softmax<T> op;
-    ResultSet<T>* results = op.execute({input}, {}, {dim});    
-    output->assign(results->at(0));
-    
-    NDArray<T> sumAlongDim = (*output * *epsInput).template reduceAlongDims<simdOps::Sum<T>>({dim}, true);
-    *output *= (*epsInput - sumAlongDim);
 
-    delete results;
+    REQUIRE_TRUE(dim < rank, 0, "SOFTMAX_BP op: the value of input integer parameter (dimension) must be less than rank of input array !");
+
+    helpers::softmaxBP<T>(*input, *epsInput, *output, dim);
+
     return Status::OK();
 }
 
 
 }
-}
\ No newline at end of file
+}
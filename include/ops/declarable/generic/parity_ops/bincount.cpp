@@ -4,6 +4,10 @@
 
 //#include <ops/declarable/headers/parity_ops.h>
 #include <ops/declarable/CustomOperations.h>
+#include <ops/declarable/helpers/gather.h>
+#include <limits>
+#include <memory>
+#include <omp.h>
 
 namespace nd4j {
     namespace ops {
@@ -11,35 +15,50 @@ namespace nd4j {
 
             NDArray<T>* values = INPUT_VARIABLE(0);
             
-            NDArray<T>* weights;
+            NDArray<T>* weights = nullptr;
             if (block.width() > 1) {
                 weights = INPUT_VARIABLE(1);
                 REQUIRE_TRUE(values->isSameShape(weights), 0, "bincount: the input and weights shapes should be equals");
             }
-            int maxLength = -1;
-            int minLength = 0;
-            int maxIndex = values->argMax();
-            maxLength = int((*values)(maxIndex))  + 1;
-
-            if (block.numI() > 0) {
-                minLength = nd4j::math::nd4j_max(INT_ARG(0), 0);
-                if (block.numI() == 2) 
-                    maxLength = nd4j::math::nd4j_min(maxLength, INT_ARG(1));
-            }
 
             NDArray<T>* result = OUTPUT_VARIABLE(0);
-            result->assign((T)0.0);
 
-            for (int e = 0; e < values->lengthOf(); e++) {
-                int val = (*values)(e);
-                if (val < maxLength) {
-                    if (block.width() > 1)
-                        (*result)(val) += (*weights)(e);
-                    else
-                        (*result)(val)++;
+            // values above maxLength are dropped, so limit is checked per element instead
+            std::vector<Nd4jIndex> bins;
+            REQUIRE_TRUE(helpers::readIndices(*values, bins, std::numeric_limits<Nd4jIndex>::max()), 0, "bincount: values should be non-negative");
+
+            std::vector<T> w;
+            if (weights != nullptr) {
+                std::unique_ptr<NDArray<T>> copy;
+                T *buffer = helpers::linearBuffer(*weights, copy);
+                w.assign(buffer, buffer + weights->lengthOf());
+            }
+
+            const Nd4jIndex length = (Nd4jIndex) bins.size();
+            const Nd4jIndex numBins = result->lengthOf();
+
+            // per-thread histograms pay off only when they're small compared to input
+            const int numThreads = length > ELEMENT_THRESHOLD && numBins * omp_get_max_threads() < length ? omp_get_max_threads() : 1;
+            std::vector<T> counts(numBins * numThreads, (T) 0.0f);
+
+#pragma omp parallel num_threads(numThreads) if (numThreads > 1)
+            {
+                T *local = counts.data() + omp_get_thread_num() * numBins;
 
-                }
+#pragma omp for schedule(static)
+                for (Nd4jIndex e = 0; e < length; e++)
+                    if (bins[e] < numBins)
+                        local[bins[e]] += weights == nullptr ? (T) 1.0f : w[e];
             }
+
+            for (Nd4jIndex b = 0; b < numBins; b++) {
+                T sum = (T) 0.0f;
+                for (int t = 0; t < numThreads; t++)
+                    sum += counts[t * numBins + b];
+
+                result->putIndexedScalar(b, sum);
+            }
+
             return ND4J_STATUS_OK;
         }
 
@@ -50,6 +69,9 @@ namespace nd4j {
             int maxIndex = in->argMax();
             int maxLength = int((*in)(maxIndex))  + 1;
 
+            if (block.numI() > 0)
+                maxLength = nd4j::math::nd4j_max(maxLength, INT_ARG(0));
+
             if (block.numI() > 1) 
                 maxLength = nd4j::math::nd4j_min(maxLength, INT_ARG(1));
 
@@ -4,6 +4,8 @@
 
 #include <ops/declarable/CustomOperations.h>
 #include <array>
+#include <ops/declarable/helpers/dynamic.h>
+#include <ops/declarable/helpers/gather.h>
 
 namespace nd4j {
 namespace ops {
@@ -19,52 +21,28 @@ namespace ops {
                 dim, input->sizeAt(dim), indices->sizeAt(dim));
         }
         int numPartition = INT_ARG(0);
-        std::vector<std::pair<NDArray<T>*, int>> outputs(numPartition);
-        if (input->rankOf() != indices->rankOf()) {
-            std::vector<int> sourceDims(input->rankOf() - indices->rankOf());
 
-            for (int i = sourceDims.size(); i > 0;  i--)
-                sourceDims[sourceDims.size() - i] = input->rankOf() - i;
+        std::vector<Nd4jIndex> partitions;
+        REQUIRE_TRUE(helpers::readIndices(*indices, partitions, (Nd4jIndex) numPartition), 0, "dynamic_partition: indices should be within [0, %i) range", numPartition);
 
-            std::unique_ptr<ResultSet<T>> listOfTensors(NDArrayFactory<T>::allTensorsAlongDimension(input, sourceDims));
-            for (int i = 0; i < numPartition; i++)
-            {
-                outputs[i].first = OUTPUT_VARIABLE(i);
-                std::vector<int> outDims(outputs[i].first->rankOf() - 1);
-                for (int k = 1; k < outputs[i].first->rankOf(); k++)
-                    outDims[k - 1] = k;
-                std::unique_ptr<ResultSet<T>> listOutForCurrent(NDArrayFactory<T>::allTensorsAlongDimension(outputs[i].first, outDims));
-                outputs[i].second = 0;
-                for (int e = 0; e < indices->lengthOf(); ++e)
-                    if ((*indices)(e) == T(i))
-                        listOutForCurrent->at(outputs[i].second++)->assign(listOfTensors->at(e));
-            }
-            
-        }
-        else
+        std::vector<NDArray<T>*> outputs(numPartition);
         for (int i = 0; i < numPartition; i++)
-        {
-            outputs[i].first = OUTPUT_VARIABLE(i);
-            outputs[i].second = 0;
-            for (int e = 0; e < indices->lengthOf(); ++e)
-                if ((*indices)(e) == T(i))
-                    outputs[i].first->putScalar(outputs[i].second++, (*input)(e));
-        }
-        
+            outputs[i] = OUTPUT_VARIABLE(i);
+
+        helpers::dynamicPartitionFunctor(input, partitions, outputs);
+
         return ND4J_STATUS_OK;
     }
 
     DECLARE_SHAPE_FN(dynamic_partition) {
         int numPartition = INT_ARG(0);
         NDArray<T>* indices = INPUT_VARIABLE(1);
-        std::vector<int> partitionSizes(numPartition, 0);
         int* in = inputShape->at(0);
         int* idx = inputShape->at(1); 
-        for (int i = 0; i < numPartition; i++) {
-            for (int e = 0; e < indices->lengthOf(); ++e)
-                if ((*indices)(e) == T(i))
-                    partitionSizes[i]++;
-        }
+
+        std::vector<Nd4jIndex> partitions;
+        REQUIRE_TRUE(helpers::readIndices(*indices, partitions, (Nd4jIndex) numPartition), 0, "dynamic_partition: indices should be within [0, %i) range", numPartition);
+        auto partitionSizes = helpers::partitionSizes(partitions, numPartition);
 
         auto shapes = SHAPELIST();
         int outRank = shape::rank(in) - shape::rank(idx) + 1;
@@ -75,7 +53,7 @@ namespace ops {
             newShape[0] = outRank;
             newShape[1] = partitionSizes[e];
             for(int i = 1; i < outRank; ++i)
-                newShape[i + 1] = shape::sizeAt(in, outRank + i - 1);
+                newShape[i + 1] = shape::sizeAt(in, shape::rank(idx) + i - 1);
 
             shape::updateStrides(newShape, shape::order(in));
 
@@ -4,6 +4,7 @@
 
 #include <ops/declarable/CustomOperations.h>
 #include <helpers/ShapeUtils.h>
+#include <ops/declarable/helpers/gather.h>
 #include <vector>
 #include <numeric>
 
@@ -22,21 +23,15 @@ CUSTOM_OP_IMPL(embedding_lookup, 2, 1, false, 0, 1) {
    
     REQUIRE_TRUE(indexRank > 0, 0, "embeded_lookup: input array of indexes can't be single scalar, the requirement is: rank > 0 !");
 
-    int inputRank = input->rankOf();
-    int lastIndDim = indeces->lengthOf();
-    int partition_mode = INT_ARG(0); // partition_mode == 0 - i.e. 'mod' , 1 - 'div'
-    
-    nd4j::ops::gather<T> op;
+    // rows of lookup param are picked by indices, in 'mod' partition mode with single param that's gather along first dimension
+    std::vector<Nd4jIndex> idx;
+    REQUIRE_TRUE(helpers::readIndices(*indeces, idx, (Nd4jIndex) input->sizeAt(0)), 0, "embedding_lookup: indices should be within range of first dimension of input array !");
+
+    Nd4jIndex rowLength = input->lengthOf() / input->sizeAt(0);
+    REQUIRE_TRUE(output->lengthOf() == (Nd4jIndex) idx.size() * rowLength, 0, "embedding_lookup: wrong shape of output array.");
+
+    helpers::gatherRows(*input, idx, *output, rowLength);
 
-    ResultSet<T>* result = op.execute({input, indeces}, {}, {0});
-    REQUIRE_TRUE(result->status() == ND4J_STATUS_OK, 0, "embedding_lookup: cannot retrieve results from gather op.");
-    REQUIRE_TRUE(result->at(0)->isSameShape(output), 0, "embedding_lookup: wrong shape of return from gather op.");
-    
-    //if (partition_mode) {
-        for (int e = 0; e < output->lengthOf(); e++)
-            (*output)(e) = result->at(0)->getScalar(e);
-    //}
-    delete result;
     return ND4J_STATUS_OK;
 }
 
@@ -4,6 +4,8 @@
 
 //#include <ops/declarable/headers/parity_ops.h>
 #include <ops/declarable/CustomOperations.h>
+#include <ops/declarable/helpers/top_k.h>
+#include <ops/declarable/helpers/gather.h>
 
 namespace nd4j {
     namespace ops {
@@ -19,26 +21,12 @@ namespace nd4j {
 
             int k = INT_ARG(0);
 
-            nd4j::ops::top_k<T> op;
-            auto topKResult = op.execute({predictions}, {}, {k, 1}); // with sorting
-            if (topKResult->status() != ND4J_STATUS_OK)
-                return topKResult->status();
-            auto topKIndeces = topKResult->at(1);
-            for (int e = 0; e < target->lengthOf(); e++) {
-                bool found = false;
-                for (int j = 0; j < k; j++) {
-                    if (target->getScalar(e) == topKIndeces->getScalar(e * k + j)) {
-                        found = true;
-                        break;
-                    }
-                }
-                if (found)
-                    result->putScalar(e, 1);
-                else
-                    result->putScalar(e, 0);
-            }
-            delete topKResult; // free memory from called operation
-            return ND4J_STATUS_OK;
+            REQUIRE_TRUE(k > 0, 0, "in_top_k: k should be positive, but %i given", k);
+
+            std::vector<Nd4jIndex> targets;
+            REQUIRE_TRUE(helpers::readIndices(*target, targets, (Nd4jIndex) predictions->sizeAt(1)), 0, "in_top_k: target should be within [0, %i) range", predictions->sizeAt(1));
+
+            return helpers::inTopKFunctor(predictions, targets, result, k);
         }
 
         DECLARE_SHAPE_FN(in_top_k) {
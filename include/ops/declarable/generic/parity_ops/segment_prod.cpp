@@ -14,13 +14,8 @@ namespace nd4j {
             REQUIRE_TRUE(idxSegments->isVector(), 0, "segment_prod: segment indexes array should be a vector, but it rank is %i.", idxSegments->rankOf());
             REQUIRE_TRUE(idxSegments->lengthOf() == input->sizeAt(0), 0, "segment_prod: segment indexes array length should be equal to the input first dimension, but %i != %i.", idxSegments->lengthOf(), input->sizeAt(0));
 
-            T val = (*idxSegments)(0);
-            for (int e = 1; e < idxSegments->lengthOf(); e++) {
-                REQUIRE_TRUE(val <= (*idxSegments)(e), 0, "segment_prod: segment indices should be arranged, but %2.1f > %2.1f",
-                    val, (*idxSegments)(e))
-                
-                val = (*idxSegments)(e);
-            }
+            T expected, wrong;
+            REQUIRE_TRUE(helpers::segmentIndicesValidate(idxSegments, expected, wrong), 0, "segment_prod: segment indices should be arranged, but %2.1f > %2.1f", expected, wrong);
 
             helpers::segmentProdFunctor(input, idxSegments, segmentedOutput);
 
@@ -16,7 +16,8 @@ namespace nd4j {
             NDArray<T>* indeces = OUTPUT_VARIABLE(1);
             if (block.numI() > 0) {
                 k = INT_ARG(0);
-                needSort = INT_ARG(1);
+                if (block.numI() > 1)
+                    needSort = INT_ARG(1);
             }
 
             REQUIRE_TRUE(k <= x->sizeAt(-1), 0, "top_k: k should not be greater than last dimension");
@@ -0,0 +1,46 @@
+//
+//  @author raver119@gmail.com
+//
+
+#include <ops/declarable/CustomOperations.h>
+#include <ops/declarable/helpers/segment.h>
+#include <ops/declarable/helpers/gather.h>
+
+namespace nd4j {
+    namespace ops {
+        CUSTOM_OP_IMPL(unsorted_segment_prod, 2, 1, false, 0, 1) {
+            NDArray<T>* input = INPUT_VARIABLE(0);
+            NDArray<T>* idxSegments = INPUT_VARIABLE(1);
+            NDArray<T>* segmentedOutput = OUTPUT_VARIABLE(0);
+            int numOfClasses = INT_ARG(0);
+            REQUIRE_TRUE(idxSegments->isVector(), 0, "unsorted_segment_prod: segment indexes array should be a vector, but it rank is %i.", idxSegments->rankOf());
+            REQUIRE_TRUE(idxSegments->lengthOf() == input->sizeAt(0), 0, "unsorted_segment_prod: segment indexes array length should be equal to the input first dimension, but %i != %i.", idxSegments->lengthOf(), input->sizeAt(0));
+
+            std::vector<Nd4jIndex> ids;
+            REQUIRE_TRUE(helpers::readIndices(*idxSegments, ids, (Nd4jIndex) numOfClasses), 0, "unsorted_segment_prod: segment indices should be within [0, %i) range", numOfClasses);
+
+            helpers::unsortedSegmentProdFunctor(input, ids, segmentedOutput);
+
+            return ND4J_STATUS_OK;
+        }
+
+        DECLARE_SHAPE_FN(unsorted_segment_prod) {
+            int* in = inputShape->at(0);
+            int outRank = shape::rank(in);
+            int* outputShape = nullptr;
+            int numOfClasses = INT_ARG(0);
+
+            ALLOCATE(outputShape, block.getWorkspace(), shape::shapeInfoLength(outRank), int);
+
+            outputShape[0] = outRank;
+            outputShape[1] = numOfClasses;
+            for(int i = 1; i < outRank; ++i)
+                outputShape[i + 1] = shape::sizeAt(in, i);
+
+            shape::updateStrides(outputShape, shape::order(in));
+
+            return SHAPELIST(outputShape);
+        }
+    }
+
+}
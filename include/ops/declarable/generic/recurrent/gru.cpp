@@ -3,7 +3,7 @@
 //
 
 #include <ops/declarable/CustomOperations.h>
-#include<ops/declarable/helpers/gruCell.h>
+#include<ops/declarable/helpers/rnnSequence.h>
 
 namespace nd4j {
 namespace ops {
@@ -36,20 +36,8 @@ CUSTOM_OP_IMPL(gru, 5, 1, false, 0, 0) {
     // check shape of biases
     REQUIRE_TRUE(b->isSameShape({3*numUnits}), 0, "CUSTOM_OP gruCell: the shape of biases is wrong !");
 
-    NDArray<T> currentH(h0);
-
-    ResultSet<T>* xSubArrs = NDArrayFactory<T>::allExamples(x);
-    ResultSet<T>* hSubArrs = NDArrayFactory<T>::allExamples(h);
-    
-    // loop through time steps
-    for (int t = 0; t < time; ++t) {
-
-        helpers::gruCell<T>({xSubArrs->at(t),&currentH, Wx,Wh,b}, hSubArrs->at(t));
-        currentH.assign(hSubArrs->at(t));    
-    }
-    
-    delete xSubArrs;
-    delete hSubArrs;    
+    // input-to-hidden product is calculated for all time steps at once, then loop through time steps
+    helpers::gruTimeLoop<T>({x, h0, Wx, Wh, b}, h, block.getWorkspace());
 
     return Status::OK();
 }
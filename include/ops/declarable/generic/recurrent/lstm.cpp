@@ -3,7 +3,7 @@
 //
 
 #include <ops/declarable/CustomOperations.h>
-#include<ops/declarable/helpers/lstmCell.h>
+#include<ops/declarable/helpers/rnnSequence.h>
 
 namespace nd4j {
 namespace ops {
@@ -53,24 +53,8 @@ CUSTOM_OP_IMPL(lstm, 8, 2, false, 3, 2) {
     REQUIRE_TRUE((INPUT_VARIABLE(7))->isSameShape({4*numUnits}), 0, "CUSTOM_OP lstm: the shape of biases is wrong !");
     REQUIRE_TRUE(!(!projection && numUnits != numProj), 0, "CUSTOM_OP lstm: projection option is switched of, and in this case output dimensionality for the projection matrices (numProj) must be equal to number of units in lstmCell !");
 
-    NDArray<T> currentH(h0);
-    NDArray<T> currentC(c0);
-
-    ResultSet<T>* xSubArrs = NDArrayFactory<T>::allExamples(x);
-    ResultSet<T>* hSubArrs = NDArrayFactory<T>::allExamples(h);
-    ResultSet<T>* cSubArrs = NDArrayFactory<T>::allExamples(c);
-
-    // loop through time steps
-    for (int t = 0; t < time; ++t) {
-
-        helpers::lstmCell<T>({xSubArrs->at(t),&currentH,&currentC, Wx,Wh,Wc,Wp, b},   {hSubArrs->at(t),cSubArrs->at(t)},   {(T)peephole, (T)projection, clippingCellValue, clippingProjValue, forgetBias});
-        currentH.assign(hSubArrs->at(t));
-        currentC.assign(cSubArrs->at(t));
-    }
-    
-    delete xSubArrs;
-    delete hSubArrs;
-    delete cSubArrs;
+    // input-to-hidden product is calculated for all time steps at once, then loop through time steps
+    helpers::lstmTimeLoop<T>({x,h0,c0, Wx,Wh,Wc,Wp, b},   {h,c},   {(T)peephole, (T)projection, clippingCellValue, clippingProjValue, forgetBias}, block.getWorkspace());
 
     return Status::OK();
 }
@@ -7,6 +7,7 @@
 #include <op_boilerplate.h>
 #include <ops/declarable/CustomOperations.h>
 #include <NDArray.h>
+#include <ops/declarable/helpers/rnnSequence.h>
 
 
 namespace nd4j {
@@ -53,55 +54,13 @@ CUSTOM_OP_IMPL(sru, 5, 2, false, 0, 0) {
     const int K      = input->shapeOf()[1];                     // K - number of features
     const int N      = input->shapeOf()[2];                     // N - number of time steps
     
-    // multiplication matrix = matmul(weights,input)
+    // multiplication matrix = matmul(weights,input), for all time steps at once
     NDArray<T>* wi = NDArrayFactory<T>::mmulHelper(weights, input, nullptr, (T)1., (T)0.);      //       U [bS x 3K x N]    
-    // wi.printShapeInfo();
-    NDArray<T>* wiZ = wi->subarray( { NDIndex::all(), NDIndex::interval(0,K),     NDIndex::all() } );       // [bS x K x N]
-    NDArray<T>* wiF = wi->subarray( { NDIndex::all(), NDIndex::interval(K,2*K),   NDIndex::all() } );       // forget gate [bS x K x N]
-    NDArray<T>* wiR = wi->subarray( { NDIndex::all(), NDIndex::interval(2*K,3*K), NDIndex::all() } );       // reset gate [bS x K x N]
-    NDArray<T>* bF  = bias->subarray( { NDIndex::all(), NDIndex::interval(0,K)  } );                        // biases for forget gate [1 x K]
-    NDArray<T>* bR  = bias->subarray( { NDIndex::all(), NDIndex::interval(K,2*K)} );                        // biases for reset gate [1 x K]
 
-    NDArray<T>* xt(nullptr), *zt(nullptr), *ft(nullptr), *rt(nullptr), *ct(nullptr), *ht(nullptr);
-    NDArray<T>* ct_1 = init->dup(init->ordering());
-    NDArray<T>* gct  = new NDArray<T>(state->ordering(), {bS, K});
-    NDArray<T>* xmt  = input->dup(input->ordering());          
-    //  input = input * mask
-    if(applyMask)
-        xmt->template applyBroadcast<simdOps::Multiply<T>>({0, 1}, mask, xmt, nullptr);            // apply mask    
-        
-    for (int t = 0; t < N; ++t) {
-        xt = timestep(xmt, t, t+1);         // [bS x K x N] -> [bS x K x 1] -> [bS x K]
-        zt = timestep(wiZ, t, t+1);         // [bS x K x N] -> [bS x K x 1] -> [bS x K]
-        ft = timestep(wiF, t, t+1);         // [bS x K x N] -> [bS x K x 1] -> [bS x K]
-        rt = timestep(wiR, t, t+1);         // [bS x K x N] -> [bS x K x 1] -> [bS x K]
-        ct = timestep(state, t, t+1);       // [bS x K x N] -> [bS x K x 1] -> [bS x K]
-        ht = timestep(output, t, t+1);      // [bS x K x N] -> [bS x K x 1] -> [bS x K]
-       
-        // ft = sigmoid(ft + bf), rt = sigmoid(rt + bR)
-        ft->addRowVector(bF, ft);
-        rt->addRowVector(bR, rt);
-        ft->template applyTransform<simdOps::Sigmoid<T>>();
-        rt->template applyTransform<simdOps::Sigmoid<T>>();        
-        // ct = ft * c_t-1 + (1 - ft) * zt,  
-        ft->template applyPairwiseTransform<simdOps::Multiply<T>>(ct_1, ct, nullptr);
-        ft->template applyTransform<simdOps::OneMinus<T>>(ft);
-        ft->template applyPairwiseTransform<simdOps::Multiply<T>>(zt, nullptr);
-        ct->template applyPairwiseTransform<simdOps::Add<T>>(ft, nullptr);
-        // TODO T val = (activation_type == 1) ? tanh(cur) : ((activation_type == 2) ? reluf(cur) : cur );
-        ct->template applyTransform<simdOps::Tanh<T>>(gct);        
-
-        // ht = rt * gct + (1 - rt) * xt
-        rt->template applyPairwiseTransform<simdOps::Multiply<T>>(gct, ht, nullptr);
-        rt->template applyTransform<simdOps::OneMinus<T>>(rt);
-        rt->template applyPairwiseTransform<simdOps::Multiply<T>>(xt, nullptr);
-        ht->template applyPairwiseTransform<simdOps::Add<T>>(rt, nullptr);
+    // ct = ft * c_t-1 + (1 - ft) * zt, ht = rt * tanh(ct) + (1 - rt) * xt, with optional mask applied to xt
+    helpers::sruTimeLoop<T>({input, wi, bias, init, mask}, output, state);
 
-        delete xt; delete zt; delete ft; delete rt; delete ht; delete ct_1;
-        ct_1 = ct;
-    }
-    
-    delete wiZ; delete wiF; delete wiR; delete wi; delete bF; delete bR; delete ct_1; delete gct; delete xmt;
+    delete wi;
     
     return ND4J_STATUS_OK;
 }
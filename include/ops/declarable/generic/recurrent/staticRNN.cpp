@@ -3,7 +3,7 @@
 //
 
 #include <ops/declarable/CustomOperations.h>
-#include<ops/declarable/helpers/rnnCell.h>
+#include<ops/declarable/helpers/rnnSequence.h>
 
 namespace nd4j {
 namespace ops  {
@@ -39,32 +39,8 @@ CUSTOM_OP_IMPL(static_rnn, 4, 2, false, 0, 0) {
     const int inSize   = x->sizeAt(2);
     const int numUnits = Wx->sizeAt(1);
 
-    if(h0)
-        hPrev->assign(h0);
-    else 
-        *hPrev = 0.;   
-
-    // loop through time steps
-    for (int t = 0; t < time; ++t) {				
-        // loop through batch of inputs           
-    	for (int e = 0; e < bS; ++e) {              
-         
-            int maxStep = maxTimeStep ? (int)(*maxTimeStep)(e) : time;
-            NDArray<T> xt   = (*x)({{t,t+1}, {e,e+1}, {}}, true);
-            NDArray<T> ht   = (*h)({{t,t+1}, {e,e+1}, {}}, true);
-            NDArray<T> ht_1 = (*hPrev)({{e,e+1}, {}}, true);
-            
-            if(t >= maxStep) {                
-                ht = 0.;
-                if(maxStep != 0)                    
-                    ht_1.assign((*h)({{maxStep-1,maxStep}, {e,e+1}, {}}));                                                
-            }
-            else {
-                helpers::rnnCell<T>({&xt, &ht_1, Wx, Wh, b}, &ht);
-                ht_1.assign(ht);
-            }
-        }
-    }
+    // whole batch goes through each time step at once, inputs with time >= maxTimeStep get zero outputs and keep their last output as final one
+    helpers::rnnTimeLoop<T>({x, Wx, Wh, b, h0, maxTimeStep}, h, hPrev, block.getWorkspace());
     
     return Status::OK();
 }
@@ -4,6 +4,7 @@
 
 #include <ops/declarable/CustomOperations.h>
 #include <helpers/ShapeUtils.h>
+#include <ops/declarable/helpers/gather.h>
 #include <vector>
 #include <numeric>
 
@@ -29,73 +30,23 @@ CUSTOM_OP_IMPL(gather, 1, 1, false, 0, -2) {
 	if (block.width() > 1) {
 		NDArray<T>* indices = INPUT_VARIABLE(1);
 
-		for(int i = 0; i < indices->lengthOf(); ++i)
-        	REQUIRE_TRUE((int)indices->getIndexedScalar(i) < input->shapeOf()[axis], 0, "GATHER custom operation: some of input indexes is larger than corresponding shape of input array !");
+		std::vector<Nd4jIndex> idx;
+		REQUIRE_TRUE(helpers::readIndices(*indices, idx, (Nd4jIndex) input->shapeOf()[axis]), 0, "GATHER custom operation: some of input indexes is larger than corresponding shape of input array !");
 
-    
-    	// first case: indices consist of only one scalar
-   		if(indices->isScalar()) {
-   			std::vector<int> dimensions = ShapeUtils<T>::evalDimsToExclude(input->rankOf(), {axis});
-   			shape::TAD tad(input->getShapeInfo(), dimensions.data(), dimensions.size());
-   			tad.createTadOnlyShapeInfo();
-    		tad.createOffsets();
-    		NDArray<T> tadArr(input->getBuffer() + tad.tadOffsets[(int)indices->getScalar(0)], tad.tadOnlyShapeInfo);
-    		output->assign(&tadArr);
-   		}
-		else if (input->rankOf() == 1 && indices->isVector()) {
-			// special case
-			for (int e = 0; e < indices->lengthOf(); e++)
-				output->putScalar(e, input->getScalar(indices->getScalar(e)));
-		}
-   		// second case: indices is vector
-   		else if(indices->isVector()) {   	
-   			ResultSet<T>* listOut = NDArrayFactory<T>::allTensorsAlongDimension(output, ShapeUtils<T>::evalDimsToExclude(output->rankOf(), {axis}));
-   			ResultSet<T>* listIn  = NDArrayFactory<T>::allTensorsAlongDimension(input,  ShapeUtils<T>::evalDimsToExclude(input->rankOf(),  {axis}));
-   			for(int i = 0; i < listOut->size(); ++i)
-   				listOut->at(i)->assign(listIn->at((int)indices->getIndexedScalar(i)));
-   			delete listOut;
-   			delete listIn;
-   		}
-   		// third case: indices is usual n-dim array
-   		else {
-   			std::vector<int> dimsOut(indices->rankOf());
-	   		std::iota(dimsOut.begin(), dimsOut.end(), axis);   // fill with axis, axis+1, ... indices->rankOf()-1
-   			std::vector<int> temp1 = ShapeUtils<T>::evalDimsToExclude(output->rankOf(), dimsOut);
-	   		std::vector<int> temp2 = ShapeUtils<T>::evalDimsToExclude(input->rankOf(),  {axis});
-   			ResultSet<T>* listOut = NDArrayFactory<T>::allTensorsAlongDimension(output, temp1);
-	   		ResultSet<T>* listIn = NDArrayFactory<T>::allTensorsAlongDimension(input,  temp2 );
-   			for(int i = 0; i < listOut->size(); ++i)
-   				listOut->at(i)->assign(listIn->at((int)indices->getIndexedScalar(i)));
-   			delete listOut;
-   			delete listIn;
-   		}
+		// scalar, vector and n-dim indices all pick slices along axis, output just gets different shape
+		helpers::gather(*input, idx, *output, axis);
 
     	STORE_RESULT(*output);	
 	} else if (block.numI() > 1) {
 		
-		for(int i = 1; i < block.numI(); ++i)
+		std::vector<Nd4jIndex> idx;
+		for(int i = 1; i < block.numI(); ++i) {
         	REQUIRE_TRUE(block.getIArguments()->at(i) < input->shapeOf()[axis], 0, "GATHER custom operation: some of input indexes is larger than corresponding shape of input array !");
-
-		// we only allow scalar/vector case here
-		if (block.numI() == 2) {
-			// scalar case
-			std::vector<int> dimensions = ShapeUtils<T>::evalDimsToExclude(input->rankOf(), {axis});
-   			shape::TAD tad(input->getShapeInfo(), dimensions.data(), dimensions.size());
-   			tad.createTadOnlyShapeInfo();
-    		tad.createOffsets();
-    		NDArray<T> tadArr(input->getBuffer() + tad.tadOffsets[block.getIArguments()->at(1)], tad.tadOnlyShapeInfo);
-    		output->assign(&tadArr);
-		} else {
-			// vector case
-			ResultSet<T>* listOut = NDArrayFactory<T>::allTensorsAlongDimension(output, ShapeUtils<T>::evalDimsToExclude(output->rankOf(), {axis}));
-   			ResultSet<T>* listIn  = NDArrayFactory<T>::allTensorsAlongDimension(input,  ShapeUtils<T>::evalDimsToExclude(input->rankOf(),  {axis}));
-
-			// that's fine, since we know that number of iArgs matches number of elements in listOut
-   			for(int i = 0; i < listOut->size(); ++i)
-   				listOut->at(i)->assign(listIn->at(block.getIArguments()->at(i+1)));
-   			delete listOut;
-   			delete listIn;
+        	idx.emplace_back(block.getIArguments()->at(i));
 		}
+
+		// we only allow scalar/vector case here, both have the same layout
+		helpers::gather(*input, idx, *output, axis);
 	} else {
 		REQUIRE_TRUE(false, 0, "Gather: indices should be provided either as additional input array, or as IntArguments");
 	}
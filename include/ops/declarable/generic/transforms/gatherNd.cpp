@@ -4,6 +4,7 @@
 
 #include <ops/declarable/CustomOperations.h>
 #include <helpers/ShapeUtils.h>
+#include <ops/declarable/helpers/gather.h>
 #include <vector>
 #include <numeric>
 
@@ -21,60 +22,36 @@ CUSTOM_OP_IMPL(gather_nd, 2, 1, false, 0, 0) {
 
     REQUIRE_TRUE(indices->rankOf() > 0, 0, "GATHER_ND custom operation: input array of indexes can't be single scalar, the requirement is: rank > 0 !");
 
-    if (input->ordering() != 'c')
-        input->streamline('c');
-
-    if (indices->ordering() != 'c')
-        indices->streamline('c');
-
     int rank0 = input->rankOf();
-    int rank1 = indices->rankOf();
     int lastIndDim = indices->sizeAt(-1);
 
     REQUIRE_TRUE(lastIndDim <= rank0, 0, "GATHER_ND custom operation: the last dimension of indices array must be <= rank of input array !");
-    
-    std::vector<int> tadDims(rank0 - lastIndDim);
-    std::iota(tadDims.begin(), tadDims.end(), rank1-1);
-    ResultSet<T>* innerMostOut = NDArrayFactory<T>::allTensorsAlongDimension(output, tadDims); 
 
-    ResultSet<T>* innerMost1 = NDArrayFactory<T>::allTensorsAlongDimension(indices, {rank1-1});	
-    
-    std::iota(tadDims.begin(), tadDims.end(), lastIndDim);
-    ResultSet<T>* innerMost0 = NDArrayFactory<T>::allTensorsAlongDimension(input, tadDims);
-
-    int* outerShapeInfo = nullptr;
-    ALLOCATE(outerShapeInfo, block.getWorkspace(), shape::shapeInfoLength(lastIndDim), int);
-    outerShapeInfo[0] = lastIndDim;
-    for(int i = 1; i <= lastIndDim; ++i)
-        outerShapeInfo[i] = input->sizeAt(i-1);
-    shape::updateStrides(outerShapeInfo, input->ordering());
-
-    int* idx = new int[lastIndDim];
-
-    for(int i = 0; i < innerMost1->size(); ++i) {
-                
-        NDArray<T>* idxSubArr = innerMost1->at(i);        
-        
-        for(int j = 0; j < lastIndDim; ++j) {
-            REQUIRE_TRUE((int)(*idxSubArr)(j) < input->sizeAt(j), 0, "GATHER_ND custom operation: wrong elements in input indices array, each element must be smaller than corresponding dimension of input array !");        
-            idx[j] = (*idxSubArr)(j);
-        }
-                
-        int currentInd0 = (int)shape::getOffset(0, shape::shapeOf(outerShapeInfo), shape::stride(outerShapeInfo), idx, lastIndDim);
+    // each tuple of indices picks one row of input seen as [sizeAt(0) * ... * sizeAt(lastIndDim-1), rowLength] matrix
+    Nd4jIndex rowLength = 1;
+    for(int i = lastIndDim; i < rank0; ++i)
+        rowLength *= input->sizeAt(i);
+
+    Nd4jIndex maxSize = 0;
+    for(int j = 0; j < lastIndDim; ++j)
+        maxSize = nd4j::math::nd4j_max<Nd4jIndex>(maxSize, input->sizeAt(j));
 
-        if(rank0 != lastIndDim) {
-            NDArray<T>* outSubArr = innerMostOut->at(i);
-            outSubArr->assign(innerMost0->at(currentInd0));
+    std::vector<Nd4jIndex> coords;
+    REQUIRE_TRUE(helpers::readIndices(*indices, coords, maxSize), 0, "GATHER_ND custom operation: wrong elements in input indices array, each element must be smaller than corresponding dimension of input array !");
+
+    Nd4jIndex numRows = lastIndDim > 0 ? (Nd4jIndex) coords.size() / lastIndDim : 0;
+    std::vector<Nd4jIndex> rows(numRows);
+    for(Nd4jIndex i = 0; i < numRows; ++i) {
+        Nd4jIndex row = 0;
+        for(int j = 0; j < lastIndDim; ++j) {
+            Nd4jIndex coord = coords[i * lastIndDim + j];
+            REQUIRE_TRUE(coord < input->sizeAt(j), 0, "GATHER_ND custom operation: wrong elements in input indices array, each element must be smaller than corresponding dimension of input array !");
+            row = row * input->sizeAt(j) + coord;
         }
-        else
-            (*output)(i) = ((*input)(currentInd0));
+        rows[i] = row;
     }
 
-    delete innerMost1;
-    delete innerMost0;
-    delete innerMostOut;
-    delete []idx;
-    RELEASE(outerShapeInfo, block.getWorkspace());
+    helpers::gatherRows(*input, rows, *output, rowLength);
     
     return Status::OK();
 }
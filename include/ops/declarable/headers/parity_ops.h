@@ -755,5 +755,80 @@ namespace nd4j {
          */
         DECLARE_CUSTOM_OP(segment_mean, 2, 1, false, 0, 0);
 
+        /**
+         * unsorted_segment_max op. - make a tensor filled by max values according to index tensor given, indices may come in any order.
+         *
+         * input params:
+         *    0 - the tensor with data;
+         *    1 - the tensor with indices.
+         *
+         * int params:
+         *    0 - number of segments, indices should be within [0, number) range
+         *
+         * return value:
+         *    tensor with max values according to indices sets, segments without entries are filled with zeros.
+         */
+        DECLARE_CUSTOM_OP(unsorted_segment_max, 2, 1, false, 0, 1);
+
+        /**
+         * unsorted_segment_min op. - make a tensor filled by min values according to index tensor given, indices may come in any order.
+         *
+         * input params:
+         *    0 - the tensor with data;
+         *    1 - the tensor with indices.
+         *
+         * int params:
+         *    0 - number of segments, indices should be within [0, number) range
+         *
+         * return value:
+         *    tensor with min values according to indices sets, segments without entries are filled with zeros.
+         */
+        DECLARE_CUSTOM_OP(unsorted_segment_min, 2, 1, false, 0, 1);
+
+        /**
+         * unsorted_segment_sum op. - make a tensor filled by sum of values according to index tensor given, indices may come in any order.
+         *
+         * input params:
+         *    0 - the tensor with data;
+         *    1 - the tensor with indices.
+         *
+         * int params:
+         *    0 - number of segments, indices should be within [0, number) range
+         *
+         * return value:
+         *    tensor with sum of values according to indices sets, segments without entries are filled with zeros.
+         */
+        DECLARE_CUSTOM_OP(unsorted_segment_sum, 2, 1, false, 0, 1);
+
+        /**
+         * unsorted_segment_prod op. - make a tensor filled by product of values according to index tensor given, indices may come in any order.
+         *
+         * input params:
+         *    0 - the tensor with data;
+         *    1 - the tensor with indices.
+         *
+         * int params:
+         *    0 - number of segments, indices should be within [0, number) range
+         *
+         * return value:
+         *    tensor with product of values according to indices sets, segments without entries are filled with zeros.
+         */
+        DECLARE_CUSTOM_OP(unsorted_segment_prod, 2, 1, false, 0, 1);
+
+        /**
+         * unsorted_segment_mean op. - make a tensor filled by average of values according to index tensor given, indices may come in any order.
+         *
+         * input params:
+         *    0 - the tensor with data;
+         *    1 - the tensor with indices.
+         *
+         * int params:
+         *    0 - number of segments, indices should be within [0, number) range
+         *
+         * return value:
+         *    tensor with average of values according to indices sets, segments without entries are filled with zeros.
+         */
+        DECLARE_CUSTOM_OP(unsorted_segment_mean, 2, 1, false, 0, 1);
+
     }
 }
\ No newline at end of file
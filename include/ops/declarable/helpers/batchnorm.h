@@ -0,0 +1,50 @@
+//
+//  @author raver119@gmail.com
+//
+
+#ifndef LIBND4J_HELPERS_BATCHNORM_H
+#define LIBND4J_HELPERS_BATCHNORM_H
+
+#include <ops/declarable/helpers/helpers.h>
+#include <NDArray.h>
+#include <vector>
+
+namespace nd4j {
+    namespace ops {
+        namespace helpers {
+            /**
+             * This method returns TRUE if param broadcasts against array of given rank as scalar, or as vector of given length along given axis
+             */
+            template <typename T>
+            bool isPerChannel(NDArray<T>& param, const int rank, const int axis, const Nd4jIndex channels);
+
+            /**
+             * This method returns axis of input, which all params are per-channel vectors along. Scalar params fit any axis.
+             * -1 is returned if there's no such axis, i.e. params need general broadcast
+             */
+            template <typename T>
+            int channelAxis(NDArray<T>& input, const std::vector<NDArray<T>*>& params);
+
+            /**
+             * This method evaluates per-channel coefficients of inference batchnorm, so output = input * scale + shift
+             *
+             * @param gamma optional
+             * @param beta optional
+             */
+            template <typename T>
+            void batchnormCoefficients(NDArray<T>& mean, NDArray<T>& variance, NDArray<T>* gamma, NDArray<T>* beta, const T epsilon, const Nd4jIndex channels, std::vector<T>& scale, std::vector<T>& shift);
+
+            /**
+             * This method does inference batchnorm with per-channel params along given axis, in single pass over input:
+             * output = gamma * (input - mean) / sqrt(variance + epsilon) + beta
+             *
+             * @param gamma optional
+             * @param beta optional
+             */
+            template <typename T>
+            void batchnorm(NDArray<T>& input, NDArray<T>& mean, NDArray<T>& variance, NDArray<T>* gamma, NDArray<T>* beta, NDArray<T>& output, const int axis, const T epsilon);
+        }
+    }
+}
+
+#endif //LIBND4J_HELPERS_BATCHNORM_H
@@ -0,0 +1,27 @@
+//
+//  @author raver119@gmail.com
+//
+
+#ifndef LIBND4J_HELPERS_CONFUSION_H
+#define LIBND4J_HELPERS_CONFUSION_H
+
+#include <ops/declarable/helpers/helpers.h>
+#include <NDArray.h>
+#include <vector>
+
+namespace nd4j {
+    namespace ops {
+        namespace helpers {
+            /**
+             * This method accumulates weights (or ones) of (label, prediction) pairs into [numClasses x numClasses] output.
+             * Large inputs are counted into per-thread matrices, which are summed at the end
+             *
+             * @param weights optional
+             */
+            template <typename T>
+            void confusionFunctor(const std::vector<Nd4jIndex>& labels, const std::vector<Nd4jIndex>& predictions, NDArray<T>* weights, NDArray<T>& output);
+        }
+    }
+}
+
+#endif //LIBND4J_HELPERS_CONFUSION_H
@@ -6,6 +6,7 @@
 #include <types/float16.h>
 #include <ops/declarable/helpers/batched_gemm.h>
 #include <helpers/BlasHelper.h>
+#include <ops/gemm.h>
 
 
 namespace nd4j {
@@ -70,27 +71,16 @@ namespace nd4j {
                     RELEASE(tldC, arr->getWorkspace());
                     RELEASE(tsize, arr->getWorkspace());
                 } else {
-                    CBLAS_TRANSPOSE tA = (CBLAS_TRANSPOSE) transA;
-                    CBLAS_TRANSPOSE tB = (CBLAS_TRANSPOSE) transB;
-
-#pragma omp parallel for
+                    // each batch element goes to packed GEMM engine. for small batches threads are better spent within GEMM itself
+#pragma omp parallel for schedule(dynamic) if(batchSize >= omp_get_max_threads())
                     for (int p = 0; p < vA.size(); ++p) {
                         auto A = vA.at(p)->buffer();
                         auto B = vB.at(p)->buffer();
                         auto C = vC.at(p)->buffer();
                         auto alpha = alphas->getScalar(p);
                         auto beta = betas->getScalar(p);
-                        for (int m = 0; m < M; ++m) {
-                            for (int n = 0; n < N; ++n) {
-                                T c_mnp = 0;
-
-                                #pragma omp simd
-                                for (int k = 0; k < K; ++k)
-                                    c_mnp += A[tA == CblasNoTrans ? (m + k * ldA) : (m * ldA + k)] * B[tB == CblasNoTrans ? (k + n * ldB) : (k * ldB + n)];
 
-                                C[m + n * ldC] = alpha * c_mnp + beta * C[m + n * ldC];
-                            } 
-                        } 
+                        nd4j::blas::GEMM<T>::op(CblasColMajor, transA, transB, M, N, K, alpha, A, ldA, B, ldB, beta, C, ldC);
                     }
                 }
             };
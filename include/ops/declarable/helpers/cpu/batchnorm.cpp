@@ -0,0 +1,182 @@
+//
+//  @author raver119@gmail.com
+//
+
+#include <ops/declarable/helpers/batchnorm.h>
+#include <helpers/TadCache.h>
+#include <templatemath.h>
+
+namespace nd4j {
+    namespace ops {
+        namespace helpers {
+            // axis of input the only non-unit dimension of param is aligned with, when param broadcasts against input of given rank
+            template <typename T>
+            static int vectorAxis(NDArray<T>& param, const int rank) {
+                int axis = -1;
+                for (int e = 0; e < param.rankOf(); e++) {
+                    if (param.sizeAt(e) == 1)
+                        continue;
+
+                    if (axis >= 0)
+                        return -1;
+
+                    axis = rank - param.rankOf() + e;
+                }
+
+                return axis;
+            }
+
+            template <typename T>
+            bool isPerChannel(NDArray<T>& param, const int rank, const int axis, const Nd4jIndex channels) {
+                if (param.rankOf() > rank)
+                    return false;
+
+                if (param.lengthOf() == 1)
+                    return true;
+
+                return param.lengthOf() == channels && vectorAxis<T>(param, rank) == axis;
+            }
+
+            template <typename T>
+            int channelAxis(NDArray<T>& input, const std::vector<NDArray<T>*>& params) {
+                const int rank = input.rankOf();
+
+                int axis = -1;
+                for (auto param: params) {
+                    if (param == nullptr || param->lengthOf() == 1)
+                        continue;
+
+                    int a = vectorAxis<T>(*param, rank);
+                    if (a < 0 || (axis >= 0 && a != axis))
+                        return -1;
+
+                    axis = a;
+                }
+
+                // scalars only
+                if (axis < 0)
+                    axis = rank - 1;
+
+                for (auto param: params)
+                    if (param != nullptr && !isPerChannel<T>(*param, rank, axis, input.sizeAt(axis)))
+                        return -1;
+
+                return axis;
+            }
+
+            template <typename T>
+            void batchnormCoefficients(NDArray<T>& mean, NDArray<T>& variance, NDArray<T>* gamma, NDArray<T>* beta, const T epsilon, const Nd4jIndex channels, std::vector<T>& scale, std::vector<T>& shift) {
+                auto at = [] (NDArray<T>& param, Nd4jIndex c) -> double {
+                    return (double) param.getIndexedScalar(param.lengthOf() == 1 ? 0 : c);
+                };
+
+                scale.resize(channels);
+                shift.resize(channels);
+
+                for (Nd4jIndex c = 0; c < channels; c++) {
+                    double s = 1.0 / nd4j::math::nd4j_sqrt<double>(at(variance, c) + (double) epsilon);
+                    if (gamma != nullptr)
+                        s *= at(*gamma, c);
+
+                    double h = -at(mean, c) * s;
+                    if (beta != nullptr)
+                        h += at(*beta, c);
+
+                    scale[c] = (T) s;
+                    shift[c] = (T) h;
+                }
+            }
+
+            template <typename T>
+            void batchnorm(NDArray<T>& input, NDArray<T>& mean, NDArray<T>& variance, NDArray<T>* gamma, NDArray<T>* beta, NDArray<T>& output, const int axis, const T epsilon) {
+                const Nd4jIndex channels = input.sizeAt(axis);
+                const Nd4jIndex length = input.lengthOf();
+
+                std::vector<T> scaleVector, shiftVector;
+                batchnormCoefficients<T>(mean, variance, gamma, beta, epsilon, channels, scaleVector, shiftVector);
+
+                const T *scale = scaleVector.data();
+                const T *shift = shiftVector.data();
+
+                T *x = input.getBuffer();
+                T *z = output.getBuffer();
+
+                if (input.ordering() == 'c' && output.ordering() == 'c' && input.ews() == 1 && output.ews() == 1) {
+                    // input is [outer, channels, inner]
+                    Nd4jIndex inner = 1;
+                    for (int e = axis + 1; e < input.rankOf(); e++)
+                        inner *= input.sizeAt(e);
+
+                    const Nd4jIndex outer = length / (channels * inner);
+
+                    if (inner == 1) {
+#pragma omp parallel for schedule(guided) if (length > ELEMENT_THRESHOLD)
+                        for (Nd4jIndex o = 0; o < outer; o++) {
+                            const T *xo = x + o * channels;
+                            T *zo = z + o * channels;
+#pragma omp simd
+                            for (Nd4jIndex c = 0; c < channels; c++)
+                                zo[c] = xo[c] * scale[c] + shift[c];
+                        }
+                    } else {
+#pragma omp parallel for collapse(2) schedule(guided) if (length > ELEMENT_THRESHOLD)
+                        for (Nd4jIndex o = 0; o < outer; o++)
+                            for (Nd4jIndex c = 0; c < channels; c++) {
+                                const T *xc = x + (o * channels + c) * inner;
+                                T *zc = z + (o * channels + c) * inner;
+                                const T s = scale[c];
+                                const T h = shift[c];
+#pragma omp simd
+                                for (Nd4jIndex i = 0; i < inner; i++)
+                                    zc[i] = xc[i] * s + h;
+                            }
+                    }
+
+                    return;
+                }
+
+                // any strides: vectors along channel axis
+                const Nd4jIndex numVectors = length / channels;
+                const Nd4jIndex xStride = input.stridesOf()[axis];
+                const Nd4jIndex zStride = output.stridesOf()[axis];
+
+                Nd4jIndex zero = 0L;
+                Nd4jIndex *xOffsets = &zero;
+                Nd4jIndex *zOffsets = &zero;
+                std::shared_ptr<TadPack> xPack, zPack;
+                if (numVectors > 1) {
+                    xPack = TadCache::getInstance()->tadForDimensions(input.getShapeInfo(), axis);
+                    zPack = TadCache::getInstance()->tadForDimensions(output.getShapeInfo(), axis);
+                    xOffsets = xPack->primaryOffsets();
+                    zOffsets = zPack->primaryOffsets();
+                }
+
+#pragma omp parallel for schedule(guided) if (length > ELEMENT_THRESHOLD)
+                for (Nd4jIndex e = 0; e < numVectors; e++) {
+                    const T *xv = x + xOffsets[e];
+                    T *zv = z + zOffsets[e];
+#pragma omp simd
+                    for (Nd4jIndex c = 0; c < channels; c++)
+                        zv[c * zStride] = xv[c * xStride] * scale[c] + shift[c];
+                }
+            }
+
+
+            template bool isPerChannel<float>(NDArray<float>& param, const int rank, const int axis, const Nd4jIndex channels);
+            template bool isPerChannel<float16>(NDArray<float16>& param, const int rank, const int axis, const Nd4jIndex channels);
+            template bool isPerChannel<double>(NDArray<double>& param, const int rank, const int axis, const Nd4jIndex channels);
+
+            template int channelAxis<float>(NDArray<float>& input, const std::vector<NDArray<float>*>& params);
+            template int channelAxis<float16>(NDArray<float16>& input, const std::vector<NDArray<float16>*>& params);
+            template int channelAxis<double>(NDArray<double>& input, const std::vector<NDArray<double>*>& params);
+
+            template void batchnormCoefficients<float>(NDArray<float>& mean, NDArray<float>& variance, NDArray<float>* gamma, NDArray<float>* beta, const float epsilon, const Nd4jIndex channels, std::vector<float>& scale, std::vector<float>& shift);
+            template void batchnormCoefficients<float16>(NDArray<float16>& mean, NDArray<float16>& variance, NDArray<float16>* gamma, NDArray<float16>* beta, const float16 epsilon, const Nd4jIndex channels, std::vector<float16>& scale, std::vector<float16>& shift);
+            template void batchnormCoefficients<double>(NDArray<double>& mean, NDArray<double>& variance, NDArray<double>* gamma, NDArray<double>* beta, const double epsilon, const Nd4jIndex channels, std::vector<double>& scale, std::vector<double>& shift);
+
+            template void batchnorm<float>(NDArray<float>& input, NDArray<float>& mean, NDArray<float>& variance, NDArray<float>* gamma, NDArray<float>* beta, NDArray<float>& output, const int axis, const float epsilon);
+            template void batchnorm<float16>(NDArray<float16>& input, NDArray<float16>& mean, NDArray<float16>& variance, NDArray<float16>* gamma, NDArray<float16>* beta, NDArray<float16>& output, const int axis, const float16 epsilon);
+            template void batchnorm<double>(NDArray<double>& input, NDArray<double>& mean, NDArray<double>& variance, NDArray<double>* gamma, NDArray<double>* beta, NDArray<double>& output, const int axis, const double epsilon);
+        }
+    }
+}
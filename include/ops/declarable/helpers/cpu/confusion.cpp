@@ -0,0 +1,52 @@
+//
+//  @author raver119@gmail.com
+//
+
+#include <ops/declarable/helpers/confusion.h>
+#include <omp.h>
+
+namespace nd4j {
+    namespace ops {
+        namespace helpers {
+            template <typename T>
+            void confusionFunctor(const std::vector<Nd4jIndex>& labels, const std::vector<Nd4jIndex>& predictions, NDArray<T>* weights, NDArray<T>& output) {
+                const Nd4jIndex length = (Nd4jIndex) labels.size();
+                const Nd4jIndex numClasses = output.sizeAt(0);
+                const Nd4jIndex cells = numClasses * numClasses;
+
+                std::vector<T> w;
+                if (weights != nullptr) {
+                    w.resize(length);
+                    for (Nd4jIndex e = 0; e < length; e++)
+                        w[e] = weights->getIndexedScalar(e);
+                }
+
+                // per-thread matrices pay off only when they're small compared to input
+                const int numThreads = length > ELEMENT_THRESHOLD && cells * omp_get_max_threads() < length ? omp_get_max_threads() : 1;
+                std::vector<T> counts(cells * numThreads, (T) 0.0f);
+
+#pragma omp parallel num_threads(numThreads) if (numThreads > 1)
+                {
+                    T *local = counts.data() + omp_get_thread_num() * cells;
+
+#pragma omp for schedule(static)
+                    for (Nd4jIndex e = 0; e < length; e++)
+                        local[labels[e] * numClasses + predictions[e]] += weights == nullptr ? (T) 1.0f : w[e];
+                }
+
+                for (Nd4jIndex c = 0; c < cells; c++) {
+                    T sum = (T) 0.0f;
+                    for (int t = 0; t < numThreads; t++)
+                        sum += counts[t * cells + c];
+
+                    output.putIndexedScalar(c, sum);
+                }
+            }
+
+
+            template void confusionFunctor<float>(const std::vector<Nd4jIndex>& labels, const std::vector<Nd4jIndex>& predictions, NDArray<float>* weights, NDArray<float>& output);
+            template void confusionFunctor<float16>(const std::vector<Nd4jIndex>& labels, const std::vector<Nd4jIndex>& predictions, NDArray<float16>* weights, NDArray<float16>& output);
+            template void confusionFunctor<double>(const std::vector<Nd4jIndex>& labels, const std::vector<Nd4jIndex>& predictions, NDArray<double>* weights, NDArray<double>& output);
+        }
+    }
+}
@@ -0,0 +1,46 @@
+//
+//  @author @shugeo
+//
+
+#include <ops/declarable/helpers/dynamic.h>
+#include <ops/declarable/helpers/gather.h>
+
+namespace nd4j {
+    namespace ops {
+        namespace helpers {
+            std::vector<Nd4jIndex> partitionSizes(const std::vector<Nd4jIndex>& partitions, const int numPartitions) {
+                std::vector<Nd4jIndex> sizes(numPartitions, 0);
+                for (auto p: partitions)
+                    sizes[p]++;
+
+                return sizes;
+            }
+
+            template <typename T>
+            void dynamicPartitionFunctor(NDArray<T>* input, const std::vector<Nd4jIndex>& partitions, std::vector<NDArray<T>*>& outputs) {
+                const Nd4jIndex numRows = (Nd4jIndex) partitions.size();
+                if (numRows == 0)
+                    return;
+
+                const Nd4jIndex rowLength = input->lengthOf() / numRows;
+                auto sizes = partitionSizes(partitions, (int) outputs.size());
+
+                std::vector<std::vector<Nd4jIndex>> rows(outputs.size());
+                for (int p = 0; p < (int) outputs.size(); p++)
+                    rows[p].reserve(sizes[p]);
+
+                for (Nd4jIndex e = 0; e < numRows; e++)
+                    rows[partitions[e]].emplace_back(e);
+
+                for (int p = 0; p < (int) outputs.size(); p++)
+                    if (!rows[p].empty())
+                        gatherRows(*input, rows[p], *outputs[p], rowLength);
+            }
+
+
+            template void dynamicPartitionFunctor<float>(NDArray<float>* input, const std::vector<Nd4jIndex>& partitions, std::vector<NDArray<float>*>& outputs);
+            template void dynamicPartitionFunctor<float16>(NDArray<float16>* input, const std::vector<Nd4jIndex>& partitions, std::vector<NDArray<float16>*>& outputs);
+            template void dynamicPartitionFunctor<double>(NDArray<double>* input, const std::vector<Nd4jIndex>& partitions, std::vector<NDArray<double>*>& outputs);
+        }
+    }
+}
@@ -0,0 +1,115 @@
+//
+//  @author raver119@gmail.com
+//
+
+#include <ops/declarable/helpers/gather.h>
+#include <memory>
+
+namespace nd4j {
+    namespace ops {
+        namespace helpers {
+            template <typename T>
+            static FORCEINLINE bool isContiguous(NDArray<T>& array) {
+                return array.ordering() == 'c' && array.ews() == 1;
+            }
+
+            // z[outer, i, inner] = x[outer, indices[i], inner], for c-ordered buffers
+            template <typename T>
+            static void gatherSlices(T *x, T *z, const Nd4jIndex *indices, const Nd4jIndex numIndices, const Nd4jIndex outer, const Nd4jIndex axisLength, const Nd4jIndex inner) {
+                const Nd4jIndex numSlices = outer * numIndices;
+
+                if (inner == 1) {
+#pragma omp parallel for simd if (numSlices > ELEMENT_THRESHOLD) schedule(static)
+                    for (Nd4jIndex s = 0; s < numSlices; s++)
+                        z[s] = x[(s / numIndices) * axisLength + indices[s % numIndices]];
+                } else {
+#pragma omp parallel for if (numSlices > 1 && numSlices * inner > ELEMENT_THRESHOLD) schedule(static)
+                    for (Nd4jIndex s = 0; s < numSlices; s++)
+                        memcpy(z + s * inner, x + ((s / numIndices) * axisLength + indices[s % numIndices]) * inner, inner * sizeof(T));
+                }
+            }
+
+            // other layouts are gathered through c-ordered copies
+            template <typename T>
+            static void gatherContiguous(NDArray<T>& input, const std::vector<Nd4jIndex>& indices, NDArray<T>& output, const Nd4jIndex outer, const Nd4jIndex axisLength, const Nd4jIndex inner) {
+                std::unique_ptr<NDArray<T>> x;
+                std::unique_ptr<NDArray<T>> z;
+
+                gatherSlices<T>(linearBuffer(input, x), linearBuffer(output, z, false), indices.data(), (Nd4jIndex) indices.size(), outer, axisLength, inner);
+
+                if (z)
+                    output.assign(z.get());
+            }
+
+            template <typename T>
+            T* linearBuffer(NDArray<T>& array, std::unique_ptr<NDArray<T>>& copy, const bool readContents) {
+                if (!isContiguous(array))
+                    copy.reset(readContents ? array.dup('c') : new NDArray<T>('c', array.getShapeAsVector(), array.getWorkspace()));
+
+                return copy ? copy->getBuffer() : array.getBuffer();
+            }
+
+            template <typename T>
+            bool readIndices(NDArray<T>& indices, std::vector<Nd4jIndex>& result, const Nd4jIndex limit) {
+                const Nd4jIndex length = indices.lengthOf();
+                result.resize(length);
+
+                Nd4jIndex *z = result.data();
+                bool valid = true;
+
+                if (isContiguous(indices)) {
+                    T *x = indices.getBuffer();
+
+#pragma omp parallel for simd reduction(&&:valid) if (length > ELEMENT_THRESHOLD) schedule(static)
+                    for (Nd4jIndex e = 0; e < length; e++) {
+                        z[e] = (Nd4jIndex) x[e];
+                        valid = valid && z[e] >= 0 && z[e] < limit;
+                    }
+                } else {
+                    for (Nd4jIndex e = 0; e < length; e++) {
+                        z[e] = (Nd4jIndex) indices.getIndexedScalar(e);
+                        valid = valid && z[e] >= 0 && z[e] < limit;
+                    }
+                }
+
+                return valid;
+            }
+
+            template <typename T>
+            void gather(NDArray<T>& input, const std::vector<Nd4jIndex>& indices, NDArray<T>& output, const int axis) {
+                Nd4jIndex outer = 1;
+                Nd4jIndex inner = 1;
+
+                for (int e = 0; e < axis; e++)
+                    outer *= input.sizeAt(e);
+
+                for (int e = axis + 1; e < input.rankOf(); e++)
+                    inner *= input.sizeAt(e);
+
+                gatherContiguous(input, indices, output, outer, input.sizeAt(axis), inner);
+            }
+
+            template <typename T>
+            void gatherRows(NDArray<T>& input, const std::vector<Nd4jIndex>& rows, NDArray<T>& output, const Nd4jIndex rowLength) {
+                gatherContiguous(input, rows, output, 1, input.lengthOf() / rowLength, rowLength);
+            }
+
+
+            template bool readIndices<float>(NDArray<float>& indices, std::vector<Nd4jIndex>& result, const Nd4jIndex limit);
+            template bool readIndices<float16>(NDArray<float16>& indices, std::vector<Nd4jIndex>& result, const Nd4jIndex limit);
+            template bool readIndices<double>(NDArray<double>& indices, std::vector<Nd4jIndex>& result, const Nd4jIndex limit);
+
+            template float* linearBuffer<float>(NDArray<float>& array, std::unique_ptr<NDArray<float>>& copy, const bool readContents);
+            template float16* linearBuffer<float16>(NDArray<float16>& array, std::unique_ptr<NDArray<float16>>& copy, const bool readContents);
+            template double* linearBuffer<double>(NDArray<double>& array, std::unique_ptr<NDArray<double>>& copy, const bool readContents);
+
+            template void gather<float>(NDArray<float>& input, const std::vector<Nd4jIndex>& indices, NDArray<float>& output, const int axis);
+            template void gather<float16>(NDArray<float16>& input, const std::vector<Nd4jIndex>& indices, NDArray<float16>& output, const int axis);
+            template void gather<double>(NDArray<double>& input, const std::vector<Nd4jIndex>& indices, NDArray<double>& output, const int axis);
+
+            template void gatherRows<float>(NDArray<float>& input, const std::vector<Nd4jIndex>& rows, NDArray<float>& output, const Nd4jIndex rowLength);
+            template void gatherRows<float16>(NDArray<float16>& input, const std::vector<Nd4jIndex>& rows, NDArray<float16>& output, const Nd4jIndex rowLength);
+            template void gatherRows<double>(NDArray<double>& input, const std::vector<Nd4jIndex>& rows, NDArray<double>& output, const Nd4jIndex rowLength);
+        }
+    }
+}
@@ -0,0 +1,83 @@
+//
+//  @author raver119@gmail.com
+//
+
+#include <ops/declarable/helpers/listdiff.h>
+#include <ops/declarable/helpers/gather.h>
+#include <helpers/FlatHashSet.h>
+#include <memory>
+#include <vector>
+
+namespace nd4j {
+    namespace ops {
+        namespace helpers {
+            // marks values absent in keep
+            template <typename T>
+            static void markMissing(NDArray<T>* values, NDArray<T>* keep, std::vector<unsigned char>& missing, std::unique_ptr<NDArray<T>>& valuesCopy) {
+                std::unique_ptr<NDArray<T>> keepCopy;
+                T *k = linearBuffer(*keep, keepCopy);
+                T *v = linearBuffer(*values, valuesCopy);
+
+                FlatHashSet<T> set(keep->lengthOf());
+                set.insertAll(k, keep->lengthOf());
+
+                const Nd4jIndex length = values->lengthOf();
+                missing.resize(length);
+
+#pragma omp parallel for if (length > ELEMENT_THRESHOLD) schedule(static)
+                for (Nd4jIndex e = 0; e < length; e++)
+                    missing[e] = set.contains(v[e]) ? 0 : 1;
+            }
+
+            template <typename T>
+            Nd4jIndex listDiffCount(NDArray<T>* values, NDArray<T>* keep) {
+                std::vector<unsigned char> missing;
+                std::unique_ptr<NDArray<T>> valuesCopy;
+                markMissing(values, keep, missing, valuesCopy);
+
+                Nd4jIndex count = 0;
+                for (auto m: missing)
+                    count += m;
+
+                return count;
+            }
+
+            template <typename T>
+            Nd4jIndex listDiffFunctor(NDArray<T>* values, NDArray<T>* keep, NDArray<T>* output1, NDArray<T>* output2) {
+                std::vector<unsigned char> missing;
+                std::unique_ptr<NDArray<T>> valuesCopy;
+                markMissing(values, keep, missing, valuesCopy);
+
+                Nd4jIndex count = 0;
+                for (auto m: missing)
+                    count += m;
+
+                // caller validates sizes against returned count
+                if (output1->lengthOf() != count || output2->lengthOf() != count)
+                    return count;
+
+                T *v = valuesCopy ? valuesCopy->getBuffer() : values->getBuffer();
+
+                Nd4jIndex position = 0;
+                for (Nd4jIndex e = 0; e < (Nd4jIndex) missing.size(); e++) {
+                    if (missing[e]) {
+                        output1->putIndexedScalar(position, v[e]);
+                        output2->putIndexedScalar(position, (T) e);
+                        position++;
+                    }
+                }
+
+                return count;
+            }
+
+
+            template Nd4jIndex listDiffCount<float>(NDArray<float>* values, NDArray<float>* keep);
+            template Nd4jIndex listDiffCount<float16>(NDArray<float16>* values, NDArray<float16>* keep);
+            template Nd4jIndex listDiffCount<double>(NDArray<double>* values, NDArray<double>* keep);
+
+            template Nd4jIndex listDiffFunctor<float>(NDArray<float>* values, NDArray<float>* keep, NDArray<float>* output1, NDArray<float>* output2);
+            template Nd4jIndex listDiffFunctor<float16>(NDArray<float16>* values, NDArray<float16>* keep, NDArray<float16>* output1, NDArray<float16>* output2);
+            template Nd4jIndex listDiffFunctor<double>(NDArray<double>* values, NDArray<double>* keep, NDArray<double>* output1, NDArray<double>* output2);
+        }
+    }
+}
@@ -39,7 +39,9 @@ static void clipping(NDArray<T>* arr, T limit) {
         limit *= (T)(-1.);
 
     auto clip = LAMBDA_T(value, limit) {
-        if(value < -limit || value > limit)
+        if(value < -limit)
+            value = -limit;
+        else if(value > limit)
             value = limit;
         return value; 
     };
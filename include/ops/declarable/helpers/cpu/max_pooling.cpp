@@ -3,6 +3,7 @@
 //
 
 #include <ops/declarable/helpers/max_pooling.h>
+#include <ops/declarable/helpers/pooling2d.h>
 #include <ops/declarable/generic/helpers/convolutions.h>
 
 #include <NDArrayFactory.h>
@@ -40,23 +41,9 @@ namespace helpers {
 
             if (isSameMode)
                 ConvolutionUtils<T>::_calcPadding2D(pY, pX, oY, oX, inY, inX, params[0], params[1], params[2], params[3], params[6], params[7]);            
-            // 0,1 - kernel Height/Width; 2,3 - stride Height/Width; 4,5 - pad Height/Width; 6,7 - dilation Height/Width; 8 - same mode;
-
-            // 0,1 - kernel Height/Width; 2,3 - stride Height/Width; 4,5 - pad Height/Width; 6,7 - dilation Height/Width; 8,9 - poolingMode; 10 - divisor;
-            std::vector<T> argT = {(T) kY, (T) kX, (T) sY, (T) sX, (T) pY, (T) pX, (T) dY, (T)dX, (T)1.f, (T)0.f, (T)1.f, (T) oY, (T) oX};
-
-            input->template applyTransform<simdOps::Pooling2D<T>>(values, argT.data());
-            if (nullptr != indices) {
-                // for max_pool_with_argmax 
-                int total = input->lengthOf();
-                int part = total / bSize;
-                
-                for (int k = 0; k < total; )
-                for (int i = 0; i < part; i++) {
-                    (*indices)(k++) = i;
-                }
-            }
 
+            // indices are positions of max elements within each image, i.e. c * inY * inX + y * inX + x
+            pooling2d(*input, *values, kY, kX, sY, sX, pY, pX, dY, dX, 0, (T) 1.f, true, indices);
     }
     template void maxPoolingFunctor<float>(NDArray<float>* input, NDArray<float>* values, std::vector<int> const& params, NDArray<float>* indices);
     template void maxPoolingFunctor<float16>(NDArray<float16>* input, NDArray<float16>* values, std::vector<int> const& params, NDArray<float16>* indices);
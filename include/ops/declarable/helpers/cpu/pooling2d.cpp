@@ -0,0 +1,270 @@
+//
+//  @author raver119@gmail.com
+//
+
+#include <ops/declarable/helpers/pooling2d.h>
+#include <templatemath.h>
+
+namespace nd4j {
+    namespace ops {
+        namespace helpers {
+            // input positions covered by pooling window: [start, end) with step d. padded positions are skipped
+            static FORCEINLINE void windowBounds(const int o, const int s, const int p, const int k, const int d, const int size, int &start, int &end) {
+                start = o * s - p;
+                end = start + k + (k - 1) * (d - 1);
+
+                if (start < 0)
+                    start += ((-start + d - 1) / d) * d;
+
+                if (end > size)
+                    end -= ((end - size + d - 1) / d) * d;
+            }
+
+            static FORCEINLINE int windowSize(const int start, const int end, const int d) {
+                return end > start ? (end - start + d - 1) / d : 0;
+            }
+
+            // strides of batch, channels, height and width dimensions, for any data format
+            template <typename T>
+            static FORCEINLINE void strides4(NDArray<T>& array, const bool isNCHW, Nd4jIndex &b, Nd4jIndex &c, Nd4jIndex &h, Nd4jIndex &w) {
+                auto stride = array.stridesOf();
+                b = stride[0];
+                c = isNCHW ? stride[1] : stride[3];
+                h = isNCHW ? stride[2] : stride[1];
+                w = isNCHW ? stride[3] : stride[2];
+            }
+
+            template <typename T>
+            void pooling2d(NDArray<T>& input, NDArray<T>& output, const int kH, const int kW, const int sH, const int sW, const int pH, const int pW, const int dH, const int dW, const int poolingMode, const T extraParam0, const bool isNCHW, NDArray<T>* indices) {
+                const int bS = input.sizeAt(0);
+                const int iC = isNCHW ? input.sizeAt(1) : input.sizeAt(3);
+                const int iH = isNCHW ? input.sizeAt(2) : input.sizeAt(1);
+                const int iW = isNCHW ? input.sizeAt(3) : input.sizeAt(2);
+                const int oH = isNCHW ? output.sizeAt(2) : output.sizeAt(1);
+                const int oW = isNCHW ? output.sizeAt(3) : output.sizeAt(2);
+
+                Nd4jIndex xB, xC, xH, xW, zB, zC, zH, zW, iB = 0, iCs = 0, iHs = 0, iWs = 0;
+                strides4(input, isNCHW, xB, xC, xH, xW);
+                strides4(output, isNCHW, zB, zC, zH, zW);
+                if (indices != nullptr)
+                    strides4(*indices, isNCHW, iB, iCs, iHs, iWs);
+
+                T *x = input.getBuffer();
+                T *z = output.getBuffer();
+                T *idx = indices == nullptr ? nullptr : indices->getBuffer();
+
+                const T pInv = poolingMode == 2 ? (T) 1.0f / extraParam0 : (T) 1.0f;
+                const Nd4jIndex work = output.lengthOf() * kH * kW;
+
+                if (!isNCHW && xC == 1 && zC == 1 && idx == nullptr) {
+                    // NHWC: channels are contiguous, so each window position is processed for all channels at once
+#pragma omp parallel for collapse(2) schedule(guided) if (work > ELEMENT_THRESHOLD)
+                    for (int b = 0; b < bS; b++) {
+                        for (int oy = 0; oy < oH; oy++) {
+                            int hs, he;
+                            windowBounds(oy, sH, pH, kH, dH, iH, hs, he);
+
+                            for (int ox = 0; ox < oW; ox++) {
+                                int ws, we;
+                                windowBounds(ox, sW, pW, kW, dW, iW, ws, we);
+
+                                T *zp = z + b * zB + oy * zH + ox * zW;
+                                const T init = poolingMode == 0 ? (T) -MAX_FLOAT : (T) 0.0f;
+
+#pragma omp simd
+                                for (int c = 0; c < iC; c++)
+                                    zp[c] = init;
+
+                                for (int ky = hs; ky < he; ky += dH) {
+                                    for (int kx = ws; kx < we; kx += dW) {
+                                        T *xp = x + b * xB + ky * xH + kx * xW;
+
+                                        if (poolingMode == 0) {
+#pragma omp simd
+                                            for (int c = 0; c < iC; c++)
+                                                zp[c] = nd4j::math::nd4j_max<T>(zp[c], xp[c]);
+                                        } else if (poolingMode == 1) {
+#pragma omp simd
+                                            for (int c = 0; c < iC; c++)
+                                                zp[c] += xp[c];
+                                        } else {
+#pragma omp simd
+                                            for (int c = 0; c < iC; c++)
+                                                zp[c] += nd4j::math::nd4j_pow<T>(nd4j::math::nd4j_abs<T>(xp[c]), extraParam0);
+                                        }
+                                    }
+                                }
+
+                                if (poolingMode == 1) {
+                                    const T divisor = (int) extraParam0 == 0 ? (T) (windowSize(hs, he, dH) * windowSize(ws, we, dW)) : (T) (kH * kW);
+
+#pragma omp simd
+                                    for (int c = 0; c < iC; c++)
+                                        zp[c] /= divisor;
+                                } else if (poolingMode == 2) {
+#pragma omp simd
+                                    for (int c = 0; c < iC; c++)
+                                        zp[c] = nd4j::math::nd4j_pow<T>(zp[c], pInv);
+                                }
+                            }
+                        }
+                    }
+
+                    return;
+                }
+
+                // generic strided path: each thread gets its own images
+#pragma omp parallel for collapse(2) schedule(guided) if (work > ELEMENT_THRESHOLD)
+                for (int b = 0; b < bS; b++) {
+                    for (int c = 0; c < iC; c++) {
+                        T *xp = x + b * xB + c * xC;
+                        T *zp = z + b * zB + c * zC;
+
+                        for (int oy = 0; oy < oH; oy++) {
+                            int hs, he;
+                            windowBounds(oy, sH, pH, kH, dH, iH, hs, he);
+
+                            for (int ox = 0; ox < oW; ox++) {
+                                int ws, we;
+                                windowBounds(ox, sW, pW, kW, dW, iW, ws, we);
+
+                                T res = (T) 0.0f;
+                                if (poolingMode == 0) {
+                                    res = (T) -MAX_FLOAT;
+                                    Nd4jIndex arg = 0;
+                                    for (int ky = hs; ky < he; ky += dH) {
+                                        for (int kx = ws; kx < we; kx += dW) {
+                                            T v = xp[ky * xH + kx * xW];
+                                            if (v > res) {
+                                                res = v;
+                                                arg = ky * iW + kx;
+                                            }
+                                        }
+                                    }
+
+                                    if (idx != nullptr)
+                                        idx[b * iB + c * iCs + oy * iHs + ox * iWs] = (T) (isNCHW ? c * iH * iW + arg : arg * iC + c);
+                                } else if (poolingMode == 1) {
+                                    for (int ky = hs; ky < he; ky += dH)
+                                        for (int kx = ws; kx < we; kx += dW)
+                                            res += xp[ky * xH + kx * xW];
+
+                                    res /= (int) extraParam0 == 0 ? (T) (windowSize(hs, he, dH) * windowSize(ws, we, dW)) : (T) (kH * kW);
+                                } else {
+                                    for (int ky = hs; ky < he; ky += dH)
+                                        for (int kx = ws; kx < we; kx += dW)
+                                            res += nd4j::math::nd4j_pow<T>(nd4j::math::nd4j_abs<T>(xp[ky * xH + kx * xW]), extraParam0);
+
+                                    res = nd4j::math::nd4j_pow<T>(res, pInv);
+                                }
+
+                                zp[oy * zH + ox * zW] = res;
+                            }
+                        }
+                    }
+                }
+            }
+
+            template <typename T>
+            void pooling2dBP(NDArray<T>& input, NDArray<T>& gradO, NDArray<T>& gradI, const int kH, const int kW, const int sH, const int sW, const int pH, const int pW, const int dH, const int dW, const int poolingMode, const T extraParam0, const T eps, const bool isNCHW) {
+                const int bS = input.sizeAt(0);
+                const int iC = isNCHW ? input.sizeAt(1) : input.sizeAt(3);
+                const int iH = isNCHW ? input.sizeAt(2) : input.sizeAt(1);
+                const int iW = isNCHW ? input.sizeAt(3) : input.sizeAt(2);
+                const int oH = isNCHW ? gradO.sizeAt(2) : gradO.sizeAt(1);
+                const int oW = isNCHW ? gradO.sizeAt(3) : gradO.sizeAt(2);
+
+                Nd4jIndex xB, xC, xH, xW, oB, oC, oHs, oWs, gB, gC, gH, gW;
+                strides4(input, isNCHW, xB, xC, xH, xW);
+                strides4(gradO, isNCHW, oB, oC, oHs, oWs);
+                strides4(gradI, isNCHW, gB, gC, gH, gW);
+
+                T *x = input.getBuffer();
+                T *o = gradO.getBuffer();
+                T *g = gradI.getBuffer();
+
+                const T pInv = poolingMode == 2 ? (T) 1.0f / extraParam0 : (T) 1.0f;
+                const Nd4jIndex work = gradO.lengthOf() * kH * kW;
+
+                // windows overlap only within the same image, so images are processed independently
+#pragma omp parallel for collapse(2) schedule(guided) if (work > ELEMENT_THRESHOLD)
+                for (int b = 0; b < bS; b++) {
+                    for (int c = 0; c < iC; c++) {
+                        T *xp = x + b * xB + c * xC;
+                        T *op = o + b * oB + c * oC;
+                        T *gp = g + b * gB + c * gC;
+
+                        for (int y = 0; y < iH; y++)
+                            for (int w = 0; w < iW; w++)
+                                gp[y * gH + w * gW] = (T) 0.0f;
+
+                        for (int oy = 0; oy < oH; oy++) {
+                            int hs, he;
+                            windowBounds(oy, sH, pH, kH, dH, iH, hs, he);
+
+                            for (int ox = 0; ox < oW; ox++) {
+                                int ws, we;
+                                windowBounds(ox, sW, pW, kW, dW, iW, ws, we);
+
+                                if (he <= hs || we <= ws)
+                                    continue;
+
+                                T eps0 = op[oy * oHs + ox * oWs];
+
+                                if (poolingMode == 0) {
+                                    // gradient goes to the first max element within window
+                                    T max = (T) -MAX_FLOAT;
+                                    int my = hs, mx = ws;
+                                    for (int ky = hs; ky < he; ky += dH) {
+                                        for (int kx = ws; kx < we; kx += dW) {
+                                            T v = xp[ky * xH + kx * xW];
+                                            if (v > max) {
+                                                max = v;
+                                                my = ky;
+                                                mx = kx;
+                                            }
+                                        }
+                                    }
+
+                                    gp[my * gH + mx * gW] += eps0;
+                                } else if (poolingMode == 1) {
+                                    T val = eps0 / ((int) extraParam0 == 0 ? (T) (windowSize(hs, he, dH) * windowSize(ws, we, dW)) : (T) (kH * kW));
+
+                                    for (int ky = hs; ky < he; ky += dH)
+                                        for (int kx = ws; kx < we; kx += dW)
+                                            gp[ky * gH + kx * gW] += val;
+                                } else {
+                                    // d(pnorm)/dx = x * |x|^(p-2) / pnorm^(p-1)
+                                    T sum = (T) 0.0f;
+                                    for (int ky = hs; ky < he; ky += dH)
+                                        for (int kx = ws; kx < we; kx += dW)
+                                            sum += nd4j::math::nd4j_pow<T>(nd4j::math::nd4j_abs<T>(xp[ky * xH + kx * xW]), extraParam0);
+
+                                    T norm = nd4j::math::nd4j_pow<T>(sum, pInv);
+                                    T denom = nd4j::math::nd4j_max<T>(nd4j::math::nd4j_pow<T>(norm, extraParam0 - (T) 1.0f), eps);
+                                    T factor = eps0 / denom;
+
+                                    for (int ky = hs; ky < he; ky += dH) {
+                                        for (int kx = ws; kx < we; kx += dW) {
+                                            T v = xp[ky * xH + kx * xW];
+                                            gp[ky * gH + kx * gW] += factor * v * nd4j::math::nd4j_pow<T>(nd4j::math::nd4j_abs<T>(v), extraParam0 - (T) 2.0f);
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+
+            template void pooling2d<float>(NDArray<float>& input, NDArray<float>& output, const int kH, const int kW, const int sH, const int sW, const int pH, const int pW, const int dH, const int dW, const int poolingMode, const float extraParam0, const bool isNCHW, NDArray<float>* indices);
+            template void pooling2d<float16>(NDArray<float16>& input, NDArray<float16>& output, const int kH, const int kW, const int sH, const int sW, const int pH, const int pW, const int dH, const int dW, const int poolingMode, const float16 extraParam0, const bool isNCHW, NDArray<float16>* indices);
+            template void pooling2d<double>(NDArray<double>& input, NDArray<double>& output, const int kH, const int kW, const int sH, const int sW, const int pH, const int pW, const int dH, const int dW, const int poolingMode, const double extraParam0, const bool isNCHW, NDArray<double>* indices);
+
+            template void pooling2dBP<float>(NDArray<float>& input, NDArray<float>& gradO, NDArray<float>& gradI, const int kH, const int kW, const int sH, const int sW, const int pH, const int pW, const int dH, const int dW, const int poolingMode, const float extraParam0, const float eps, const bool isNCHW);
+            template void pooling2dBP<float16>(NDArray<float16>& input, NDArray<float16>& gradO, NDArray<float16>& gradI, const int kH, const int kW, const int sH, const int sW, const int pH, const int pW, const int dH, const int dW, const int poolingMode, const float16 extraParam0, const float16 eps, const bool isNCHW);
+            template void pooling2dBP<double>(NDArray<double>& input, NDArray<double>& gradO, NDArray<double>& gradI, const int kH, const int kW, const int sH, const int sW, const int pH, const int pW, const int dH, const int dW, const int poolingMode, const double extraParam0, const double eps, const bool isNCHW);
+        }
+    }
+}
@@ -0,0 +1,470 @@
+//
+// @author raver119@gmail.com
+//
+
+// sequence-level kernels for lstm, gru, static_rnn and sru ops, see rnnSequence.h
+
+
+#include <ops/declarable/helpers/rnnSequence.h>
+#include <helpers/BlasHelper.h>
+#include <ops/gemm.h>
+#include <templatemath.h>
+
+namespace nd4j    {
+namespace ops     {
+namespace helpers {
+
+
+//////////////////////////////////////////////////////////////////////////
+// describes 2d array as operand of row-major GEMM. Array without unit stride along any dimension is copied, and copy is returned
+template <typename T>
+static NDArray<T>* gemmOperand(NDArray<T>* arr, int& trans, int& ld) {
+
+    int* strides = arr->stridesOf();
+
+    if(strides[1] == 1 && strides[0] >= arr->sizeAt(1)) {
+        trans = CblasNoTrans;
+        ld = nd4j::math::nd4j_max<int>(1, strides[0]);
+        return arr;
+    }
+
+    if(strides[0] == 1 && strides[1] >= arr->sizeAt(0)) {
+        trans = CblasTrans;
+        ld = nd4j::math::nd4j_max<int>(1, strides[1]);
+        return arr;
+    }
+
+    trans = CblasNoTrans;
+    ld = arr->sizeAt(1);
+    return arr->dup('c');
+}
+
+//////////////////////////////////////////////////////////////////////////
+// pointer to first element of given column of GEMM operand
+template <typename T>
+static FORCEINLINE T* operandColumn(NDArray<T>* arr, int trans, int ld, int column) {
+
+    return arr->getBuffer() + (trans == CblasNoTrans ? column : (Nd4jIndex) column * ld);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// contiguous vector, copy is made only if given one is strided
+template <typename T>
+static FORCEINLINE NDArray<T>* contiguous(NDArray<T>* arr) {
+
+    return arr->ews() == 1 ? arr : arr->dup('c');
+}
+
+//////////////////////////////////////////////////////////////////////////
+// row-major C = A * B + beta * C, C rows are contiguous
+template <typename T>
+static void gemm(int M, int N, int K, T* A, int transA, int lda, T* B, int transB, int ldb, T beta, T* C, int ldc) {
+
+    if (BlasHelper::getInstance()->template hasGEMM<T>()) {
+        if (sizeof(T) == 4) {
+            BlasHelper::getInstance()->sgemm()(CblasRowMajor, (CBLAS_TRANSPOSE) transA, (CBLAS_TRANSPOSE) transB, M, N, K, 1.0f, (float *) A, lda, (float *) B, ldb, (float) beta, (float *) C, ldc);
+            return;
+        }
+        else if (sizeof(T) == 8) {
+            BlasHelper::getInstance()->dgemm()(CblasRowMajor, (CBLAS_TRANSPOSE) transA, (CBLAS_TRANSPOSE) transB, M, N, K, 1.0, (double *) A, lda, (double *) B, ldb, (double) beta, (double *) C, ldc);
+            return;
+        }
+    }
+
+    // float16 ends up here as well, built-in GEMM accumulates it in fp32
+    nd4j::blas::GEMM<T>::op(CblasRowMajor, transA, transB, M, N, K, (T) 1.0f, A, lda, B, ldb, beta, C, ldc);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// x [time x bS x inSize] is multiplied by W [inSize x N] for all time steps at once: gates [time*bS x N] = x * W
+template <typename T>
+static void inputProjection(NDArray<T>* x, NDArray<T>* W, NDArray<T>& gates) {
+
+    const int time   = x->sizeAt(0);
+    const int bS     = x->sizeAt(1);
+    const int inSize = x->sizeAt(2);
+    const int N      = gates.sizeAt(1);
+
+    // time and batch dimensions are merged, that's possible as long as rows of x are evenly spaced
+    int* strides = x->stridesOf();
+    NDArray<T>* xMat = x;
+    int ldx = strides[1];
+    if(strides[2] != 1 || strides[0] != (Nd4jIndex) bS * strides[1] || strides[1] < inSize) {
+        xMat = x->dup('c');
+        ldx = inSize;
+    }
+
+    int transW, ldw;
+    NDArray<T>* wMat = gemmOperand(W, transW, ldw);
+
+    gemm<T>(time * bS, N, inSize, xMat->getBuffer(), CblasNoTrans, ldx, wMat->getBuffer(), transW, ldw, (T) 0.0f, gates.getBuffer(), N);
+
+    if(xMat != x)
+        delete xMat;
+    if(wMat != W)
+        delete wMat;
+}
+
+//////////////////////////////////////////////////////////////////////////
+template <typename T>
+static FORCEINLINE T clip(T value, T limit) {
+
+    return nd4j::math::nd4j_max<T>(-limit, nd4j::math::nd4j_min<T>(limit, value));
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+template <typename T>
+void lstmTimeLoop(const std::vector<NDArray<T>*>& inArrs, const std::vector<NDArray<T>*>& outArrs, const std::vector<T>& params, nd4j::memory::Workspace* workspace) {
+
+    typedef typename nd4j::blas::GemmBlocking<T>::acc_type Acc;
+
+    NDArray<T>* x  = inArrs[0];                   // input [time x bS x inSize]
+    NDArray<T>* h0 = inArrs[1];                   // initial cell output [bS x numProj]
+    NDArray<T>* c0 = inArrs[2];                   // initial cell state  [bS x numUnits]
+    NDArray<T>* Wx = inArrs[3];                   // input-to-hidden  weights, [inSize  x 4*numUnits]
+    NDArray<T>* Wh = inArrs[4];                   // hidden-to-hidden weights, [numProj x 4*numUnits]
+    NDArray<T>* Wc = inArrs[5];                   // diagonal weights for peephole connections [3*numUnits]
+    NDArray<T>* Wp = inArrs[6];                   // projection weights [numUnits x numProj]
+    NDArray<T>* b  = inArrs[7];                   // biases, [4*numUnits]
+
+    NDArray<T>* h  = outArrs[0];                  // cell outputs [time x bS x numProj]
+    NDArray<T>* c  = outArrs[1];                  // cell states  [time x bS x numUnits]
+
+    const bool peephole          = (bool) params[0];
+    const bool projection        = (bool) params[1];
+    const Acc clippingCellValue  = nd4j::math::nd4j_abs<Acc>((Acc) params[2]);
+    const Acc clippingProjValue  = nd4j::math::nd4j_abs<Acc>((Acc) params[3]);
+    const Acc forgetBias         = (Acc) params[4];
+
+    const int time     = x->sizeAt(0);
+    const int bS       = x->sizeAt(1);
+    const int numProj  = h0->sizeAt(1);
+    const int numUnits = c0->sizeAt(1);
+    const int numGates = 4 * numUnits;
+
+    // z = x*Wx for all time steps, h_{t-1}*Wh is added to it at each step
+    NDArray<T> gates('c', {time * bS, numGates}, workspace);
+    inputProjection(x, Wx, gates);
+
+    NDArray<T> hPrev('c', {bS, numProj}, workspace);
+    NDArray<T> cPrev('c', {bS, numUnits}, workspace);
+    hPrev.assign(h0);
+    cPrev.assign(c0);
+
+    // cell output before projection
+    NDArray<T>* hRaw = projection ? new NDArray<T>('c', {bS, numUnits}, workspace) : nullptr;
+
+    int transWh, ldWh, transWp = CblasNoTrans, ldWp = 0;
+    NDArray<T>* whMat = gemmOperand(Wh, transWh, ldWh);
+    NDArray<T>* wpMat = projection ? gemmOperand(Wp, transWp, ldWp) : nullptr;
+    NDArray<T>* bVec  = contiguous(b);
+    NDArray<T>* wcVec = contiguous(Wc);
+
+    T* bias = bVec->getBuffer();
+    T* wc   = wcVec->getBuffer();
+    T* hp   = hPrev.getBuffer();
+    T* cp   = cPrev.getBuffer();
+    T* hDst = projection ? hRaw->getBuffer() : hp;
+
+    const Nd4jIndex hS0 = h->stridesOf()[0], hS1 = h->stridesOf()[1], hS2 = h->stridesOf()[2];
+    const Nd4jIndex cS0 = c->stridesOf()[0], cS1 = c->stridesOf()[1], cS2 = c->stridesOf()[2];
+
+    for (int t = 0; t < time; ++t) {
+
+        T* z    = gates.getBuffer() + (Nd4jIndex) t * bS * numGates;
+        T* hOut = h->getBuffer() + t * hS0;
+        T* cOut = c->getBuffer() + t * cS0;
+
+        // z += h_{t-1}*Wh
+        gemm<T>(bS, numGates, numProj, hp, CblasNoTrans, numProj, whMat->getBuffer(), transWh, ldWh, (T) 1.0f, z, numGates);
+
+#pragma omp parallel for schedule(static) if (bS * numUnits > ELEMENT_THRESHOLD)
+        for (int e = 0; e < bS * numUnits; ++e) {
+            const int i = e / numUnits;
+            const int u = e % numUnits;
+            T* zi = z + (Nd4jIndex) i * numGates;
+
+            Acc it = (Acc) zi[u]              + (Acc) bias[u];
+            Acc ft = (Acc) zi[numUnits + u]   + (Acc) bias[numUnits + u];
+            Acc gt = (Acc) zi[2*numUnits + u] + (Acc) bias[2*numUnits + u];
+            Acc ot = (Acc) zi[3*numUnits + u] + (Acc) bias[3*numUnits + u];
+            Acc ct_1 = (Acc) cp[e];
+
+            // peephole connections: input and forget gates look at previous cell state
+            if(peephole) {
+                it += ct_1 * (Acc) wc[u];
+                ft += ct_1 * (Acc) wc[numUnits + u];
+            }
+
+            Acc ct = nd4j::math::nd4j_sigmoid<Acc>(ft + forgetBias) * ct_1 + nd4j::math::nd4j_sigmoid<Acc>(it) * nd4j::math::nd4j_tanh<Acc>(gt);
+
+            if(clippingCellValue != (Acc) 0.0f)
+                ct = clip<Acc>(ct, clippingCellValue);
+
+            // ... and output gate looks at current one
+            if(peephole)
+                ot += ct * (Acc) wc[2*numUnits + u];
+
+            Acc ht = nd4j::math::nd4j_sigmoid<Acc>(ot) * nd4j::math::nd4j_tanh<Acc>(ct);
+
+            cp[e] = (T) ct;
+            cOut[i * cS1 + u * cS2] = (T) ct;
+            hDst[e] = (T) ht;
+
+            if(!projection)
+                hOut[i * hS1 + u * hS2] = (T) ht;
+        }
+
+        if(projection) {
+            gemm<T>(bS, numProj, numUnits, hDst, CblasNoTrans, numUnits, wpMat->getBuffer(), transWp, ldWp, (T) 0.0f, hp, numProj);
+
+#pragma omp parallel for schedule(static) if (bS * numProj > ELEMENT_THRESHOLD)
+            for (int e = 0; e < bS * numProj; ++e) {
+                Acc ht = (Acc) hp[e];
+                if(clippingProjValue != (Acc) 0.0f)
+                    ht = clip<Acc>(ht, clippingProjValue);
+
+                hp[e] = (T) ht;
+                hOut[(e / numProj) * hS1 + (e % numProj) * hS2] = (T) ht;
+            }
+        }
+    }
+
+    if(whMat != Wh)
+        delete whMat;
+    if(wpMat != nullptr && wpMat != Wp)
+        delete wpMat;
+    if(bVec != b)
+        delete bVec;
+    if(wcVec != Wc)
+        delete wcVec;
+
+    delete hRaw;
+}
+
+//////////////////////////////////////////////////////////////////////////
+template <typename T>
+void gruTimeLoop(const std::vector<NDArray<T>*>& inArrs, NDArray<T>* h, nd4j::memory::Workspace* workspace) {
+
+    typedef typename nd4j::blas::GemmBlocking<T>::acc_type Acc;
+
+    NDArray<T>* x  = inArrs[0];                   // input [time x bS x inSize]
+    NDArray<T>* h0 = inArrs[1];                   // initial cell output [bS x numUnits]
+    NDArray<T>* Wx = inArrs[2];                   // input-to-hidden  weights, [inSize   x 3*numUnits]
+    NDArray<T>* Wh = inArrs[3];                   // hidden-to-hidden weights, [numUnits x 3*numUnits]
+    NDArray<T>* b  = inArrs[4];                   // biases, [3*numUnits]
+
+    const int time     = x->sizeAt(0);
+    const int bS       = x->sizeAt(1);
+    const int numUnits = h0->sizeAt(1);
+    const int numGates = 3 * numUnits;
+
+    NDArray<T> gates('c', {time * bS, numGates}, workspace);
+    inputProjection(x, Wx, gates);
+
+    NDArray<T> hPrev('c', {bS, numUnits}, workspace);
+    NDArray<T> hReset('c', {bS, numUnits}, workspace);        // rt (*) h_{t-1}
+    hPrev.assign(h0);
+
+    int transWh, ldWh;
+    NDArray<T>* whMat = gemmOperand(Wh, transWh, ldWh);
+    NDArray<T>* bVec  = contiguous(b);
+
+    T* bias = bVec->getBuffer();
+    T* hp   = hPrev.getBuffer();
+    T* hr   = hReset.getBuffer();
+
+    const Nd4jIndex hS0 = h->stridesOf()[0], hS1 = h->stridesOf()[1], hS2 = h->stridesOf()[2];
+
+    for (int t = 0; t < time; ++t) {
+
+        T* z    = gates.getBuffer() + (Nd4jIndex) t * bS * numGates;
+        T* hOut = h->getBuffer() + t * hS0;
+
+        // reset and update gates: z[:, 0:2*numUnits] += h_{t-1}*Wh[:, 0:2*numUnits]
+        gemm<T>(bS, 2 * numUnits, numUnits, hp, CblasNoTrans, numUnits, whMat->getBuffer(), transWh, ldWh, (T) 1.0f, z, numGates);
+
+#pragma omp parallel for schedule(static) if (bS * numUnits > ELEMENT_THRESHOLD)
+        for (int e = 0; e < bS * numUnits; ++e) {
+            const int i = e / numUnits;
+            const int u = e % numUnits;
+            T* zi = z + (Nd4jIndex) i * numGates;
+
+            Acc rt = nd4j::math::nd4j_sigmoid<Acc>((Acc) zi[u] + (Acc) bias[u]);
+            Acc ut = nd4j::math::nd4j_sigmoid<Acc>((Acc) zi[numUnits + u] + (Acc) bias[numUnits + u]);
+
+            // update gate is kept in place till the end of this step
+            zi[numUnits + u] = (T) ut;
+            hr[e] = (T) (rt * (Acc) hp[e]);
+        }
+
+        // candidate: z[:, 2*numUnits:3*numUnits] += (rt (*) h_{t-1})*Wh[:, 2*numUnits:3*numUnits]
+        gemm<T>(bS, numUnits, numUnits, hr, CblasNoTrans, numUnits, operandColumn(whMat, transWh, ldWh, 2 * numUnits), transWh, ldWh, (T) 1.0f, z + 2 * numUnits, numGates);
+
+#pragma omp parallel for schedule(static) if (bS * numUnits > ELEMENT_THRESHOLD)
+        for (int e = 0; e < bS * numUnits; ++e) {
+            const int i = e / numUnits;
+            const int u = e % numUnits;
+            T* zi = z + (Nd4jIndex) i * numGates;
+
+            Acc ut = (Acc) zi[numUnits + u];
+            Acc hTilde = nd4j::math::nd4j_tanh<Acc>((Acc) zi[2*numUnits + u] + (Acc) bias[2*numUnits + u]);
+            Acc ht = ut * (Acc) hp[e] + ((Acc) 1.0f - ut) * hTilde;
+
+            hp[e] = (T) ht;
+            hOut[i * hS1 + u * hS2] = (T) ht;
+        }
+    }
+
+    if(whMat != Wh)
+        delete whMat;
+    if(bVec != b)
+        delete bVec;
+}
+
+//////////////////////////////////////////////////////////////////////////
+template <typename T>
+void rnnTimeLoop(const std::vector<NDArray<T>*>& inArrs, NDArray<T>* h, NDArray<T>* hFinal, nd4j::memory::Workspace* workspace) {
+
+    typedef typename nd4j::blas::GemmBlocking<T>::acc_type Acc;
+
+    NDArray<T>* x           = inArrs[0];          // input [time x bS x inSize]
+    NDArray<T>* Wx          = inArrs[1];          // input-to-hidden  weights, [inSize  x numUnits]
+    NDArray<T>* Wh          = inArrs[2];          // hidden-to-hidden weights, [numUnits x numUnits]
+    NDArray<T>* b           = inArrs[3];          // biases, [2*numUnits]: input-to-hidden and hidden-to-hidden ones
+    NDArray<T>* h0          = inArrs[4];          // initial cell output [bS x numUnits], optional
+    NDArray<T>* maxTimeStep = inArrs[5];          // max time step per each input in batch [bS], optional
+
+    const int time     = x->sizeAt(0);
+    const int bS       = x->sizeAt(1);
+    const int numUnits = Wx->sizeAt(1);
+
+    NDArray<T> gates('c', {time * bS, numUnits}, workspace);
+    inputProjection(x, Wx, gates);
+
+    NDArray<T> hPrev('c', {bS, numUnits}, workspace);
+    if(h0)
+        hPrev.assign(h0);
+    else
+        hPrev = (T) 0.0f;
+
+    std::vector<int> maxSteps(bS, time);
+    if(maxTimeStep)
+        for (int e = 0; e < bS; ++e)
+            maxSteps[e] = (int) (*maxTimeStep)(e);
+
+    int transWh, ldWh;
+    NDArray<T>* whMat = gemmOperand(Wh, transWh, ldWh);
+    NDArray<T>* bVec  = contiguous(b);
+
+    T* bias = bVec->getBuffer();
+    T* hp   = hPrev.getBuffer();
+
+    const Nd4jIndex hS0 = h->stridesOf()[0], hS1 = h->stridesOf()[1], hS2 = h->stridesOf()[2];
+
+    for (int t = 0; t < time; ++t) {
+
+        T* z    = gates.getBuffer() + (Nd4jIndex) t * bS * numUnits;
+        T* hOut = h->getBuffer() + t * hS0;
+
+        gemm<T>(bS, numUnits, numUnits, hp, CblasNoTrans, numUnits, whMat->getBuffer(), transWh, ldWh, (T) 1.0f, z, numUnits);
+
+#pragma omp parallel for schedule(static) if (bS * numUnits > ELEMENT_THRESHOLD)
+        for (int e = 0; e < bS * numUnits; ++e) {
+            const int i = e / numUnits;
+            const int u = e % numUnits;
+
+            // sequence is over: output is zero, and last output is kept as final one
+            if(t >= maxSteps[i]) {
+                hOut[i * hS1 + u * hS2] = (T) 0.0f;
+                continue;
+            }
+
+            Acc ht = nd4j::math::nd4j_tanh<Acc>((Acc) z[e] + (Acc) bias[u] + (Acc) bias[numUnits + u]);
+
+            hp[e] = (T) ht;
+            hOut[i * hS1 + u * hS2] = (T) ht;
+        }
+    }
+
+    hFinal->assign(&hPrev);
+
+    if(whMat != Wh)
+        delete whMat;
+    if(bVec != b)
+        delete bVec;
+}
+
+//////////////////////////////////////////////////////////////////////////
+template <typename T>
+void sruTimeLoop(const std::vector<NDArray<T>*>& inArrs, NDArray<T>* h, NDArray<T>* c) {
+
+    typedef typename nd4j::blas::GemmBlocking<T>::acc_type Acc;
+
+    NDArray<T>* x    = inArrs[0];                 // input [bS x K x N]
+    NDArray<T>* wi   = inArrs[1];                 // W * x [bS x 3K x N]
+    NDArray<T>* b    = inArrs[2];                 // biases for forget and reset gates [1 x 2K]
+    NDArray<T>* c0   = inArrs[3];                 // initial cell state [bS x K]
+    NDArray<T>* mask = inArrs[4];                 // dropout mask [bS x K], optional
+
+    const int bS = x->sizeAt(0);
+    const int K  = x->sizeAt(1);
+    const int N  = x->sizeAt(2);
+
+    const Nd4jIndex xS0 = x->stridesOf()[0],  xS1 = x->stridesOf()[1],  xS2 = x->stridesOf()[2];
+    const Nd4jIndex wS0 = wi->stridesOf()[0], wS1 = wi->stridesOf()[1], wS2 = wi->stridesOf()[2];
+    const Nd4jIndex hS0 = h->stridesOf()[0],  hS1 = h->stridesOf()[1],  hS2 = h->stridesOf()[2];
+    const Nd4jIndex cS0 = c->stridesOf()[0],  cS1 = c->stridesOf()[1],  cS2 = c->stridesOf()[2];
+
+    // recurrence is element-wise, so each (batch, feature) pair walks through time on its own
+#pragma omp parallel for schedule(guided) if (bS * K * N > ELEMENT_THRESHOLD)
+    for (int e = 0; e < bS * K; ++e) {
+        const int i = e / K;
+        const int k = e % K;
+
+        const Acc bF = (Acc) (*b)(k);
+        const Acc bR = (Acc) (*b)(K + k);
+        const Acc m  = mask != nullptr ? (Acc) (*mask)(i, k) : (Acc) 1.0f;
+        Acc ct = (Acc) (*c0)(i, k);
+
+        T* xt = x->getBuffer()  + i * xS0 + k * xS1;
+        T* zt = wi->getBuffer() + i * wS0 + k * wS1;
+        T* ft = zt + K * wS1;
+        T* rt = zt + 2 * K * wS1;
+        T* ht = h->getBuffer()  + i * hS0 + k * hS1;
+        T* st = c->getBuffer()  + i * cS0 + k * cS1;
+
+        for (int t = 0; t < N; ++t) {
+            Acc f = nd4j::math::nd4j_sigmoid<Acc>((Acc) ft[t * wS2] + bF);
+            Acc r = nd4j::math::nd4j_sigmoid<Acc>((Acc) rt[t * wS2] + bR);
+
+            ct = f * ct + ((Acc) 1.0f - f) * (Acc) zt[t * wS2];
+
+            st[t * cS2] = (T) ct;
+            ht[t * hS2] = (T) (r * nd4j::math::nd4j_tanh<Acc>(ct) + ((Acc) 1.0f - r) * (Acc) xt[t * xS2] * m);
+        }
+    }
+}
+
+
+template void lstmTimeLoop<float>(const std::vector<NDArray<float>*>& inArrs, const std::vector<NDArray<float>*>& outArrs, const std::vector<float>& params, nd4j::memory::Workspace* workspace);
+template void lstmTimeLoop<float16>(const std::vector<NDArray<float16>*>& inArrs, const std::vector<NDArray<float16>*>& outArrs, const std::vector<float16>& params, nd4j::memory::Workspace* workspace);
+template void lstmTimeLoop<double>(const std::vector<NDArray<double>*>& inArrs, const std::vector<NDArray<double>*>& outArrs, const std::vector<double>& params, nd4j::memory::Workspace* workspace);
+
+template void gruTimeLoop<float>(const std::vector<NDArray<float>*>& inArrs, NDArray<float>* h, nd4j::memory::Workspace* workspace);
+template void gruTimeLoop<float16>(const std::vector<NDArray<float16>*>& inArrs, NDArray<float16>* h, nd4j::memory::Workspace* workspace);
+template void gruTimeLoop<double>(const std::vector<NDArray<double>*>& inArrs, NDArray<double>* h, nd4j::memory::Workspace* workspace);
+
+template void rnnTimeLoop<float>(const std::vector<NDArray<float>*>& inArrs, NDArray<float>* h, NDArray<float>* hFinal, nd4j::memory::Workspace* workspace);
+template void rnnTimeLoop<float16>(const std::vector<NDArray<float16>*>& inArrs, NDArray<float16>* h, NDArray<float16>* hFinal, nd4j::memory::Workspace* workspace);
+template void rnnTimeLoop<double>(const std::vector<NDArray<double>*>& inArrs, NDArray<double>* h, NDArray<double>* hFinal, nd4j::memory::Workspace* workspace);
+
+template void sruTimeLoop<float>(const std::vector<NDArray<float>*>& inArrs, NDArray<float>* h, NDArray<float>* c);
+template void sruTimeLoop<float16>(const std::vector<NDArray<float16>*>& inArrs, NDArray<float16>* h, NDArray<float16>* c);
+template void sruTimeLoop<double>(const std::vector<NDArray<double>*>& inArrs, NDArray<double>* h, NDArray<double>* c);
+
+
+}
+}
+}
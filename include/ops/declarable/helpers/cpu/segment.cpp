@@ -3,270 +3,313 @@
 //
 
 #include <ops/declarable/helpers/segment.h>
-#include <NDArrayFactory.h>
+#include <ops/declarable/helpers/gather.h>
+#include <templatemath.h>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <omp.h>
 
 namespace nd4j {
 namespace ops {
 namespace helpers {
 
-    // segment max
+    // reduction ops applied to rows: first row of segment is copied, next ones are combined, and result is finished with row count
     template <typename T>
-    void segmentMaxFunctor(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* output) {
-        int numClasses = output->sizeAt(0);
-        // if input is a vector: (as if in doc sample)
-        int idx = static_cast<int>((*indices)(0));
-        if (input->isVector()) {
-            T val = (*input)(0);
-            for (int e = 1; e < indices->lengthOf(); e++) {
-                if (idx == static_cast<int>((*indices)(e))) {
-                   // max 
-                   val = nd4j::math::nd4j_max(val, (*input)(e));
-                }
-                else {
-                    idx = static_cast<int>((*indices)(e));
-                    val = (*input)(e);
-                }
-                (*output)(idx) = val;
+    struct SegmentMax {
+        static FORCEINLINE T op(T a, T b) { return nd4j::math::nd4j_max<T>(a, b); }
+        static FORCEINLINE T finish(T a, Nd4jIndex count) { return a; }
+    };
+
+    template <typename T>
+    struct SegmentMin {
+        static FORCEINLINE T op(T a, T b) { return nd4j::math::nd4j_min<T>(a, b); }
+        static FORCEINLINE T finish(T a, Nd4jIndex count) { return a; }
+    };
+
+    template <typename T>
+    struct SegmentSum {
+        static FORCEINLINE T op(T a, T b) { return a + b; }
+        static FORCEINLINE T finish(T a, Nd4jIndex count) { return a; }
+    };
+
+    template <typename T>
+    struct SegmentProd {
+        static FORCEINLINE T op(T a, T b) { return a * b; }
+        static FORCEINLINE T finish(T a, Nd4jIndex count) { return a; }
+    };
+
+    template <typename T>
+    struct SegmentMean {
+        static FORCEINLINE T op(T a, T b) { return a + b; }
+        static FORCEINLINE T finish(T a, Nd4jIndex count) { return a / (T) count; }
+    };
+
+    template <typename T, typename Op>
+    static FORCEINLINE void combineRow(T *z, const T *x, const Nd4jIndex length) {
+#pragma omp simd
+        for (Nd4jIndex i = 0; i < length; i++)
+            z[i] = Op::op(z[i], x[i]);
+    }
+
+    template <typename T, typename Op>
+    static FORCEINLINE void finishRow(T *z, const Nd4jIndex count, const Nd4jIndex length) {
+#pragma omp simd
+        for (Nd4jIndex i = 0; i < length; i++)
+            z[i] = Op::finish(z[i], count);
+    }
+
+    // reduces consecutive rows of x into z
+    template <typename T, typename Op>
+    static void reduceRows(const T *x, const Nd4jIndex numRows, const Nd4jIndex rowLength, T *z) {
+        memcpy(z, x, rowLength * sizeof(T));
+        for (Nd4jIndex r = 1; r < numRows; r++)
+            combineRow<T, Op>(z, x + r * rowLength, rowLength);
+
+        finishRow<T, Op>(z, numRows, rowLength);
+    }
+
+    // same as above, but rows are split between threads, and per-thread partial rows are combined in thread order
+    template <typename T, typename Op>
+    static void reduceRowsParallel(const T *x, const Nd4jIndex numRows, const Nd4jIndex rowLength, T *z) {
+        const int maxThreads = omp_get_max_threads();
+        std::vector<T> partials(maxThreads * rowLength);
+        std::vector<Nd4jIndex> counts(maxThreads, 0);
+
+#pragma omp parallel num_threads(maxThreads)
+        {
+            const int thread = omp_get_thread_num();
+            const Nd4jIndex span = (numRows + omp_get_num_threads() - 1) / omp_get_num_threads();
+            const Nd4jIndex start = nd4j::math::nd4j_min<Nd4jIndex>(numRows, thread * span);
+            const Nd4jIndex end = nd4j::math::nd4j_min<Nd4jIndex>(numRows, start + span);
+
+            if (start < end) {
+                T *partial = partials.data() + thread * rowLength;
+                memcpy(partial, x + start * rowLength, rowLength * sizeof(T));
+                for (Nd4jIndex r = start + 1; r < end; r++)
+                    combineRow<T, Op>(partial, x + r * rowLength, rowLength);
+
+                counts[thread] = end - start;
             }
         }
-        else {
-            std::vector<int> restDims(input->rankOf() - 1);
-            for (int e = 1; e < input->rankOf(); e++)
-                restDims[e - 1] = e;
-            ResultSet<T>* listOfTensors = NDArrayFactory<T>::allTensorsAlongDimension(input, restDims);
-            ResultSet<T>* listOfOutTensors = NDArrayFactory<T>::allTensorsAlongDimension(output, restDims);
-
-            int numOfClasses = output->sizeAt(0); // number of classes
-            std::vector<std::pair<NDArray<T>*, int>> outputs(numOfClasses);
-            NDArray<T>* maxT = listOfOutTensors->at(idx);
-
-            int pos = 0;
-            maxT->assign(listOfTensors->at(0));
-            for (int i = 1; i < indices->lengthOf(); i++) {
-                if (static_cast<int>((*indices)(i)) == idx) {
-                    for (int e = 0; e < maxT->lengthOf(); e++) {
-                       (*maxT)(e) = nd4j::math::nd4j_max((*maxT)(e), (*listOfTensors->at(i))(e));
-                    }
-                }
-                else {
-                    idx = static_cast<int>((*indices)(i));
-                    maxT = listOfOutTensors->at(idx);
-                    maxT->assign(listOfTensors->at(i));
-                }
 
-            }
-            delete listOfTensors;
-            delete listOfOutTensors;
+        bool first = true;
+        for (int t = 0; t < maxThreads; t++) {
+            if (counts[t] == 0)
+                continue;
+
+            if (first)
+                memcpy(z, partials.data() + t * rowLength, rowLength * sizeof(T));
+            else
+                combineRow<T, Op>(z, partials.data() + t * rowLength, rowLength);
+
+            first = false;
         }
+
+        finishRow<T, Op>(z, numRows, rowLength);
     }
 
-    // segmen min 
-    template <typename T>
-    void segmentMinFunctor(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* output) {
-        int numClasses = output->sizeAt(0);
-        // if input is a vector: (as if in doc sample)
-        int idx = static_cast<int>((*indices)(0));
-        if (input->isVector()) {
-            T val = (*input)(0);
-            for (int e = 1; e < indices->lengthOf(); e++) {
-                if (idx == static_cast<int>((*indices)(e))) {
-                   // min 
-                   val = nd4j::math::nd4j_min(val, (*input)(e));
-                }
-                else {
-                    idx = static_cast<int>((*indices)(e));
-                    val = (*input)(e);
-                }
-                (*output)(idx) = val;
-            }
+    template <typename T, typename Op>
+    static void sortedSegments(const T *x, const std::vector<Nd4jIndex>& ids, T *z, const Nd4jIndex numSegments, const Nd4jIndex rowLength) {
+        const Nd4jIndex numRows = (Nd4jIndex) ids.size();
+        std::fill(z, z + numSegments * rowLength, (T) 0.0f);
+
+        // segment boundaries, found with single scan
+        std::vector<Nd4jIndex> starts;
+        for (Nd4jIndex r = 0; r < numRows; r++)
+            if (r == 0 || ids[r] != ids[r - 1])
+                starts.emplace_back(r);
+
+        const Nd4jIndex numRuns = (Nd4jIndex) starts.size();
+        starts.emplace_back(numRows);
+
+        if (numRuns >= 4 * omp_get_max_threads() || numRows * rowLength <= ELEMENT_THRESHOLD) {
+#pragma omp parallel for if (numRows * rowLength > ELEMENT_THRESHOLD) schedule(guided)
+            for (Nd4jIndex s = 0; s < numRuns; s++)
+                reduceRows<T, Op>(x + starts[s] * rowLength, starts[s + 1] - starts[s], rowLength, z + ids[starts[s]] * rowLength);
+        } else {
+            // few large segments: rows of each segment are split between threads
+            for (Nd4jIndex s = 0; s < numRuns; s++)
+                reduceRowsParallel<T, Op>(x + starts[s] * rowLength, starts[s + 1] - starts[s], rowLength, z + ids[starts[s]] * rowLength);
         }
-        else {
-            std::vector<int> restDims(input->rankOf() - 1);
-            for (int e = 1; e < input->rankOf(); e++)
-                restDims[e - 1] = e;
-            ResultSet<T>* listOfTensors = NDArrayFactory<T>::allTensorsAlongDimension(input, restDims);
-            ResultSet<T>* listOfOutTensors = NDArrayFactory<T>::allTensorsAlongDimension(output, restDims);
-
-            int numOfClasses = output->sizeAt(0); // number of classes
-            std::vector<std::pair<NDArray<T>*, int>> outputs(numOfClasses);
-            NDArray<T>* minT = listOfOutTensors->at(idx);
-
-            int pos = 0;
-            minT->assign(listOfTensors->at(0));
-            for (int i = 1; i < indices->lengthOf(); i++) {
-                if (static_cast<int>((*indices)(i)) == idx) {
-                    for (int e = 0; e < minT->lengthOf(); e++) {
-                       (*minT)(e) = nd4j::math::nd4j_min((*minT)(e), (*listOfTensors->at(i))(e));
+    }
+
+    template <typename T, typename Op>
+    static void unsortedSegments(const T *x, const std::vector<Nd4jIndex>& ids, T *z, const Nd4jIndex numSegments, const Nd4jIndex rowLength) {
+        const Nd4jIndex numRows = (Nd4jIndex) ids.size();
+        const Nd4jIndex cells = numSegments * rowLength;
+        const bool parallel = numRows * rowLength > ELEMENT_THRESHOLD;
+        const int maxThreads = parallel ? omp_get_max_threads() : 1;
+        std::vector<Nd4jIndex> counts(numSegments, 0);
+
+        if (maxThreads > 1 && cells * maxThreads <= 2 * numRows * rowLength) {
+            // per-thread partial outputs are small enough
+            std::vector<T> partials(maxThreads * cells);
+            std::vector<Nd4jIndex> partialCounts(maxThreads * numSegments, 0);
+
+#pragma omp parallel num_threads(maxThreads)
+            {
+                const int thread = omp_get_thread_num();
+                T *partial = partials.data() + thread * cells;
+                Nd4jIndex *partialCount = partialCounts.data() + thread * numSegments;
+
+#pragma omp for schedule(static)
+                for (Nd4jIndex r = 0; r < numRows; r++) {
+                    const Nd4jIndex s = ids[r];
+                    if (partialCount[s]++ == 0)
+                        memcpy(partial + s * rowLength, x + r * rowLength, rowLength * sizeof(T));
+                    else
+                        combineRow<T, Op>(partial + s * rowLength, x + r * rowLength, rowLength);
+                }
+
+#pragma omp for schedule(static)
+                for (Nd4jIndex s = 0; s < numSegments; s++) {
+                    T *zRow = z + s * rowLength;
+                    for (int t = 0; t < maxThreads; t++) {
+                        const Nd4jIndex count = partialCounts[t * numSegments + s];
+                        if (count == 0)
+                            continue;
+
+                        if (counts[s] == 0)
+                            memcpy(zRow, partials.data() + t * cells + s * rowLength, rowLength * sizeof(T));
+                        else
+                            combineRow<T, Op>(zRow, partials.data() + t * cells + s * rowLength, rowLength);
+
+                        counts[s] += count;
                     }
                 }
-                else {
-                    idx = static_cast<int>((*indices)(i));
-                    minT = listOfOutTensors->at(idx);
-                    minT->assign(listOfTensors->at(i));
+            }
+        } else {
+            // each thread owns range of segments, and picks rows that belong to them
+#pragma omp parallel if (parallel)
+            {
+                const Nd4jIndex span = (numSegments + omp_get_num_threads() - 1) / omp_get_num_threads();
+                const Nd4jIndex start = omp_get_thread_num() * span;
+                const Nd4jIndex end = nd4j::math::nd4j_min<Nd4jIndex>(numSegments, start + span);
+
+                for (Nd4jIndex r = 0; r < numRows; r++) {
+                    const Nd4jIndex s = ids[r];
+                    if (s < start || s >= end)
+                        continue;
+
+                    if (counts[s]++ == 0)
+                        memcpy(z + s * rowLength, x + r * rowLength, rowLength * sizeof(T));
+                    else
+                        combineRow<T, Op>(z + s * rowLength, x + r * rowLength, rowLength);
                 }
             }
-            delete listOfTensors;
-            delete listOfOutTensors;
+        }
+
+#pragma omp parallel for if (cells > ELEMENT_THRESHOLD) schedule(static)
+        for (Nd4jIndex s = 0; s < numSegments; s++) {
+            if (counts[s] == 0)
+                std::fill(z + s * rowLength, z + (s + 1) * rowLength, (T) 0.0f);
+            else
+                finishRow<T, Op>(z + s * rowLength, counts[s], rowLength);
         }
     }
 
-    // segmen mean
+    // runs given segment kernel over c-ordered buffers, other layouts go through copies
+    template <typename T, typename Op, bool sorted>
+    static void segmentReduce(NDArray<T>* input, const std::vector<Nd4jIndex>& ids, NDArray<T>* output) {
+        const Nd4jIndex numSegments = output->sizeAt(0);
+        const Nd4jIndex rowLength = ids.empty() ? 0 : input->lengthOf() / (Nd4jIndex) ids.size();
+
+        std::unique_ptr<NDArray<T>> x;
+        std::unique_ptr<NDArray<T>> z;
+
+        T *xBuffer = helpers::linearBuffer(*input, x);
+        T *zBuffer = helpers::linearBuffer(*output, z, false);
+
+        if (sorted)
+            sortedSegments<T, Op>(xBuffer, ids, zBuffer, numSegments, rowLength);
+        else
+            unsortedSegments<T, Op>(xBuffer, ids, zBuffer, numSegments, rowLength);
+
+        if (z)
+            output->assign(z.get());
+    }
+
+    template <typename T, typename Op>
+    static void sortedSegmentReduce(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* output) {
+        std::vector<Nd4jIndex> ids;
+        helpers::readIndices(*indices, ids, (Nd4jIndex) output->sizeAt(0));
+
+        segmentReduce<T, Op, true>(input, ids, output);
+    }
+
     template <typename T>
-    void segmentMeanFunctor(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* output) {
-        int numClasses = output->sizeAt(0);
-        // if input is a vector: (as if in doc sample)
-        int idx = static_cast<int>((*indices)(0));
-        if (input->isVector()) {
-            T val = T(0.f);
-            int count = 0;
-            for (int e = 0; e < indices->lengthOf(); e++) {
-                if (idx == static_cast<int>((*indices)(e))) {
-                   // mean 
-                   val += (*input)(e);
-                   count++;
-                }
-                else {
-                   (*output)(idx) = val / count;
-                    idx = static_cast<int>((*indices)(e));
-                    val = (*input)(e);
-                    count = 1;
-                }
-                (*output)(idx) = val / count;
-            }
-        }
-        else {
-            std::vector<int> restDims(input->rankOf() - 1);
-            for (int e = 1; e < input->rankOf(); e++)
-                restDims[e - 1] = e;
-            ResultSet<T>* listOfTensors = NDArrayFactory<T>::allTensorsAlongDimension(input, restDims);
-            ResultSet<T>* listOfOutTensors = NDArrayFactory<T>::allTensorsAlongDimension(output, restDims);
-
-            int numOfClasses = output->sizeAt(0); // number of classes
-            std::vector<std::pair<NDArray<T>*, int>> outputs(numOfClasses);
-            NDArray<T>* meanT = listOfOutTensors->at(idx);
-            T count = T(1.f);
-            NDArray<T>* meanV = meanT->dup();
-            meanV->assign(listOfTensors->at(0));
-            for (int i = 1; i < indices->lengthOf(); i++) {
-                if (static_cast<int>((*indices)(i)) == idx) {
-                    for (int e = 0; e < meanT->lengthOf(); e++) {
-                       (*meanV)(e) += (*listOfTensors->at(i))(e);
-                    }
-                    count += T(1.f);
-                }
-                else {
-                    //meanT->assign(meanV);
-                    meanV->template applyScalar<simdOps::Divide<T>>(count, meanT);
-                    idx = static_cast<int>((*indices)(i));
-                    meanT = listOfOutTensors->at(idx);
-                    meanV->assign(listOfTensors->at(i));
-                    count = T(1.f);
-                }
-                meanV->template applyScalar<simdOps::Divide<T>>(count, meanT);
+    bool segmentIndicesValidate(NDArray<T>* indices, T& expected, T& output) {
+        T previous = (T) 0.f;
+        for (Nd4jIndex e = 0; e < indices->lengthOf(); e++) {
+            T current = indices->getIndexedScalar(e);
+            if (current < previous) {
+                expected = previous;
+                output = current;
+                return false;
             }
-            delete meanV;
-            delete listOfTensors;
-            delete listOfOutTensors;
+
+            previous = current;
         }
+
+        return true;
+    }
+
+    template <typename T>
+    void segmentMaxFunctor(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* output) {
+        sortedSegmentReduce<T, SegmentMax<T>>(input, indices, output);
+    }
+
+    template <typename T>
+    void segmentMinFunctor(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* output) {
+        sortedSegmentReduce<T, SegmentMin<T>>(input, indices, output);
+    }
+
+    template <typename T>
+    void segmentMeanFunctor(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* output) {
+        sortedSegmentReduce<T, SegmentMean<T>>(input, indices, output);
     }
 
     template <typename T>
     void segmentSumFunctor(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* output) {
-        int numClasses = output->sizeAt(0);
-        // if input is a vector: (as if in doc sample)
-        int idx = static_cast<int>((*indices)(0));
-        if (input->isVector()) {
-            T val = T(0.f);
-            int count = 0;
-            for (int e = 0; e < indices->lengthOf(); e++) {
-                if (idx == static_cast<int>((*indices)(e))) {
-                   // sum 
-                   val += (*input)(e);
-                }
-                else {
-                    idx = static_cast<int>((*indices)(e));
-                    val = (*input)(e);
-                }
-                (*output)(idx) = val;
-            }
-        }
-        else {
-            std::vector<int> restDims(input->rankOf() - 1);
-            for (int e = 1; e < input->rankOf(); e++)
-                restDims[e - 1] = e;
-            ResultSet<T>* listOfTensors = NDArrayFactory<T>::allTensorsAlongDimension(input, restDims);
-            ResultSet<T>* listOfOutTensors = NDArrayFactory<T>::allTensorsAlongDimension(output, restDims);
-
-            int numOfClasses = output->sizeAt(0); // number of classes
-            std::vector<std::pair<NDArray<T>*, int>> outputs(numOfClasses);
-            NDArray<T>* sumT = listOfOutTensors->at(idx);
-
-            for (int i = 0; i < indices->lengthOf(); i++) {
-                if (static_cast<int>((*indices)(i)) == idx) {
-                    for (int e = 0; e < sumT->lengthOf(); e++) {
-                       (*sumT)(e) += (*listOfTensors->at(i))(e);
-                    }
-                }
-                else {
-                    idx = static_cast<int>((*indices)(i));
-                    sumT = listOfOutTensors->at(idx);
-                    sumT->assign(listOfTensors->at(i));
-                }
-            }
-            delete listOfTensors;
-            delete listOfOutTensors;
-        }
+        sortedSegmentReduce<T, SegmentSum<T>>(input, indices, output);
     }
 
     template <typename T>
     void segmentProdFunctor(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* output) {
-        int numClasses = output->sizeAt(0);
-        // if input is a vector: (as if in doc sample)
-        int idx = static_cast<int>((*indices)(0));
-        if (input->isVector()) {
-            T val = (*input)(0);
-            int count = 0;
-            for (int e = 1; e < indices->lengthOf(); e++) {
-                if (idx == static_cast<int>((*indices)(e))) {
-                   // sum 
-                   val *= (*input)(e);
-                }
-                else {
-                    idx = static_cast<int>((*indices)(e));
-                    val = (*input)(e);
-                }
-                (*output)(idx) = val;
-            }
-        }
-        else {
-            std::vector<int> restDims(input->rankOf() - 1);
-            for (int e = 1; e < input->rankOf(); e++)
-                restDims[e - 1] = e;
-            ResultSet<T>* listOfTensors = NDArrayFactory<T>::allTensorsAlongDimension(input, restDims);
-            ResultSet<T>* listOfOutTensors = NDArrayFactory<T>::allTensorsAlongDimension(output, restDims);
-
-            int numOfClasses = output->sizeAt(0); // number of classes
-            NDArray<T>* sumT = listOfOutTensors->at(idx);
-            sumT->assign(listOfTensors->at(0));
-            for (int i = 1; i < indices->lengthOf(); i++) {
-                if (static_cast<int>((*indices)(i)) == idx) {
-                    for (int e = 0; e < sumT->lengthOf(); e++) {
-                       (*sumT)(e) *= (*listOfTensors->at(i))(e);
-                    }
-                }
-                else {
-                    idx = static_cast<int>((*indices)(i));
-                    sumT = listOfOutTensors->at(idx);
-                    sumT->assign(listOfTensors->at(i));
-                }
-            }
-            delete listOfTensors;
-            delete listOfOutTensors;
-        }
+        sortedSegmentReduce<T, SegmentProd<T>>(input, indices, output);
+    }
+
+    template <typename T>
+    void unsortedSegmentMaxFunctor(NDArray<T>* input, const std::vector<Nd4jIndex>& indices, NDArray<T>* output) {
+        segmentReduce<T, SegmentMax<T>, false>(input, indices, output);
+    }
+
+    template <typename T>
+    void unsortedSegmentMinFunctor(NDArray<T>* input, const std::vector<Nd4jIndex>& indices, NDArray<T>* output) {
+        segmentReduce<T, SegmentMin<T>, false>(input, indices, output);
     }
 
+    template <typename T>
+    void unsortedSegmentMeanFunctor(NDArray<T>* input, const std::vector<Nd4jIndex>& indices, NDArray<T>* output) {
+        segmentReduce<T, SegmentMean<T>, false>(input, indices, output);
+    }
+
+    template <typename T>
+    void unsortedSegmentSumFunctor(NDArray<T>* input, const std::vector<Nd4jIndex>& indices, NDArray<T>* output) {
+        segmentReduce<T, SegmentSum<T>, false>(input, indices, output);
+    }
+
+    template <typename T>
+    void unsortedSegmentProdFunctor(NDArray<T>* input, const std::vector<Nd4jIndex>& indices, NDArray<T>* output) {
+        segmentReduce<T, SegmentProd<T>, false>(input, indices, output);
+    }
 
 
+    template bool segmentIndicesValidate<float>(NDArray<float>* indices, float& expected, float& output);
+    template bool segmentIndicesValidate<float16>(NDArray<float16>* indices, float16& expected, float16& output);
+    template bool segmentIndicesValidate<double>(NDArray<double>* indices, double& expected, double& output);
+
     template void segmentMaxFunctor<float>(NDArray<float>* input, NDArray<float>* indices, NDArray<float>* output);
     template void segmentMaxFunctor<float16>(NDArray<float16>* input, NDArray<float16>* , NDArray<float16>* output);
     template void segmentMaxFunctor<double>(NDArray<double>* input, NDArray<double>* , NDArray<double>* output);
@@ -287,6 +330,26 @@ namespace helpers {
     template void segmentProdFunctor<float16>(NDArray<float16>* input, NDArray<float16>* , NDArray<float16>* output);
     template void segmentProdFunctor<double>(NDArray<double>* input, NDArray<double>* , NDArray<double>* output);
 
+    template void unsortedSegmentMaxFunctor<float>(NDArray<float>* input, const std::vector<Nd4jIndex>& , NDArray<float>* output);
+    template void unsortedSegmentMaxFunctor<float16>(NDArray<float16>* input, const std::vector<Nd4jIndex>& , NDArray<float16>* output);
+    template void unsortedSegmentMaxFunctor<double>(NDArray<double>* input, const std::vector<Nd4jIndex>& , NDArray<double>* output);
+
+    template void unsortedSegmentMinFunctor<float>(NDArray<float>* input, const std::vector<Nd4jIndex>& , NDArray<float>* output);
+    template void unsortedSegmentMinFunctor<float16>(NDArray<float16>* input, const std::vector<Nd4jIndex>& , NDArray<float16>* output);
+    template void unsortedSegmentMinFunctor<double>(NDArray<double>* input, const std::vector<Nd4jIndex>& , NDArray<double>* output);
+
+    template void unsortedSegmentMeanFunctor<float>(NDArray<float>* input, const std::vector<Nd4jIndex>& , NDArray<float>* output);
+    template void unsortedSegmentMeanFunctor<float16>(NDArray<float16>* input, const std::vector<Nd4jIndex>& , NDArray<float16>* output);
+    template void unsortedSegmentMeanFunctor<double>(NDArray<double>* input, const std::vector<Nd4jIndex>& , NDArray<double>* output);
+
+    template void unsortedSegmentSumFunctor<float>(NDArray<float>* input, const std::vector<Nd4jIndex>& , NDArray<float>* output);
+    template void unsortedSegmentSumFunctor<float16>(NDArray<float16>* input, const std::vector<Nd4jIndex>& , NDArray<float16>* output);
+    template void unsortedSegmentSumFunctor<double>(NDArray<double>* input, const std::vector<Nd4jIndex>& , NDArray<double>* output);
+
+    template void unsortedSegmentProdFunctor<float>(NDArray<float>* input, const std::vector<Nd4jIndex>& , NDArray<float>* output);
+    template void unsortedSegmentProdFunctor<float16>(NDArray<float16>* input, const std::vector<Nd4jIndex>& , NDArray<float16>* output);
+    template void unsortedSegmentProdFunctor<double>(NDArray<double>* input, const std::vector<Nd4jIndex>& , NDArray<double>* output);
+
+}
 }
 }
-}
\ No newline at end of file
@@ -0,0 +1,275 @@
+//
+//  @author raver119@gmail.com
+//
+
+#include <ops/declarable/helpers/softmax.h>
+#include <ops/declarable/helpers/vectorsAlongDimension.h>
+#include <ops/gemm.h>
+#include <ops/ops.h>
+#include <templatemath.h>
+
+namespace nd4j {
+    namespace ops {
+        namespace helpers {
+            // running max and sum(exp(x - max)) of values seen so far, rescaled whenever max grows
+            template <typename Acc>
+            static FORCEINLINE void onlineUpdate(Acc &max, Acc &sum, const Acc value) {
+                if (value > max) {
+                    sum = sum * nd4j::math::nd4j_exp<Acc>(max - value) + (Acc) 1.0f;
+                    max = value;
+                } else
+                    sum += nd4j::math::nd4j_exp<Acc>(value - max);
+            }
+
+            template <typename Acc>
+            static FORCEINLINE void onlineMerge(Acc &max, Acc &sum, const Acc otherMax, const Acc otherSum) {
+                if (otherSum == (Acc) 0.0f)
+                    return;
+
+                if (otherMax > max) {
+                    sum = sum * nd4j::math::nd4j_exp<Acc>(max - otherMax) + otherSum;
+                    max = otherMax;
+                } else
+                    sum += otherSum * nd4j::math::nd4j_exp<Acc>(otherMax - max);
+            }
+
+            // single pass over vector: max and normalizer
+            template <typename T, typename Acc>
+            static void normalizer(const T *x, const Nd4jIndex length, const Nd4jIndex stride, const bool parallel, Acc &max, Acc &sum) {
+                max = (Acc) -FLOAT_MAX_VALUE;
+                sum = (Acc) 0.0f;
+
+                if (!parallel) {
+                    for (Nd4jIndex i = 0; i < length; i++)
+                        onlineUpdate<Acc>(max, sum, (Acc) x[i * stride]);
+
+                    return;
+                }
+
+#pragma omp parallel
+                {
+                    Acc localMax = (Acc) -FLOAT_MAX_VALUE;
+                    Acc localSum = (Acc) 0.0f;
+
+#pragma omp for nowait
+                    for (Nd4jIndex i = 0; i < length; i++)
+                        onlineUpdate<Acc>(localMax, localSum, (Acc) x[i * stride]);
+
+#pragma omp critical
+                    onlineMerge<Acc>(max, sum, localMax, localSum);
+                }
+            }
+
+            // vectors are processed in parallel, unless there's just one of them: then it's split between threads
+            static FORCEINLINE bool vectorsInParallel(const Nd4jIndex numVectors, const Nd4jIndex length) {
+                return numVectors > 1 && numVectors * length > ELEMENT_THRESHOLD;
+            }
+
+            static FORCEINLINE bool vectorInParallel(const Nd4jIndex numVectors, const Nd4jIndex length) {
+                return numVectors == 1 && length > ELEMENT_THRESHOLD;
+            }
+
+            // nested parallel region costs more than short vector itself, so it's opened only when needed
+            template <typename F>
+            static FORCEINLINE void forEach(const Nd4jIndex length, const bool parallel, F func) {
+                if (parallel) {
+#pragma omp parallel for simd
+                    for (Nd4jIndex i = 0; i < length; i++)
+                        func(i);
+                } else {
+#pragma omp simd
+                    for (Nd4jIndex i = 0; i < length; i++)
+                        func(i);
+                }
+            }
+
+            template <typename Acc, typename F>
+            static FORCEINLINE Acc sumOf(const Nd4jIndex length, const bool parallel, F func) {
+                Acc sum = (Acc) 0.0f;
+                if (parallel) {
+#pragma omp parallel for simd reduction(sumT:sum)
+                    for (Nd4jIndex i = 0; i < length; i++)
+                        sum += func(i);
+                } else {
+#pragma omp simd reduction(sumT:sum)
+                    for (Nd4jIndex i = 0; i < length; i++)
+                        sum += func(i);
+                }
+
+                return sum;
+            }
+
+            template <typename T>
+            void softmax(NDArray<T>& input, NDArray<T>& output, const int dimension) {
+                typedef typename nd4j::blas::GemmBlocking<T>::acc_type Acc;
+
+                VectorsAlongDimension<T> x(input, dimension);
+                VectorsAlongDimension<T> z(output, dimension);
+
+                const Nd4jIndex length = x.length;
+                const bool inner = vectorInParallel(x.numVectors, length);
+
+#pragma omp parallel for schedule(guided) if (vectorsInParallel(x.numVectors, length))
+                for (Nd4jIndex e = 0; e < x.numVectors; e++) {
+                    const T *xv = x.at(e);
+                    T *zv = z.at(e);
+
+                    Acc max, sum;
+                    normalizer<T, Acc>(xv, length, x.stride, inner, max, sum);
+
+                    const Acc factor = (Acc) 1.0f / sum;
+
+                    forEach(length, inner, [&](Nd4jIndex i) {
+                        zv[i * z.stride] = (T) (nd4j::math::nd4j_exp<Acc>((Acc) xv[i * x.stride] - max) * factor);
+                    });
+                }
+            }
+
+            template <typename T>
+            void logSoftmax(NDArray<T>& input, NDArray<T>& output, const int dimension) {
+                typedef typename nd4j::blas::GemmBlocking<T>::acc_type Acc;
+
+                VectorsAlongDimension<T> x(input, dimension);
+                VectorsAlongDimension<T> z(output, dimension);
+
+                const Nd4jIndex length = x.length;
+                const bool inner = vectorInParallel(x.numVectors, length);
+
+#pragma omp parallel for schedule(guided) if (vectorsInParallel(x.numVectors, length))
+                for (Nd4jIndex e = 0; e < x.numVectors; e++) {
+                    const T *xv = x.at(e);
+                    T *zv = z.at(e);
+
+                    Acc max, sum;
+                    normalizer<T, Acc>(xv, length, x.stride, inner, max, sum);
+
+                    const Acc shift = max + nd4j::math::nd4j_log<Acc>(sum);
+
+                    forEach(length, inner, [&](Nd4jIndex i) {
+                        zv[i * z.stride] = (T) ((Acc) xv[i * x.stride] - shift);
+                    });
+                }
+            }
+
+            template <typename T>
+            void softmaxBP(NDArray<T>& input, NDArray<T>& epsilon, NDArray<T>& output, const int dimension) {
+                typedef typename nd4j::blas::GemmBlocking<T>::acc_type Acc;
+
+                VectorsAlongDimension<T> x(input, dimension);
+                VectorsAlongDimension<T> g(epsilon, dimension);
+                VectorsAlongDimension<T> z(output, dimension);
+
+                const Nd4jIndex length = x.length;
+                const bool inner = vectorInParallel(x.numVectors, length);
+
+#pragma omp parallel for schedule(guided) if (vectorsInParallel(x.numVectors, length))
+                for (Nd4jIndex e = 0; e < x.numVectors; e++) {
+                    const T *xv = x.at(e);
+                    const T *gv = g.at(e);
+                    T *zv = z.at(e);
+
+                    Acc max, sum;
+                    normalizer<T, Acc>(xv, length, x.stride, inner, max, sum);
+
+                    const Acc factor = (Acc) 1.0f / sum;
+
+                    const Acc dot = sumOf<Acc>(length, inner, [&](Nd4jIndex i) {
+                        return nd4j::math::nd4j_exp<Acc>((Acc) xv[i * x.stride] - max) * factor * (Acc) gv[i * g.stride];
+                    });
+
+                    forEach(length, inner, [&](Nd4jIndex i) {
+                        zv[i * z.stride] = (T) (nd4j::math::nd4j_exp<Acc>((Acc) xv[i * x.stride] - max) * factor * ((Acc) gv[i * g.stride] - dot));
+                    });
+                }
+            }
+
+            template <typename T>
+            void logSoftmaxBP(NDArray<T>& input, NDArray<T>& epsilon, NDArray<T>& output, const int dimension) {
+                typedef typename nd4j::blas::GemmBlocking<T>::acc_type Acc;
+
+                VectorsAlongDimension<T> x(input, dimension);
+                VectorsAlongDimension<T> g(epsilon, dimension);
+                VectorsAlongDimension<T> z(output, dimension);
+
+                const Nd4jIndex length = x.length;
+                const bool inner = vectorInParallel(x.numVectors, length);
+
+#pragma omp parallel for schedule(guided) if (vectorsInParallel(x.numVectors, length))
+                for (Nd4jIndex e = 0; e < x.numVectors; e++) {
+                    const T *xv = x.at(e);
+                    const T *gv = g.at(e);
+                    T *zv = z.at(e);
+
+                    Acc max, sum;
+                    normalizer<T, Acc>(xv, length, x.stride, inner, max, sum);
+
+                    const Acc factor = (Acc) 1.0f / sum;
+
+                    // d(log softmax_j)/dx_i = delta_ij - softmax_i, so dL/dx_i = eps_i - softmax_i * sum_j(eps_j)
+                    const Acc epsSum = sumOf<Acc>(length, inner, [&](Nd4jIndex i) {
+                        return (Acc) gv[i * g.stride];
+                    });
+
+                    forEach(length, inner, [&](Nd4jIndex i) {
+                        zv[i * z.stride] = (T) ((Acc) gv[i * g.stride] - nd4j::math::nd4j_exp<Acc>((Acc) xv[i * x.stride] - max) * factor * epsSum);
+                    });
+                }
+            }
+
+            template <typename T>
+            void softmaxCrossEntropy(NDArray<T>& logits, NDArray<T>& labels, NDArray<T>& losses, const int dimension, const T labelsSmoothing, const T numClasses) {
+                typedef typename nd4j::blas::GemmBlocking<T>::acc_type Acc;
+
+                VectorsAlongDimension<T> x(logits, dimension);
+                VectorsAlongDimension<T> y(labels, dimension);
+
+                const Nd4jIndex length = x.length;
+                const bool inner = vectorInParallel(x.numVectors, length);
+
+                const Acc scale = (Acc) 1.0f - (Acc) labelsSmoothing;
+                const Acc shift = (Acc) labelsSmoothing / (Acc) numClasses;
+
+#pragma omp parallel for schedule(guided) if (vectorsInParallel(x.numVectors, length))
+                for (Nd4jIndex e = 0; e < x.numVectors; e++) {
+                    const T *xv = x.at(e);
+                    const T *yv = y.at(e);
+
+                    Acc max, sum;
+                    normalizer<T, Acc>(xv, length, x.stride, inner, max, sum);
+
+                    // -sum(labels * log(softmax)) = -(sum(labels * x) - (max + log(sum)) * sum(labels))
+                    const Acc labelsDot = sumOf<Acc>(length, inner, [&](Nd4jIndex i) {
+                        return ((Acc) yv[i * y.stride] * scale + shift) * (Acc) xv[i * x.stride];
+                    });
+
+                    const Acc labelsSum = sumOf<Acc>(length, inner, [&](Nd4jIndex i) {
+                        return (Acc) yv[i * y.stride] * scale + shift;
+                    });
+
+                    losses.putIndexedScalar(e, (T) ((max + nd4j::math::nd4j_log<Acc>(sum)) * labelsSum - labelsDot));
+                }
+            }
+
+
+            template void softmax<float>(NDArray<float>& input, NDArray<float>& output, const int dimension);
+            template void softmax<float16>(NDArray<float16>& input, NDArray<float16>& output, const int dimension);
+            template void softmax<double>(NDArray<double>& input, NDArray<double>& output, const int dimension);
+
+            template void logSoftmax<float>(NDArray<float>& input, NDArray<float>& output, const int dimension);
+            template void logSoftmax<float16>(NDArray<float16>& input, NDArray<float16>& output, const int dimension);
+            template void logSoftmax<double>(NDArray<double>& input, NDArray<double>& output, const int dimension);
+
+            template void softmaxBP<float>(NDArray<float>& input, NDArray<float>& epsilon, NDArray<float>& output, const int dimension);
+            template void softmaxBP<float16>(NDArray<float16>& input, NDArray<float16>& epsilon, NDArray<float16>& output, const int dimension);
+            template void softmaxBP<double>(NDArray<double>& input, NDArray<double>& epsilon, NDArray<double>& output, const int dimension);
+
+            template void logSoftmaxBP<float>(NDArray<float>& input, NDArray<float>& epsilon, NDArray<float>& output, const int dimension);
+            template void logSoftmaxBP<float16>(NDArray<float16>& input, NDArray<float16>& epsilon, NDArray<float16>& output, const int dimension);
+            template void logSoftmaxBP<double>(NDArray<double>& input, NDArray<double>& epsilon, NDArray<double>& output, const int dimension);
+
+            template void softmaxCrossEntropy<float>(NDArray<float>& logits, NDArray<float>& labels, NDArray<float>& losses, const int dimension, const float labelsSmoothing, const float numClasses);
+            template void softmaxCrossEntropy<float16>(NDArray<float16>& logits, NDArray<float16>& labels, NDArray<float16>& losses, const int dimension, const float16 labelsSmoothing, const float16 numClasses);
+            template void softmaxCrossEntropy<double>(NDArray<double>& logits, NDArray<double>& labels, NDArray<double>& losses, const int dimension, const double labelsSmoothing, const double numClasses);
+        }
+    }
+}
@@ -3,98 +3,169 @@
 //
 
 #include <ops/declarable/helpers/top_k.h>
-#include <NDArrayFactory.h>
+#include <ops/declarable/helpers/vectorsAlongDimension.h>
+#include <ops/ops.h>
+#include <templatemath.h>
+#include <algorithm>
+#include <omp.h>
 
 namespace nd4j {
 namespace ops {
 namespace helpers {
 
+    template <typename T>
+    struct Candidate {
+        T value;
+        Nd4jIndex index;
+    };
+
+    // larger value wins, equal values are ordered by index
+    template <typename T>
+    static FORCEINLINE bool better(const Candidate<T>& a, const Candidate<T>& b) {
+        return a.value > b.value || (a.value == b.value && a.index < b.index);
+    }
+
+    // heap keeps k best candidates, and the worst of them on top
+    template <typename T>
+    static FORCEINLINE void offer(std::vector<Candidate<T>>& heap, const Candidate<T>& candidate, const int k) {
+        if ((int) heap.size() < k) {
+            heap.emplace_back(candidate);
+            std::push_heap(heap.begin(), heap.end(), better<T>);
+        } else if (better(candidate, heap.front())) {
+            std::pop_heap(heap.begin(), heap.end(), better<T>);
+            heap.back() = candidate;
+            std::push_heap(heap.begin(), heap.end(), better<T>);
+        }
+    }
+
+    // offers elements [start, end) of strided vector to heap
+    template <typename T>
+    static void select(const T* x, const Nd4jIndex stride, const Nd4jIndex start, const Nd4jIndex end, const int k, std::vector<Candidate<T>>& heap) {
+        Nd4jIndex i = start;
+        for (; i < end && (int) heap.size() < k; i++)
+            offer<T>(heap, {x[i * stride], i}, k);
+
+        // indices only grow here, so element has to be strictly greater than current k-th value to get in.
+        // blocks without such elements are skipped after single vectorized max
+        const Nd4jIndex blockSize = 64;
+        for (; i < end; i += blockSize) {
+            const Nd4jIndex blockEnd = nd4j::math::nd4j_min<Nd4jIndex>(end, i + blockSize);
+            const T threshold = heap.front().value;
+
+            T blockMax = threshold;
+#pragma omp simd reduction(maxT:blockMax)
+            for (Nd4jIndex j = i; j < blockEnd; j++)
+                blockMax = nd4j::math::nd4j_max<T>(blockMax, x[j * stride]);
+
+            if (!(blockMax > threshold))
+                continue;
+
+            for (Nd4jIndex j = i; j < blockEnd; j++)
+                if (x[j * stride] > heap.front().value)
+                    offer<T>(heap, {x[j * stride], j}, k);
+        }
+    }
+
+    // single long vector: each thread selects from its own chunk, and their candidates are merged
+    template <typename T>
+    static void selectParallel(const T* x, const Nd4jIndex stride, const Nd4jIndex length, const int k, std::vector<Candidate<T>>& heap) {
+        std::vector<std::vector<Candidate<T>>> partial(omp_get_max_threads());
+
+#pragma omp parallel
+        {
+            const Nd4jIndex numThreads = omp_get_num_threads();
+            const Nd4jIndex span = (length + numThreads - 1) / numThreads;
+            const Nd4jIndex start = omp_get_thread_num() * span;
+            const Nd4jIndex end = nd4j::math::nd4j_min<Nd4jIndex>(length, start + span);
+
+            auto &local = partial[omp_get_thread_num()];
+            local.reserve(k);
+            if (start < end)
+                select<T>(x, stride, start, end, k, local);
+        }
+
+        for (auto &local: partial)
+            for (auto &candidate: local)
+                offer<T>(heap, candidate, k);
+    }
+
     template <typename T>
     int topKFunctor(NDArray<T>* input, NDArray<T>* values, NDArray<T>* indeces, int k, bool needSort) {
-            if (k == 1) {
-                // using arg_max for it
-                //nd4j::ops::argmax<T> op;
-                //auto res = op.execute({x}, {}, {x->sizeAt(-1)});
-
-                //REQUIRE_TRUE(res->status() == ND4J_STATUS_OK, 0, "Argmax for top_k failed");
-                int width = input->sizeAt(-1);
-                int pos = 0;
-                for (int e = 0; e < input->lengthOf(); e += width)
-                {
-                    T topVal = 0;
-                    int topIndex = 0;
-                    for (int j = 0; j < width; j++) {
-                        if (topVal < input->getScalar(j + e))
-                        {
-                            topVal = input->getScalar(j + e);
-                            topIndex = j;
-                        }
-                    }
-                    values->putScalar(pos, topVal);
-                    indeces->putScalar(pos++, topIndex);
-                }
-                //int index = indeces->getScalar(0);
-                //T val = x->getScalar(index);
-                
-                //values->putScalar(0, val);
+        if (k == 0 || input->lengthOf() == 0)
+            return ND4J_STATUS_OK;
 
-                //return ND4J_STATUS_OK;
-            }
-            else { // if (k > 1) {
-
-                int width = input->sizeAt(-1);
-                int nextPos = 0;
-                for (int e = 0; e < input->lengthOf(); e += width)
-                {
-                    std::vector<int> topIndeces(k);
-                    std::vector<T>   topValues(k);
-                    for (int pos = 0; pos < k; ++pos) {
-                        topIndeces[pos] = pos;
-                        topValues[pos] = input->getScalar(pos + e);
-                    }
-                    std::vector<T> sortedVals(topValues);
-                    std::sort(sortedVals.begin(), sortedVals.end()); // sorted in ascending order
-                    
-                    for (int j = k; j < width; j++) {
-                        if (sortedVals[0] < input->getScalar(j + e)) { // value can be inserted to top k
-                            T val = input->getScalar(j + e);
-                            if (sortedVals.end() == std::find(sortedVals.begin(), sortedVals.end(), val)) {    
-                                // exchangePos - a distance between begin and minimum to be suppressed by val
-                                auto exchangePos = std::distance(topValues.begin(), std::find(topValues.begin(), topValues.end(), sortedVals[0]));
-//                                if ((exchangePos < 0 || exchangePos >= k), 1, "top_k: invalid index")
-//                                    return ; 
-                                // set up sorted sequence for continue
-                                topValues[exchangePos] = val;
-                                sortedVals[0] = val;
-                                std::sort(sortedVals.begin(), sortedVals.end()); // sorted in ascending order
-                            }
-                        }
-                    }
-
-                    if (needSort) {
-                        std::sort(topValues.begin(), topValues.end(), [](int a, int b) {
-                            return a > b;   
-                        });
-                    }
-
-                    for (int j = 0; j < width; j++)
-                        for (int pos = 0; pos < k; ++pos)
-                            if (topValues[pos] == input->getScalar(j + e))
-                                topIndeces[pos] = j;
-
-                    for (int pos = 0; pos < k; ++pos)
-                    {
-                        values->putScalar(nextPos, topValues[pos]);
-                        indeces->putScalar(nextPos++, topIndeces[pos]);
-                    }
+        VectorsAlongDimension<T> x(*input, -1);
+        VectorsAlongDimension<T> v(*values, -1);
+        VectorsAlongDimension<T> i(*indeces, -1);
+
+        const Nd4jIndex numRows = x.numVectors;
+        const Nd4jIndex width = x.length;
+        const bool splitRow = numRows == 1 && width > ELEMENT_THRESHOLD;
+
+#pragma omp parallel if (numRows > 1 && numRows * width > ELEMENT_THRESHOLD)
+        {
+            std::vector<Candidate<T>> heap;
+            heap.reserve(k);
+
+#pragma omp for schedule(guided)
+            for (Nd4jIndex r = 0; r < numRows; r++) {
+                heap.clear();
+
+                if (splitRow)
+                    selectParallel<T>(x.at(r), x.stride, width, k, heap);
+                else
+                    select<T>(x.at(r), x.stride, 0, width, k, heap);
+
+                if (needSort)
+                    std::sort(heap.begin(), heap.end(), better<T>);
+                else
+                    std::sort(heap.begin(), heap.end(), [] (const Candidate<T>& a, const Candidate<T>& b) -> bool { return a.index < b.index; });
+
+                T *vRow = v.at(r);
+                T *iRow = i.at(r);
+                for (int e = 0; e < k; e++) {
+                    vRow[e * v.stride] = heap[e].value;
+                    iRow[e * i.stride] = (T) heap[e].index;
                 }
+            }
+        }
+
+        return ND4J_STATUS_OK;
+    }
+
+    template <typename T>
+    int inTopKFunctor(NDArray<T>* predictions, const std::vector<Nd4jIndex>& target, NDArray<T>* result, int k) {
+        VectorsAlongDimension<T> x(*predictions, -1);
+
+        const Nd4jIndex numRows = x.numVectors;
+        const Nd4jIndex width = x.length;
+        const Nd4jIndex stride = x.stride;
+
+#pragma omp parallel for schedule(guided) if (numRows > 1 && numRows * width > ELEMENT_THRESHOLD)
+        for (Nd4jIndex r = 0; r < numRows; r++) {
+            const T *row = x.at(r);
+            const T value = row[target[r] * stride];
+
+            Nd4jIndex greater = 0;
+#pragma omp simd reduction(+:greater)
+            for (Nd4jIndex j = 0; j < width; j++)
+                greater += row[j * stride] > value ? 1 : 0;
+
+            result->putIndexedScalar(r, greater < k ? (T) 1.0f : (T) 0.0f);
         }
+
         return ND4J_STATUS_OK;
     }
+
+
     template int topKFunctor<float>(NDArray<float>* input, NDArray<float>* values, NDArray<float>* indeces, int k, bool needSort);
     template int topKFunctor<float16>(NDArray<float16>* input, NDArray<float16>* values, NDArray<float16>* indeces, int k, bool needSort);
     template int topKFunctor<double>(NDArray<double>* input, NDArray<double>* values, NDArray<double>* indeces, int k, bool needSort);
 
+    template int inTopKFunctor<float>(NDArray<float>* predictions, const std::vector<Nd4jIndex>& target, NDArray<float>* result, int k);
+    template int inTopKFunctor<float16>(NDArray<float16>* predictions, const std::vector<Nd4jIndex>& target, NDArray<float16>* result, int k);
+    template int inTopKFunctor<double>(NDArray<double>* predictions, const std::vector<Nd4jIndex>& target, NDArray<double>* result, int k);
+
+}
 }
 }
-}
\ No newline at end of file
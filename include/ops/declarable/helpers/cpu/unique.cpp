@@ -3,7 +3,9 @@
 //
 
 #include <ops/declarable/helpers/unique.h>
-#include <NDArrayFactory.h>
+#include <ops/declarable/helpers/gather.h>
+#include <helpers/FlatHashSet.h>
+#include <memory>
 
 namespace nd4j {
 namespace ops {
@@ -11,18 +13,13 @@ namespace helpers {
 
     template <typename T>
     int uniqueCount(NDArray<T>* input) {
-        int count = 0;
+        std::unique_ptr<NDArray<T>> copy;
+        T *x = linearBuffer(*input, copy);
 
-        std::vector<T> values;
+        FlatHashSet<T> set;
+        set.insertAll(x, input->lengthOf());
 
-        for (int e = 0; e < input->lengthOf(); e++) {
-            T v = (*input)(e);
-            if (std::find(values.begin(), values.end(), v) == values.end()) {
-                values.push_back(v);
-                count++;
-            }
-        }
-        return count;
+        return (int) set.size();
     }
 
     template int uniqueCount(NDArray<float>* input);
@@ -32,32 +29,29 @@ namespace helpers {
 
     template <typename T>
     int uniqueFunctor(NDArray<T>* input, NDArray<T>* values, NDArray<T>* indices, NDArray<T>* counts) { 
-    
-        std::vector<T> valuesVector;
-        std::map<T, int> indicesMap;
-        std::map<T, int> countsMap;
-
-        for (int e = 0; e < input->lengthOf(); e++) {
-            T v = (*input)(e);
-            if (std::find(valuesVector.begin(), valuesVector.end(), v) == valuesVector.end()) {
-                valuesVector.push_back(v);
-                indicesMap[v] = e;
-                countsMap[v] = 1;
-            }
-            else {
-                countsMap[v]++;
-            }
-        }
+        std::unique_ptr<NDArray<T>> copy;
+        T *x = linearBuffer(*input, copy);
+        const Nd4jIndex length = input->lengthOf();
 
+        FlatHashSet<T> set;
+        std::vector<Nd4jIndex> countsVector;
+        std::vector<Nd4jIndex> firsts;
+        set.insertAll(x, length, counts != nullptr ? &countsVector : nullptr, &firsts);
 
-        for (int e = 0; e < values->lengthOf(); e++) {
-            values->putScalar(e, valuesVector[e]);
+        auto &valuesVector = set.keys();
+        for (Nd4jIndex e = 0; e < set.size(); e++) {
+            values->putIndexedScalar(e, valuesVector[e]);
             if (counts != nullptr) 
-                counts->putScalar(e, countsMap[valuesVector[e]]);
+                counts->putIndexedScalar(e, (T) countsVector[e]);
         }
 
-        for (int e = 0; e < indices->lengthOf(); e++) {
-            indices->putScalar(e, indicesMap[(*input)(e)]);
+        // each element gets position of the first occurrence of its value
+        std::vector<Nd4jIndex> ids(length);
+        set.indicesOf(x, length, ids.data());
+
+        for (Nd4jIndex e = 0; e < length; e++) {
+            // NaN never matches, so every NaN is its own first occurrence
+            indices->putIndexedScalar(e, (T) (ids[e] >= 0 ? firsts[ids[e]] : e));
         }
 
         return ND4J_STATUS_OK;
@@ -69,4 +63,4 @@ namespace helpers {
 
 }
 }
-}
\ No newline at end of file
+}
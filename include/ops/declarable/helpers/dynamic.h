@@ -0,0 +1,30 @@
+//
+//  @author @shugeo
+//
+
+#ifndef LIBND4J_HELPERS_DYNAMIC_H
+#define LIBND4J_HELPERS_DYNAMIC_H
+
+#include <ops/declarable/helpers/helpers.h>
+#include <NDArray.h>
+#include <vector>
+
+namespace nd4j {
+    namespace ops {
+        namespace helpers {
+            /**
+             * This method returns number of entries of each partition
+             */
+            std::vector<Nd4jIndex> partitionSizes(const std::vector<Nd4jIndex>& partitions, const int numPartitions);
+
+            /**
+             * This method copies rows of input, seen as [partitions.size() x rowLength] matrix, into outputs picked by partitions.
+             * Rows are bucketed in one pass, and each output is then filled with single gather
+             */
+            template <typename T>
+            void dynamicPartitionFunctor(NDArray<T>* input, const std::vector<Nd4jIndex>& partitions, std::vector<NDArray<T>*>& outputs);
+        }
+    }
+}
+
+#endif //LIBND4J_HELPERS_DYNAMIC_H
@@ -0,0 +1,50 @@
+//
+//  @author raver119@gmail.com
+//
+
+#ifndef LIBND4J_HELPERS_GATHER_H
+#define LIBND4J_HELPERS_GATHER_H
+
+#include <ops/declarable/helpers/helpers.h>
+#include <NDArray.h>
+#include <memory>
+#include <vector>
+
+namespace nd4j {
+    namespace ops {
+        namespace helpers {
+            /**
+             * This method reads indices array into vector, in logical order
+             *
+             * @return FALSE if any of indices is outside of [0, limit) range
+             */
+            template <typename T>
+            bool readIndices(NDArray<T>& indices, std::vector<Nd4jIndex>& result, const Nd4jIndex limit);
+
+            /**
+             * This method returns c-ordered contiguous buffer of given array. Arrays of other layouts go through c-ordered copy, owned by copy argument
+             *
+             * @param readContents FALSE means buffer is only written, and caller assigns copy back to array, so contents aren't copied
+             */
+            template <typename T>
+            T* linearBuffer(NDArray<T>& array, std::unique_ptr<NDArray<T>>& copy, const bool readContents = true);
+
+            /**
+             * This method copies slices of input along given axis, picked by indices, into output:
+             * output[outer, i, inner] = input[outer, indices[i], inner]
+             *
+             * Work is split between threads across picked slices, contiguous slices are copied with memcpy
+             */
+            template <typename T>
+            void gather(NDArray<T>& input, const std::vector<Nd4jIndex>& indices, NDArray<T>& output, const int axis);
+
+            /**
+             * This method copies rows of input, seen as c-ordered [rows x rowLength] matrix, into consecutive rows of output
+             */
+            template <typename T>
+            void gatherRows(NDArray<T>& input, const std::vector<Nd4jIndex>& rows, NDArray<T>& output, const Nd4jIndex rowLength);
+        }
+    }
+}
+
+#endif //LIBND4J_HELPERS_GATHER_H
@@ -0,0 +1,32 @@
+//
+//  @author raver119@gmail.com
+//
+
+#ifndef LIBND4J_HELPERS_LISTDIFF_H
+#define LIBND4J_HELPERS_LISTDIFF_H
+
+#include <ops/declarable/helpers/helpers.h>
+#include <NDArray.h>
+
+namespace nd4j {
+    namespace ops {
+        namespace helpers {
+            /**
+             * This method returns number of values, which are absent in keep
+             */
+            template <typename T>
+            Nd4jIndex listDiffCount(NDArray<T>* values, NDArray<T>* keep);
+
+            /**
+             * This method stores values absent in keep into output1, and their positions into output2, preserving order.
+             * Membership is checked against hash set built over keep, so it's O(values + keep)
+             *
+             * @return number of values absent in keep. Outputs are left untouched if their lengths don't match it
+             */
+            template <typename T>
+            Nd4jIndex listDiffFunctor(NDArray<T>* values, NDArray<T>* keep, NDArray<T>* output1, NDArray<T>* output2);
+        }
+    }
+}
+
+#endif //LIBND4J_HELPERS_LISTDIFF_H
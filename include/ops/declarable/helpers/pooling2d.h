@@ -0,0 +1,37 @@
+//
+//  @author raver119@gmail.com
+//
+
+#ifndef LIBND4J_POOLING2D_H
+#define LIBND4J_POOLING2D_H
+
+#include <ops/declarable/helpers/helpers.h>
+#include <NDArray.h>
+
+namespace nd4j {
+    namespace ops {
+        namespace helpers {
+            /**
+             * This method does 2D pooling for NCHW or NHWC input, without permuting it
+             *
+             * @param poolingMode 0 - max, 1 - avg, 2 - pnorm
+             * @param extraParam0 avg: 0 - padding is excluded from divisor, 1 - included; pnorm: p
+             * @param indices optional, for max pooling only: index of max element within its image, i.e. c*iH*iW + y*iW + x for NCHW
+             */
+            template <typename T>
+            void pooling2d(NDArray<T>& input, NDArray<T>& output, const int kH, const int kW, const int sH, const int sW, const int pH, const int pW, const int dH, const int dW, const int poolingMode, const T extraParam0, const bool isNCHW, NDArray<T>* indices = nullptr);
+
+            /**
+             * This method calculates gradient of 2D pooling. Gradient goes straight to max element (max), spreads over window (avg),
+             * or is scaled by d(pnorm)/dx (pnorm), without materializing columns
+             *
+             * @param extraParam0 avg: 0 - padding is excluded from divisor, 1 - included; pnorm: p
+             * @param eps pnorm only: lower bound for denominator
+             */
+            template <typename T>
+            void pooling2dBP(NDArray<T>& input, NDArray<T>& gradO, NDArray<T>& gradI, const int kH, const int kW, const int sH, const int sW, const int pH, const int pW, const int dH, const int dW, const int poolingMode, const T extraParam0, const T eps, const bool isNCHW);
+        }
+    }
+}
+
+#endif //LIBND4J_POOLING2D_H
@@ -0,0 +1,58 @@
+//
+// @author raver119@gmail.com
+//
+
+#ifndef LIBND4J_RNNSEQUENCE_H
+#define LIBND4J_RNNSEQUENCE_H
+
+#include <ops/declarable/helpers/helpers.h>
+
+namespace nd4j {
+namespace ops {
+namespace helpers {
+
+    /**
+     * These functions run recurrent layers over the whole sequence at once.
+     *
+     * Input-to-hidden product is calculated for all time steps with one GEMM before the time loop, so each time step only
+     * does recurrent GEMM, accumulated into the same preallocated gates buffer, followed by single pass over that buffer
+     * which applies biases, gate activations, cell update and clipping. Nothing is allocated within time loop.
+     *
+     * For float16 GEMMs and element-wise math are done in fp32, only storage is fp16.
+     */
+
+    /**
+     * inArrs: x [time x bS x inSize], h0 [bS x numProj], c0 [bS x numUnits], Wx [inSize x 4*numUnits], Wh [numProj x 4*numUnits],
+     *         Wc [3*numUnits], Wp [numUnits x numProj], b [4*numUnits]
+     * outArrs: h [time x bS x numProj], c [time x bS x numUnits]
+     * params: peephole, projection, clippingCellValue, clippingProjValue, forgetBias
+     */
+    template <typename T>
+    void lstmTimeLoop(const std::vector<NDArray<T>*>& inArrs, const std::vector<NDArray<T>*>& outArrs, const std::vector<T>& params, nd4j::memory::Workspace* workspace = nullptr);
+
+    /**
+     * inArrs: x [time x bS x inSize], h0 [bS x numUnits], Wx [inSize x 3*numUnits], Wh [numUnits x 3*numUnits], b [3*numUnits]
+     * h: [time x bS x numUnits]
+     */
+    template <typename T>
+    void gruTimeLoop(const std::vector<NDArray<T>*>& inArrs, NDArray<T>* h, nd4j::memory::Workspace* workspace = nullptr);
+
+    /**
+     * inArrs: x [time x bS x inSize], Wx [inSize x numUnits], Wh [numUnits x numUnits], b [2*numUnits], h0 [bS x numUnits] or nullptr, maxTimeStep [bS] or nullptr
+     * h: [time x bS x numUnits], hFinal: [bS x numUnits]
+     */
+    template <typename T>
+    void rnnTimeLoop(const std::vector<NDArray<T>*>& inArrs, NDArray<T>* h, NDArray<T>* hFinal, nd4j::memory::Workspace* workspace = nullptr);
+
+    /**
+     * inArrs: x [bS x K x N], wi = W * x [bS x 3K x N], b [1 x 2K], c0 [bS x K], mask [bS x K] or nullptr
+     * h, c: [bS x K x N]
+     */
+    template <typename T>
+    void sruTimeLoop(const std::vector<NDArray<T>*>& inArrs, NDArray<T>* h, NDArray<T>* c);
+
+}
+}
+}
+
+#endif //LIBND4J_RNNSEQUENCE_H
@@ -6,11 +6,23 @@
 #define __SEGMENT_HELPERS__
 #include <op_boilerplate.h>
 #include <NDArray.h>
+#include <vector>
 
 namespace nd4j {
 namespace ops {
 namespace helpers {
 
+    /**
+     * This method checks that indices are non-negative and sorted. On failure, expected and output get offending pair of values
+     */
+    template <typename T>
+    bool segmentIndicesValidate(NDArray<T>* indices, T& expected, T& output);
+
+    /**
+     * Sorted segment functors: input is seen as [indices length x rest] matrix, rows with equal indices are reduced into output rows.
+     * Segment boundaries are found with single scan, then segments are reduced in parallel, or rows of few large segments are
+     * split between threads. Segments without rows are filled with zeros
+     */
     template <typename T>
     void segmentMaxFunctor(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* output);
 
@@ -26,6 +38,26 @@ namespace helpers {
     template <typename T>
     void segmentProdFunctor(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* output);
 
+    /**
+     * Unsorted segment functors: indices are read and validated by caller, may come in any order, and should be within [0, output->sizeAt(0)) range.
+     * Threads accumulate rows into their own partial outputs, which are combined at the end. When partial outputs would be
+     * too large, each thread owns range of segments instead
+     */
+    template <typename T>
+    void unsortedSegmentMaxFunctor(NDArray<T>* input, const std::vector<Nd4jIndex>& indices, NDArray<T>* output);
+
+    template <typename T>
+    void unsortedSegmentMinFunctor(NDArray<T>* input, const std::vector<Nd4jIndex>& indices, NDArray<T>* output);
+
+    template <typename T>
+    void unsortedSegmentMeanFunctor(NDArray<T>* input, const std::vector<Nd4jIndex>& indices, NDArray<T>* output);
+
+    template <typename T>
+    void unsortedSegmentSumFunctor(NDArray<T>* input, const std::vector<Nd4jIndex>& indices, NDArray<T>* output);
+
+    template <typename T>
+    void unsortedSegmentProdFunctor(NDArray<T>* input, const std::vector<Nd4jIndex>& indices, NDArray<T>* output);
+
 }
 }
 }
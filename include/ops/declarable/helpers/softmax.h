@@ -0,0 +1,51 @@
+//
+//  @author raver119@gmail.com
+//
+
+#ifndef LIBND4J_HELPERS_SOFTMAX_H
+#define LIBND4J_HELPERS_SOFTMAX_H
+
+#include <ops/declarable/helpers/helpers.h>
+#include <NDArray.h>
+
+namespace nd4j {
+    namespace ops {
+        namespace helpers {
+            /**
+             * This method calculates softmax along given dimension. Max and normalizer are found in single pass over input,
+             * and output is written once, so there are no temporary arrays and no overflow for large logits
+             */
+            template <typename T>
+            void softmax(NDArray<T>& input, NDArray<T>& output, const int dimension);
+
+            /**
+             * This method calculates log(softmax) along given dimension, as x - max - log(sum(exp(x - max)))
+             */
+            template <typename T>
+            void logSoftmax(NDArray<T>& input, NDArray<T>& output, const int dimension);
+
+            /**
+             * This method calculates softmax gradient: softmax * (epsilon - sum(softmax * epsilon))
+             */
+            template <typename T>
+            void softmaxBP(NDArray<T>& input, NDArray<T>& epsilon, NDArray<T>& output, const int dimension);
+
+            /**
+             * This method calculates log_softmax gradient: epsilon - sum(softmax * epsilon)
+             */
+            template <typename T>
+            void logSoftmaxBP(NDArray<T>& input, NDArray<T>& epsilon, NDArray<T>& output, const int dimension);
+
+            /**
+             * This method calculates cross entropy between softmax(logits) and labels along given dimension,
+             * without materializing softmax. Labels are smoothed on the fly: labels * (1 - labelsSmoothing) + labelsSmoothing / numClasses
+             *
+             * @param losses array with one element per vector along dimension
+             */
+            template <typename T>
+            void softmaxCrossEntropy(NDArray<T>& logits, NDArray<T>& labels, NDArray<T>& losses, const int dimension, const T labelsSmoothing, const T numClasses);
+        }
+    }
+}
+
+#endif //LIBND4J_HELPERS_SOFTMAX_H
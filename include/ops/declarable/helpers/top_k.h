@@ -5,14 +5,26 @@
 #define __TOP_K_HELPERS__
 #include <op_boilerplate.h>
 #include <NDArray.h>
+#include <vector>
 
 namespace nd4j {
 namespace ops {
 namespace helpers {
 
+    /**
+     * Finds k largest elements of each vector along last dimension, with min-heap of k candidates per vector.
+     * Equal values are ordered by index. With needSort values go in descending order, otherwise in order of their indices
+     */
     template <typename T>
     int topKFunctor(NDArray<T>* input, NDArray<T>* values, NDArray<T>* indeces, int k, bool needSort);
 
+    /**
+     * Target is in top k if less than k predictions in its row are strictly greater than prediction for target,
+     * so ties on k-th place are counted as hits
+     */
+    template <typename T>
+    int inTopKFunctor(NDArray<T>* predictions, const std::vector<Nd4jIndex>& target, NDArray<T>* result, int k);
+
 }
 }
 }
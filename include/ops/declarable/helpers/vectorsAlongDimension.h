@@ -0,0 +1,55 @@
+//
+//  @author raver119@gmail.com
+//
+
+#ifndef LIBND4J_HELPERS_VECTORS_ALONG_DIMENSION_H
+#define LIBND4J_HELPERS_VECTORS_ALONG_DIMENSION_H
+
+#include <helpers/TadCache.h>
+#include <NDArray.h>
+#include <memory>
+
+namespace nd4j {
+    namespace ops {
+        namespace helpers {
+            /**
+             * Vectors along one dimension of array: offset of first element of each vector, and stride between elements
+             */
+            template <typename T>
+            class VectorsAlongDimension {
+            protected:
+                std::shared_ptr<TadPack> _pack;
+                Nd4jIndex _zero = 0L;
+                Nd4jIndex* _offsets;
+                T* _buffer;
+
+            public:
+                Nd4jIndex numVectors;
+                Nd4jIndex length;
+                Nd4jIndex stride;
+
+                VectorsAlongDimension(NDArray<T>& array, int dimension) {
+                    if (dimension < 0)
+                        dimension += array.rankOf();
+
+                    _buffer = array.getBuffer();
+                    length = array.sizeAt(dimension);
+                    stride = array.stridesOf()[dimension];
+                    numVectors = length > 0 ? array.lengthOf() / length : 0;
+
+                    if (numVectors > 1) {
+                        _pack = TadCache::getInstance()->tadForDimensions(array.getShapeInfo(), dimension);
+                        _offsets = _pack->primaryOffsets();
+                    } else
+                        _offsets = &_zero;
+                }
+
+                FORCEINLINE T* at(const Nd4jIndex e) {
+                    return _buffer + _offsets[e];
+                }
+            };
+        }
+    }
+}
+
+#endif //LIBND4J_HELPERS_VECTORS_ALONG_DIMENSION_H
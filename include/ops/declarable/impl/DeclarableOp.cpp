@@ -168,6 +168,30 @@ namespace nd4j {
                     arrayStart = std::chrono::system_clock::now();
                 }
 
+                // unit dimensions don't change layout, so i.e. {1, 5} array is fine for {5} output
+                auto sameLayout = [] (int *shapeA, int *shapeB) -> bool {
+                    int *dimsA = shape::shapeOf(shapeA);
+                    int *dimsB = shape::shapeOf(shapeB);
+                    int rankA = shape::rank(shapeA);
+                    int rankB = shape::rank(shapeB);
+
+                    int a = 0;
+                    int b = 0;
+                    while (true) {
+                        while (a < rankA && dimsA[a] == 1)
+                            a++;
+
+                        while (b < rankB && dimsB[b] == 1)
+                            b++;
+
+                        if (a == rankA || b == rankB)
+                            return a == rankA && b == rankB;
+
+                        if (dimsA[a++] != dimsB[b++])
+                            return false;
+                    }
+                };
+
                 int cnt = 0;
                 for (auto out: *outSha->asVector()) {
                     // we need to check, if Z is really needed
@@ -178,7 +202,14 @@ namespace nd4j {
 
                         ctx.pushNDArrayToVariableSpace(pair, outArr);
                     } else {
-                        // TODO: validate/compare shapes here. existent vs provided in outSha
+                        // preallocated array of other shape, i.e. planned for other inputs, is replaced.
+                        // length alone isn't enough: reshape-like ops may produce same length with different shape
+                        auto var = ctx.getVariableSpace()->getVariable(pair);
+                        if (var->variableType() == VariableType::NDARRAY && !sameLayout(var->getNDArray()->getShapeInfo(), out)) {
+                            auto outArr = new NDArray<T>(out, true, workspace);
+
+                            ctx.pushNDArrayToVariableSpace(pair, outArr);
+                        }
                     }
                 }
 
@@ -15,13 +15,77 @@ namespace nd4j {
 
 
 
+        /**
+         * Blocking parameters of the packed GEMM engine.
+         *
+         * MR x NR is the register tile computed by micro-kernel,
+         * MC x KC panel of A is expected to stay in L2 cache,
+         * KC x NC panel of B is expected to stay in L3 cache.
+         * Panels are packed and accumulated in acc_type, so storage type can be narrower than compute type.
+         */
+        template <typename T>
+        struct GemmBlocking {
+            typedef T acc_type;
+
+            static const int MR = 4;
+            static const int NR = 16;
+            static const int MC = 128;
+            static const int KC = 256;
+            static const int NC = 4096;
+        };
+
+        template <>
+        struct GemmBlocking<double> {
+            typedef double acc_type;
+
+            static const int MR = 4;
+            static const int NR = 8;
+            static const int MC = 96;
+            static const int KC = 256;
+            static const int NC = 2048;
+        };
+
+        /**
+         * float16 is converted to fp32 tile by tile during packing, and accumulated in fp32
+         */
+        template <>
+        struct GemmBlocking<float16> {
+            typedef float acc_type;
+
+            static const int MR = 4;
+            static const int NR = 16;
+            static const int MC = 128;
+            static const int KC = 256;
+            static const int NC = 4096;
+        };
+
+
         template <typename T>
         class GEMM {
         protected:
+            typedef typename GemmBlocking<T>::acc_type Acc;
+
             static inline int linearIndexC(int rows, int cols, int r, int c);
             static inline int linearIndexF(int rows, int cols, int r, int c);
             static T* transpose(int orderSource, int orderTarget, int rows, int cols, T *source);
 
+            /**
+             * These methods pack mc x kc block of op(A) into MR-row panels, and kc x nc block of op(B) into NR-column panels.
+             * Tails are padded with zeros, so micro-kernel never has to check bounds within K loop
+             */
+            static void packA(bool transA, int mc, int kc, T *A, int lda, Acc *packed);
+            static void packB(bool transB, int kc, int nc, T *B, int ldb, Acc *packed, bool parallel);
+
+            /**
+             * This method computes MR x NR tile: C = alpha * packedA * packedB + beta * C, only mr x nr part of tile is stored
+             */
+            static void kernel(int kc, Acc *packedA, Acc *packedB, int mr, int nr, Acc alpha, Acc beta, T *C, int ldc);
+
+            /**
+             * This method applies beta to M x N column-major C
+             */
+            static void scaleC(int M, int N, T beta, T *C, int ldc);
+
 
         public:
             static void op(int Order, int TransA, int TransB, int M, int N, int K, T alpha, T *A, int lda, T *B, int ldb, T beta, T *C, int ldc);
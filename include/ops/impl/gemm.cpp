@@ -5,6 +5,7 @@
 
 #include <gemm.h>
 #include <op_boilerplate.h>
+#include <omp.h>
 
 namespace nd4j {
     namespace blas {
@@ -37,6 +38,122 @@ namespace nd4j {
             return ret;
         }
 
+        template <typename T>
+        void GEMM<T>::scaleC(int M, int N, T beta, T *C, int ldc) {
+            if (beta == (T) 1.0f)
+                return;
+
+            // beta == 0 means C is write-only, so we don't want NaNs from C to propagate
+            bool zero = beta == (T) 0.0f;
+
+#pragma omp parallel for if((Nd4jIndex) M * N > 8192) proc_bind(close)
+            for (int c = 0; c < N; c++) {
+                T *col = C + (Nd4jIndex) c * ldc;
+                if (zero) {
+#pragma omp simd
+                    for (int r = 0; r < M; r++)
+                        col[r] = (T) 0.0f;
+                } else {
+#pragma omp simd
+                    for (int r = 0; r < M; r++)
+                        col[r] *= beta;
+                }
+            }
+        }
+
+        template <typename T>
+        void GEMM<T>::packA(bool transA, int mc, int kc, T *A, int lda, Acc *packed) {
+            const int MR = GemmBlocking<T>::MR;
+
+            for (int ir = 0; ir < mc; ir += MR) {
+                int mr = nd4j::math::nd4j_min<int>(MR, mc - ir);
+                Acc *panel = packed + (Nd4jIndex) ir * kc;
+
+                for (int k = 0; k < kc; k++) {
+                    Acc *dst = panel + k * MR;
+                    int i = 0;
+                    if (transA) {
+                        for (; i < mr; i++)
+                            dst[i] = (Acc) A[k + (Nd4jIndex) (ir + i) * lda];
+                    } else {
+                        T *src = A + (ir + (Nd4jIndex) k * lda);
+                        for (; i < mr; i++)
+                            dst[i] = (Acc) src[i];
+                    }
+
+                    for (; i < MR; i++)
+                        dst[i] = (Acc) 0.0f;
+                }
+            }
+        }
+
+        template <typename T>
+        void GEMM<T>::packB(bool transB, int kc, int nc, T *B, int ldb, Acc *packed, bool parallel) {
+            const int NR = GemmBlocking<T>::NR;
+            int numPanels = (nc + NR - 1) / NR;
+
+#pragma omp parallel for if(parallel && numPanels > 1) proc_bind(close)
+            for (int p = 0; p < numPanels; p++) {
+                int jr = p * NR;
+                int nr = nd4j::math::nd4j_min<int>(NR, nc - jr);
+                Acc *panel = packed + (Nd4jIndex) jr * kc;
+
+                for (int k = 0; k < kc; k++) {
+                    Acc *dst = panel + k * NR;
+                    int j = 0;
+                    if (transB) {
+                        T *src = B + (jr + (Nd4jIndex) k * ldb);
+                        for (; j < nr; j++)
+                            dst[j] = (Acc) src[j];
+                    } else {
+                        for (; j < nr; j++)
+                            dst[j] = (Acc) B[k + (Nd4jIndex) (jr + j) * ldb];
+                    }
+
+                    for (; j < NR; j++)
+                        dst[j] = (Acc) 0.0f;
+                }
+            }
+        }
+
+        template <typename T>
+        void GEMM<T>::kernel(int kc, Acc *packedA, Acc *packedB, int mr, int nr, Acc alpha, Acc beta, T *C, int ldc) {
+            const int MR = GemmBlocking<T>::MR;
+            const int NR = GemmBlocking<T>::NR;
+
+            // register tile, fixed-size loops below are unrolled & vectorized by compiler for the target arch
+            Acc acc[MR * NR];
+
+#pragma omp simd
+            for (int e = 0; e < MR * NR; e++)
+                acc[e] = (Acc) 0.0f;
+
+            for (int k = 0; k < kc; k++) {
+                Acc *a = packedA + k * MR;
+                Acc *b = packedB + k * NR;
+
+                for (int i = 0; i < MR; i++) {
+                    Acc av = a[i];
+
+#pragma omp simd
+                    for (int j = 0; j < NR; j++)
+                        acc[i * NR + j] += av * b[j];
+                }
+            }
+
+            // C is touched only once per tile, and rounded to storage type only once
+            for (int j = 0; j < nr; j++) {
+                T *col = C + (Nd4jIndex) j * ldc;
+                if (beta == (Acc) 0.0f) {
+                    for (int i = 0; i < mr; i++)
+                        col[i] = (T) (alpha * acc[i * NR + j]);
+                } else {
+                    for (int i = 0; i < mr; i++)
+                        col[i] = (T) (alpha * acc[i * NR + j] + beta * (Acc) col[i]);
+                }
+            }
+        }
+
         template <typename T>
         void GEMM<T>::op(int Order, int TransA, int TransB,
                        int M, int N, int K,
@@ -46,51 +163,93 @@ namespace nd4j {
                        T beta,
                        T *C, int ldc) {
 
+            // row-major C = op(A) * op(B) is the same thing as column-major C^T = op(B)^T * op(A)^T
+            if (Order == CblasRowMajor) {
+                op(CblasColMajor, TransB, TransA, N, M, K, alpha, B, ldb, A, lda, beta, C, ldc);
+                return;
+            }
+
+            if (M <= 0 || N <= 0)
+                return;
+
+            if (K <= 0 || alpha == (T) 0.0f) {
+                scaleC(M, N, beta, C, ldc);
+                return;
+            }
+
+            const int MR = GemmBlocking<T>::MR;
+            const int NR = GemmBlocking<T>::NR;
+            const int MC = GemmBlocking<T>::MC;
+            const int KC = GemmBlocking<T>::KC;
+            const int NC = GemmBlocking<T>::NC;
+
             bool transAFlag = TransA == CblasTrans;
             bool transBFlag = TransB == CblasTrans;
 
-            if (beta == (T) 0.0f) {
-                int length = M*N;
-                if (length <= 8192) {
-#pragma omp simd
-                    for (int r = 0; r < length; r++)
-                        C[r] = (T) 0.0f;
-                } else {
-#pragma omp parallel for simd
-                    for (int r = 0; r < length; r++)
-                        C[r] = (T) 0.0f;
-                }
-            }
+            Acc accAlpha = (Acc) alpha;
 
+            // tiny problems aren't worth waking up threads
+            bool parallel = (Nd4jIndex) M * N * K > 32768 && !omp_in_parallel();
+            int numThreads = parallel ? omp_get_max_threads() : 1;
 
-#pragma omp parallel for simd collapse(2) proc_bind(close)
-            for (int r = 0; r < M; r++) {
-                for (int c = 0; c < N; c++) {
-                    int zIdx = linearIndexF(M, N, r, c);
+            // shared packed B panel, and private packed A panel for each thread
+            Acc *packedB = new Acc[(Nd4jIndex) KC * (nd4j::math::nd4j_min<int>(NC, N) + NR)];
+            Acc *packedA = new Acc[(Nd4jIndex) numThreads * MC * KC];
 
-                    T dot = (T) 0.0f;
+            int mTiles = (M + MC - 1) / MC;
 
-                    if (alpha != (T) 0.0f) {
-                        int bIdx; // = linearIndexF(K, N, 0, c);
-                        int aIdx;
+            for (int jc = 0; jc < N; jc += NC) {
+                int nc = nd4j::math::nd4j_min<int>(NC, N - jc);
+                int nPanels = (nc + NR - 1) / NR;
 
-                        for (int k = 0; k < K; k++) {
-                            aIdx = (transAFlag ? linearIndexC(M, K, r, k) : linearIndexF(M, K, r, k));
-                            bIdx = (transBFlag ? linearIndexC(K, N, k, c) : linearIndexF(K,N, k, c));
-                            dot += alpha * A[aIdx] * B[bIdx];//A[aIdx]nd4j::math::nd4j_dot<T>(aX, bX, K) * alpha;
-                        }
-                    }
+                // for skinny M there's not enough M tiles to feed all threads, so we also split N panels into chunks
+                int nChunks = mTiles >= numThreads ? 1 : nd4j::math::nd4j_min<int>(nPanels, (numThreads + mTiles - 1) / mTiles);
+                int panelsPerChunk = (nPanels + nChunks - 1) / nChunks;
 
-                    if (beta != (T) 0.0f) {
-                        C[zIdx] = dot + beta * C[zIdx];
-                    } else {
-                        C[zIdx] = dot;
+                for (int pc = 0; pc < K; pc += KC) {
+                    int kc = nd4j::math::nd4j_min<int>(KC, K - pc);
+
+                    // beta is applied along with the first K block, further blocks just accumulate
+                    Acc accBeta = pc == 0 ? (Acc) beta : (Acc) 1.0f;
+
+                    T *bBlock = transBFlag ? B + (jc + (Nd4jIndex) pc * ldb) : B + (pc + (Nd4jIndex) jc * ldb);
+                    packB(transBFlag, kc, nc, bBlock, ldb, packedB, parallel);
+
+#pragma omp parallel for collapse(2) schedule(dynamic) if(parallel) num_threads(numThreads) proc_bind(close)
+                    for (int it = 0; it < mTiles; it++) {
+                        for (int ch = 0; ch < nChunks; ch++) {
+                            int ic = it * MC;
+                            int mc = nd4j::math::nd4j_min<int>(MC, M - ic);
+
+                            Acc *pA = packedA + (Nd4jIndex) omp_get_thread_num() * MC * KC;
+                            T *aBlock = transAFlag ? A + (pc + (Nd4jIndex) ic * lda) : A + (ic + (Nd4jIndex) pc * lda);
+                            packA(transAFlag, mc, kc, aBlock, lda, pA);
+
+                            int pStop = nd4j::math::nd4j_min<int>(nPanels, (ch + 1) * panelsPerChunk);
+                            for (int p = ch * panelsPerChunk; p < pStop; p++) {
+                                int jr = p * NR;
+                                int nr = nd4j::math::nd4j_min<int>(NR, nc - jr);
+                                Acc *pB = packedB + (Nd4jIndex) jr * kc;
+
+                                for (int ir = 0; ir < mc; ir += MR) {
+                                    int mr = nd4j::math::nd4j_min<int>(MR, mc - ir);
+                                    kernel(kc, pA + (Nd4jIndex) ir * kc, pB, mr, nr, accAlpha, accBeta, C + (ic + ir) + (Nd4jIndex) (jc + jr) * ldc, ldc);
+                                }
+                            }
+                        }
                     }
                 }
             }
+
+            delete[] packedA;
+            delete[] packedB;
         }
 
 
+        /**
+         * TRANS == CblasTrans means A is column-major M x N matrix, otherwise A is row-major with rows of length lda.
+         * Both layouts are consumed in place, and dot products are accumulated in GemmBlocking<T>::acc_type
+         */
         template<typename T>
         void GEMV<T>::op(int TRANS, int M, int N,
                        T alpha,
@@ -102,20 +261,59 @@ namespace nd4j {
                        T* Y,
                        int incy ) {
 
-            T *aT = TRANS == CblasTrans ? GEMM<T>::transpose(CblasColMajor, CblasRowMajor, M, N, A) : A;
+            typedef typename GemmBlocking<T>::acc_type Acc;
 
-#pragma omp parallel for proc_bind(close)
-            for (int r = 0; r < M; r++) {
-                int aIdx = GEMM<T>::linearIndexC(M, N, r, 0);
-                T *aX = aT + aIdx;
+            Acc accAlpha = (Acc) alpha;
+            Acc accBeta = (Acc) beta;
+            bool parallel = (Nd4jIndex) M * N > 8192;
 
+            if (TRANS == CblasTrans) {
+                // column-major A: we go through columns, and accumulate block of rows in local buffer
+                const int ROWS = 256;
+                int numBlocks = (M + ROWS - 1) / ROWS;
 
-                T dot = nd4j::math::nd4j_dot<T>(aX, X, lda) * alpha;
-                Y[r] =  beta == (T) 0.0f ? dot : dot + beta * Y[r];
-            }
+#pragma omp parallel for if(parallel && numBlocks > 1) proc_bind(close)
+                for (int b = 0; b < numBlocks; b++) {
+                    int r0 = b * ROWS;
+                    int rows = nd4j::math::nd4j_min<int>(ROWS, M - r0);
+                    Acc acc[ROWS];
+
+                    for (int r = 0; r < rows; r++)
+                        acc[r] = (Acc) 0.0f;
+
+                    for (int c = 0; c < N; c++) {
+                        Acc xv = (Acc) X[(Nd4jIndex) c * incx];
+                        T *col = A + r0 + (Nd4jIndex) c * M;
+
+#pragma omp simd
+                        for (int r = 0; r < rows; r++)
+                            acc[r] += (Acc) col[r] * xv;
+                    }
+
+                    for (int r = 0; r < rows; r++) {
+                        T *y = Y + (Nd4jIndex) (r0 + r) * incy;
+                        *y = beta == (T) 0.0f ? (T) (accAlpha * acc[r]) : (T) (accAlpha * acc[r] + accBeta * (Acc) *y);
+                    }
+                }
+            } else {
+#pragma omp parallel for if(parallel) proc_bind(close)
+                for (int r = 0; r < M; r++) {
+                    T *aX = A + (Nd4jIndex) r * N;
+                    Acc dot = (Acc) 0.0f;
 
-            if (TRANS == CblasTrans)
-                delete[] aT;
+                    if (incx == 1) {
+#pragma omp simd reduction(+:dot)
+                        for (int c = 0; c < lda; c++)
+                            dot += (Acc) aX[c] * (Acc) X[c];
+                    } else {
+                        for (int c = 0; c < lda; c++)
+                            dot += (Acc) aX[c] * (Acc) X[(Nd4jIndex) c * incx];
+                    }
+
+                    T *y = Y + (Nd4jIndex) r * incy;
+                    *y = beta == (T) 0.0f ? (T) (accAlpha * dot) : (T) (accAlpha * dot + accBeta * (Acc) *y);
+                }
+            }
         }
 
 
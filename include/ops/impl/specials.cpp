@@ -7,6 +7,7 @@
 #include <helpers/shape.h>
 #include <helpers/TAD.h>
 #include <specials.h>
+#include <helpers/RadixSort.h>
 
 namespace nd4j {
     /**
@@ -455,76 +456,6 @@ namespace nd4j {
         }
     }
 
-    template<typename T>
-    void SpecialMethods<T>::quickSort_parallel_internal(T* array, int *xShapeInfo, int left, int right, int cutoff, bool descending) {
-
-        int i = left, j = right;
-        T tmp;
-        T pivot = array[getPosition(xShapeInfo, (left + right) / 2)];
-
-
-        {
-            /* PARTITION PART */
-            while (i <= j) {
-                if (descending) {
-                    while (array[getPosition(xShapeInfo, i)] > pivot)
-                        i++;
-                    while (array[getPosition(xShapeInfo, j)] < pivot)
-                        j--;
-                    if (i <= j) {
-                        tmp = array[getPosition(xShapeInfo, i)];
-                        array[getPosition(xShapeInfo, i)] = array[getPosition(xShapeInfo, j)];
-                        array[getPosition(xShapeInfo, j)] = tmp;
-                        i++;
-                        j--;
-                    }
-                } else {
-                    while (array[getPosition(xShapeInfo, i)] < pivot)
-                        i++;
-                    while (array[getPosition(xShapeInfo, j)] > pivot)
-                        j--;
-                    if (i <= j) {
-                        tmp = array[getPosition(xShapeInfo, i)];
-                        array[getPosition(xShapeInfo, i)] = array[getPosition(xShapeInfo, j)];
-                        array[getPosition(xShapeInfo, j)] = tmp;
-                        i++;
-                        j--;
-                    }
-                }
-            }
-
-        }
-
-        //
-
-        if ( ((right-left)<cutoff) ){
-            if (left < j){ quickSort_parallel_internal(array, xShapeInfo, left, j, cutoff, descending); }
-            if (i < right){ quickSort_parallel_internal(array, xShapeInfo, i, right, cutoff, descending); }
-
-        }else{
-#pragma omp task
-            { quickSort_parallel_internal(array, xShapeInfo, left, j, cutoff, descending); }
-#pragma omp task
-            { quickSort_parallel_internal(array, xShapeInfo, i, right, cutoff, descending); }
-        }
-
-    }
-
-    template<typename T>
-    void SpecialMethods<T>::quickSort_parallel(T* array, int *xShapeInfo, Nd4jIndex lenArray, int numThreads, bool descending){
-
-        int cutoff = 1000;
-
-#pragma omp parallel num_threads(numThreads)
-        {
-#pragma omp single nowait
-            {
-                quickSort_parallel_internal(array, xShapeInfo, 0, lenArray-1, cutoff, descending);
-            }
-        }
-
-    }
-
     int nextPowerOf2(int number) {
         int pos = 0;
 
@@ -547,22 +478,79 @@ namespace nd4j {
 
     template<typename T>
     void SpecialMethods<T>::sortGeneric(T *x, int *xShapeInfo, bool descending) {
-        quickSort_parallel(x, xShapeInfo, shape::length(xShapeInfo), omp_get_max_threads(), descending);
+        Nd4jIndex length = shape::length(xShapeInfo);
+
+        if (shape::elementWiseStride(xShapeInfo) == 1) {
+            RadixSort::sort(x, length, descending);
+            return;
+        }
+
+        // strided arrays are sorted through contiguous copy
+        std::vector<T> buffer(length);
+        for (Nd4jIndex e = 0; e < length; e++)
+            buffer[e] = x[getPosition(xShapeInfo, e)];
+
+        RadixSort::sort(buffer.data(), length, descending);
+
+        for (Nd4jIndex e = 0; e < length; e++)
+            x[getPosition(xShapeInfo, e)] = buffer[e];
     }
 
     template<typename T>
     void SpecialMethods<T>::sortTadGeneric(T *x, int *xShapeInfo, int *dimension, int dimensionLength, int *tadShapeInfo, Nd4jIndex *tadOffsets, bool descending) {
-        //quickSort_parallel(x, xShapeInfo, shape::length(xShapeInfo), omp_get_max_threads(), descending);
         Nd4jIndex xLength = shape::length(xShapeInfo);
         Nd4jIndex xTadLength = shape::tadLength(xShapeInfo, dimension, dimensionLength);
         int numTads = xLength / xTadLength;
 
-#pragma omp parallel for
-        for (int r = 0; r < numTads; r++) {
-            T *dx = x + tadOffsets[r];
+        // few long TADs are sorted one by one, each with all threads. Otherwise every thread sorts its own TADs
+        if (numTads < omp_get_max_threads()) {
+            for (int r = 0; r < numTads; r++)
+                sortGeneric(x + tadOffsets[r], tadShapeInfo, descending);
+        } else {
+#pragma omp parallel for schedule(guided)
+            for (int r = 0; r < numTads; r++)
+                sortGeneric(x + tadOffsets[r], tadShapeInfo, descending);
+        }
+    }
+
+    template<typename T>
+    void SpecialMethods<T>::sortByKeyGeneric(T *x, int *xShapeInfo, T *y, int *yShapeInfo, bool descending) {
+        Nd4jIndex length = shape::length(xShapeInfo);
+
+        if (shape::elementWiseStride(xShapeInfo) == 1 && shape::elementWiseStride(yShapeInfo) == 1) {
+            RadixSort::sortByKey(x, y, length, descending);
+            return;
+        }
+
+        std::vector<T> keys(length);
+        std::vector<T> values(length);
+        for (Nd4jIndex e = 0; e < length; e++) {
+            keys[e] = x[getPosition(xShapeInfo, e)];
+            values[e] = y[getPosition(yShapeInfo, e)];
+        }
+
+        RadixSort::sortByKey(keys.data(), values.data(), length, descending);
+
+        for (Nd4jIndex e = 0; e < length; e++) {
+            x[getPosition(xShapeInfo, e)] = keys[e];
+            y[getPosition(yShapeInfo, e)] = values[e];
+        }
+    }
+
+    template<typename T>
+    void SpecialMethods<T>::argsortGeneric(T *x, int *xShapeInfo, Nd4jIndex *z, bool descending) {
+        Nd4jIndex length = shape::length(xShapeInfo);
 
-            quickSort_parallel(dx, tadShapeInfo, xTadLength, 1, descending);
+        if (shape::elementWiseStride(xShapeInfo) == 1) {
+            RadixSort::argsort(x, z, length, descending);
+            return;
         }
+
+        std::vector<T> keys(length);
+        for (Nd4jIndex e = 0; e < length; e++)
+            keys[e] = x[getPosition(xShapeInfo, e)];
+
+        RadixSort::argsort(keys.data(), z, length, descending);
     }
 
 
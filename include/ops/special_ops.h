@@ -230,8 +230,8 @@ namespace simdOps {
             int *strideIn = shape::stride(xShapeBuffer);
             int *strideOut = shape::stride(resultShapeBuffer);
 
-            int idx = 0;
-//#pragma omp parallel for collapse(2)
+			// every image is pooled independently, and output is addressed via strides, so images can be split between threads
+#pragma omp parallel for collapse(2) schedule(guided) if (shape::length(resultShapeBuffer) * kH * kW > ELEMENT_THRESHOLD)
 			for(int k = 0; k < inChannels; k++)
 			{
 				for(int p = 0; p < batchSize; p++)
@@ -312,7 +312,7 @@ namespace simdOps {
                             } else if (poolingMode == 2)
 								res = nd4j::math::nd4j_pow<T>(res, (T) 1.0f / extraParam0);
 
-							*ptr_output++ = res;
+							ptr_output[yy * strideOut[2] + xx * strideOut[3]] = res;
 
 /*
                             nd4j_printf("index: %i; hstart: %i; hend: %i; wstart: %i; wend: %i; ph: %i; pw: %i; hstart_orig: %i; hend_orig: %i;\n", idx, hstart, hend, wstart, wend, yy, xx, hSO, hEO);
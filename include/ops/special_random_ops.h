@@ -352,56 +352,36 @@ namespace randomOps {
             int _threads = nd4j::math::nd4j_max<int>(1, elementsPerThread);
             _threads = nd4j::math::nd4j_min<int>(_threads, omp_get_max_threads());
 
-            int span = (zLength / _threads) + 8;
-
-            // we're enforcing even chunks, since it's mandatory for this algorithm
-            span -= span % 2;
-
             nd4j::random::RandomBuffer *buffer = reinterpret_cast<nd4j::random::RandomBuffer *> (state);
 
             T mean = extraArguments[0];
             T stddev = extraArguments[1];
 
-#pragma omp parallel num_threads(_threads) if (_threads > 1) proc_bind(spread)
-            {
-                int tid = omp_get_thread_num();
-                Nd4jIndex start = span * tid;
-                Nd4jIndex end = span * (tid + 1);
-                if (end > zLength) end = zLength;
-
-                T z0, z1;
-                T u0, u1;
-                T lnU0;
-                bool generated = false;
-
-                for (Nd4jIndex e = start; e < end; e++) {
-                    if (!generated) {
-                        /*
-                         * Since box-muller transform expects non-zero u0 value, we'll just use rng with boundaries
-                         */
-                        u0 = buffer->relativeT<T>(e, (T) 1e-5f, (T) 1.0f);
-                        u1 = buffer->relativeT<T>((e + 1), (T) 1e-5f, (T) 1.0f);
-                        lnU0 = nd4j::math::nd4j_sqrt<T>((T) -2.0f * nd4j::math::nd4j_log<T>(u0));
-                        z0 = lnU0 * nd4j::math::nd4j_cos<T>(two_pi * u1);
-                        z1 = lnU0 * nd4j::math::nd4j_sin<T>(two_pi * u1);
+            // pair (e, e + 1) is always built from counters e and e + 1, so results don't depend on number of threads
+            const Nd4jIndex pairs = (zLength + 1) / 2;
 
-                        generated = true;
+#pragma omp parallel for num_threads(_threads) if (_threads > 1) schedule(static) proc_bind(spread)
+            for (Nd4jIndex p = 0; p < pairs; p++) {
+                const Nd4jIndex e = p * 2;
 
-                        T realMean = y == z ? mean : y[e * yEWS];
+                /*
+                 * Since box-muller transform expects non-zero u0 value, we'll just use rng with boundaries
+                 */
+                T u0 = buffer->relativeT<T>(e, (T) 1e-5f, (T) 1.0f);
+                T u1 = buffer->relativeT<T>(e + 1, (T) 1e-5f, (T) 1.0f);
+                T lnU0 = nd4j::math::nd4j_sqrt<T>((T) -2.0f * nd4j::math::nd4j_log<T>(u0));
 
-                        z[e * zEWS] = z0 * stddev + realMean;
-                    } else {
-                        T realMean = y == z ? mean : y[e * yEWS];
-
-                        z[e * zEWS] = z1 * stddev + realMean;
+                T realMean0 = y == z ? mean : y[e * yEWS];
+                z[e * zEWS] = lnU0 * nd4j::math::nd4j_cos<T>(two_pi * u1) * stddev + realMean0;
 
-                        generated = false;
-                    }
+                if (e + 1 < zLength) {
+                    T realMean1 = y == z ? mean : y[(e + 1) * yEWS];
+                    z[(e + 1) * zEWS] = lnU0 * nd4j::math::nd4j_sin<T>(two_pi * u1) * stddev + realMean1;
                 }
             }
 
-            // update rng state
-            buffer->rewindH(zLength);
+            // update rng state, odd length still consumes whole pair
+            buffer->rewindH(pairs * 2);
 
         }
     };
@@ -459,7 +439,7 @@ namespace randomOps {
             for (Nd4jIndex e = tid; e < zLength; e += blockDim.x * gridDim.x) {
                 int success = 0;
                 for (int t = 1; t <= trials; t++) {
-                    T randVal = buffer->relativeT<T>((e+1) * t);
+                    T randVal = buffer->relativeT<T>(e * trials + t - 1);
                     if (y != z) {
                         // we're using external probs
                         prob = y[(t-1) * yEWS];
@@ -494,36 +474,27 @@ namespace randomOps {
             int _threads = nd4j::math::nd4j_max<int>(1, elementsPerThread);
             _threads = nd4j::math::nd4j_min<int>(_threads, omp_get_max_threads());
 
-            int span = (zLength / _threads) + 8;
-
             nd4j::random::RandomBuffer *buffer = reinterpret_cast<nd4j::random::RandomBuffer *> (state);
 
-#pragma omp parallel num_threads(_threads) if (_threads > 1) proc_bind(spread)
-            {
-                int tid = omp_get_thread_num();
-                Nd4jIndex start = span * tid;
-                Nd4jIndex end = span * (tid + 1);
-                if (end > zLength) end = zLength;
-
+            // every trial of every element has its own counter, so results don't depend on number of threads
+#pragma omp parallel for num_threads(_threads) if (_threads > 1) schedule(static) proc_bind(spread)
+            for (Nd4jIndex e = 0; e < zLength; e++) {
                 T prob = extraArguments[1];
 
-                for (Nd4jIndex e = start; e < end; e++) {
-
-                    int success = 0;
-                    for (int t = 1; t <= trials; t++) {
-                        T randVal = buffer->relativeT<T>((e+1) * t);
-                        if (y != z) {
-                            // we're using external probs
-                            prob = y[(t-1) * yEWS];
-                        }
-
-                        if (randVal < prob)
-                            success++;
+                int success = 0;
+                for (int t = 1; t <= trials; t++) {
+                    T randVal = buffer->relativeT<T>(e * trials + t - 1);
+                    if (y != z) {
+                        // we're using external probs
+                        prob = y[(t-1) * yEWS];
                     }
 
-                    // if trials is set to 0, effectively we just have successful memset
-                    z[e * zEWS] = (T) success;
+                    if (randVal < prob)
+                        success++;
                 }
+
+                // if trials is set to 0, effectively we just have successful memset
+                z[e * zEWS] = (T) success;
             }
 
             // update rng state
@@ -585,7 +556,7 @@ namespace randomOps {
             for (Nd4jIndex e = tid; e < zLength; e += blockDim.x * gridDim.x) {
                 int success = 0;
                 for (int t = 1; t <= trials; t++) {
-                    T randVal = buffer->relativeT<T>((e+1) * t);
+                    T randVal = buffer->relativeT<T>(e * trials + t - 1);
                     if (y != z) {
                         // we're using external probs
                         prob = y[e * yEWS];
@@ -620,36 +591,27 @@ namespace randomOps {
             int _threads = nd4j::math::nd4j_max<int>(1, elementsPerThread);
             _threads = nd4j::math::nd4j_min<int>(_threads, omp_get_max_threads());
 
-            int span = (zLength / _threads) + 8;
-
             nd4j::random::RandomBuffer *buffer = reinterpret_cast<nd4j::random::RandomBuffer *> (state);
 
-#pragma omp parallel num_threads(_threads) if (_threads > 1) proc_bind(spread)
-            {
-                int tid = omp_get_thread_num();
-                Nd4jIndex start = span * tid;
-                Nd4jIndex end = span * (tid + 1);
-                if (end > zLength) end = zLength;
-
+            // every trial of every element has its own counter, so results don't depend on number of threads
+#pragma omp parallel for num_threads(_threads) if (_threads > 1) schedule(static) proc_bind(spread)
+            for (Nd4jIndex e = 0; e < zLength; e++) {
                 T prob = extraArguments[1];
 
-                for (Nd4jIndex e = start; e < end; e++) {
-
-                    int success = 0;
-                    for (int t = 1; t <= trials; t++) {
-                        T randVal = buffer->relativeT<T>((e+1) * t);
-                        if (y != z) {
-                            // we're using external probs
-                            prob = y[e * yEWS];
-                        }
-
-                        if (randVal < prob)
-                            success++;
+                int success = 0;
+                for (int t = 1; t <= trials; t++) {
+                    T randVal = buffer->relativeT<T>(e * trials + t - 1);
+                    if (y != z) {
+                        // we're using external probs
+                        prob = y[e * yEWS];
                     }
 
-                    // if trials is set to 0, effectively we just have successful memset
-                    z[e * zEWS] = (T) success;
+                    if (randVal < prob)
+                        success++;
                 }
+
+                // if trials is set to 0, effectively we just have successful memset
+                z[e * zEWS] = (T) success;
             }
 
             // update rng state
@@ -728,19 +690,19 @@ namespace randomOps {
             for (Nd4jIndex e = tid; e < middle; e += step) {
                 // we need to get random values
 
-                Nd4jIndex generation0 = 0;
+                unsigned int attempt = 0;
                 T realMean0 = y == z ? mean : y[e * yEWS];
                 T realMean1 = y == z ? mean : y[(e + middle) * yEWS];
                 do {
-                    T u0 = buffer->relativeT<T>(e + generation0, epsilon, (T) 1.0f);
-                    T u1 = buffer->relativeT<T>(e + middle + generation0, epsilon, (T) 1.0f);
+                    T u0 = buffer->relativeT<T>(e, attempt, epsilon, (T) 1.0f);
+                    T u1 = buffer->relativeT<T>(e + middle, attempt, epsilon, (T) 1.0f);
 
                     z0 = nd4j::math::nd4j_sqrt<T>((T) -2.0f * nd4j::math::nd4j_log<T>(u0)) * nd4j::math::nd4j_cos<T>(two_pi * u1);
                     z1 = nd4j::math::nd4j_sqrt<T>((T) -2.0f * nd4j::math::nd4j_log<T>(u0)) * nd4j::math::nd4j_sin<T>(two_pi * u1);
 
                     result0 = z0 * stddev + realMean0;
                     result1 = z1 * stddev + realMean1;
-                    generation0 += zLength;
+                    attempt++;
                 } while (nd4j::math::nd4j_abs<T>(realMean0) + nd4j::math::nd4j_abs<T>(result0) > ds || nd4j::math::nd4j_abs<T>(realMean1) + nd4j::math::nd4j_abs<T>(result1) > ds);
 
                 z[e*zEWS] = result0;
@@ -767,55 +729,40 @@ namespace randomOps {
             int _threads = nd4j::math::nd4j_max<int>(1, elementsPerThread);
             _threads = nd4j::math::nd4j_min<int>(_threads, omp_get_max_threads());
 
-            int span = (middle / _threads) + 8;
-            // we're enforcing even chunks, since it's mandatory for this algorithm
-            span -= span % 2;
-
             nd4j::random::RandomBuffer *buffer = reinterpret_cast<nd4j::random::RandomBuffer *> (state);
 
             T mean = extraArguments[0];
             T stddev = extraArguments[1];
+            T ds = nd4j::math::nd4j_abs<T>(stddev) * (T) 2.0f;
 
-#pragma omp parallel num_threads(_threads) if (_threads > 1) proc_bind(spread)
-            {
-                int tid = omp_get_thread_num();
-                Nd4jIndex start = span * tid; 
-                Nd4jIndex end = span * (tid + 1);
-                if (end >  middle) {
-                    end = middle;
-                }
-    
-                T z0, z1;
-                T u0, u1;
-                T result0, result1, lnu0;
-
-                T ds = nd4j::math::nd4j_abs<T>(stddev) * (T) 2.0f;
-
-                for (Nd4jIndex e = start; e < end; e++) {
-                   
-                    /*
-                    * Since box-muller transform expects non-zero u0 value, we'll just use rng with boundaries
-                    */
-                    Nd4jIndex generation0 = 0;
-                    T realMean0 = y == z ? mean : y[e * yEWS];
-                    T realMean1 = y == z ? mean : y[(e + middle) * yEWS];
-                    do {
-                        u0 = buffer->relativeT<T>(e + generation0, (T) 1e-6f, (T) 1.0f);
-                        u1 = buffer->relativeT<T>((e + middle + generation0), (T) 1e-6f, (T) 1.0f);
-                        lnu0 = nd4j::math::nd4j_sqrt<T>((T) -2.0f * nd4j::math::nd4j_log<T>(u0));
-                        z0 = lnu0 * nd4j::math::nd4j_cos<T>(two_pi * u1);
-                        z1 = lnu0 * nd4j::math::nd4j_sin<T>(two_pi * u1);
-
-                        result0 = z0 * stddev + realMean0;
-                        result1 = z1 * stddev + realMean1;                            
-                        generation0 += zLength;
-                    } while (nd4j::math::nd4j_abs<T>(realMean0) + nd4j::math::nd4j_abs<T>(result0) > ds || nd4j::math::nd4j_abs<T>(realMean1) + nd4j::math::nd4j_abs<T>(result1) > ds);
-
-                    z[e*zEWS] = result0;
-                    if((e+middle) < zLength) 
-                        z[(e + middle) * zEWS] = result1;
-                }                            
+            // pair (e, e + middle) always uses counters e and e + middle, and rejected pairs are redrawn from secondary streams,
+            // so results don't depend on number of threads, and never overlap with values of subsequent calls
+#pragma omp parallel for num_threads(_threads) if (_threads > 1) schedule(guided) proc_bind(spread)
+            for (Nd4jIndex e = 0; e < middle; e++) {
+                /*
+                 * Since box-muller transform expects non-zero u0 value, we'll just use rng with boundaries
+                 */
+                const bool hasSecond = e + middle < zLength;
+                T realMean0 = y == z ? mean : y[e * yEWS];
+                T realMean1 = y == z || !hasSecond ? mean : y[(e + middle) * yEWS];
+                T result0, result1;
+
+                unsigned int attempt = 0;
+                do {
+                    T u0 = buffer->relativeT<T>(e, attempt, (T) 1e-6f, (T) 1.0f);
+                    T u1 = buffer->relativeT<T>(e + middle, attempt, (T) 1e-6f, (T) 1.0f);
+                    T lnU0 = nd4j::math::nd4j_sqrt<T>((T) -2.0f * nd4j::math::nd4j_log<T>(u0));
+
+                    result0 = lnU0 * nd4j::math::nd4j_cos<T>(two_pi * u1) * stddev + realMean0;
+                    result1 = lnU0 * nd4j::math::nd4j_sin<T>(two_pi * u1) * stddev + realMean1;
+                    attempt++;
+                } while (nd4j::math::nd4j_abs<T>(realMean0) + nd4j::math::nd4j_abs<T>(result0) > ds || nd4j::math::nd4j_abs<T>(realMean1) + nd4j::math::nd4j_abs<T>(result1) > ds);
+
+                z[e * zEWS] = result0;
+                if (hasSecond)
+                    z[(e + middle) * zEWS] = result1;
             }
+
             // update rng state
             buffer->rewindH(zLength);
 
@@ -924,56 +871,36 @@ namespace randomOps {
             int _threads = nd4j::math::nd4j_max<int>(1, elementsPerThread);
             _threads = nd4j::math::nd4j_min<int>(_threads, omp_get_max_threads());
 
-            int span = (zLength / _threads) + 8;
-
-            // we're enforcing even chunks, since it's mandatory for this algorithm
-            span -= span % 2;
-
             nd4j::random::RandomBuffer *buffer = reinterpret_cast<nd4j::random::RandomBuffer *> (state);
 
             T mean = extraArguments[0];
             T stddev = extraArguments[1];
 
-#pragma omp parallel num_threads(_threads) if (_threads > 1) proc_bind(spread)
-            {
-                int tid = omp_get_thread_num();
-                Nd4jIndex start = span * tid;
-                Nd4jIndex end = span * (tid + 1);
-                if (end > zLength) end = zLength;
+            // pair (e, e + 1) is always built from counters e and e + 1, so results don't depend on number of threads
+            const Nd4jIndex pairs = (zLength + 1) / 2;
 
-                T z0, z1;
-                T u0, u1;
-                T lnU0;
-                bool generated = false;
+#pragma omp parallel for num_threads(_threads) if (_threads > 1) schedule(static) proc_bind(spread)
+            for (Nd4jIndex p = 0; p < pairs; p++) {
+                const Nd4jIndex e = p * 2;
 
-                for (Nd4jIndex e = start; e < end; e++) {
-                    if (!generated) {
-                        /*
-                         * Since box-muller transform expects non-zero u0 value, we'll just use rng with boundaries
-                         */
-                        u0 = buffer->relativeT<T>(e, (T) 1e-5f, (T) 1.0f);
-                        u1 = buffer->relativeT<T>((e + 1), (T) 1e-5f, (T) 1.0f);
-                        lnU0 = nd4j::math::nd4j_sqrt<T>((T) -2.0f * nd4j::math::nd4j_log<T>(u0));
-                        z0 = lnU0 * nd4j::math::nd4j_cos<T>(two_pi * u1);
-                        z1 = lnU0 * nd4j::math::nd4j_sin<T>(two_pi * u1);
+                /*
+                 * Since box-muller transform expects non-zero u0 value, we'll just use rng with boundaries
+                 */
+                T u0 = buffer->relativeT<T>(e, (T) 1e-5f, (T) 1.0f);
+                T u1 = buffer->relativeT<T>(e + 1, (T) 1e-5f, (T) 1.0f);
+                T lnU0 = nd4j::math::nd4j_sqrt<T>((T) -2.0f * nd4j::math::nd4j_log<T>(u0));
 
-                        generated = true;
-
-                        T realMean = y == z ? mean : y[e * yEWS];
-
-                        z[e * zEWS] = nd4j::math::nd4j_exp<T>(z0 * stddev + realMean);
-                    } else {
-                        T realMean = y == z ? mean : y[e * yEWS];
-
-                        z[e * zEWS] = nd4j::math::nd4j_exp<T>(z1 * stddev + realMean);
+                T realMean0 = y == z ? mean : y[e * yEWS];
+                z[e * zEWS] = nd4j::math::nd4j_exp<T>(lnU0 * nd4j::math::nd4j_cos<T>(two_pi * u1) * stddev + realMean0);
 
-                        generated = false;
-                    }
+                if (e + 1 < zLength) {
+                    T realMean1 = y == z ? mean : y[(e + 1) * yEWS];
+                    z[(e + 1) * zEWS] = nd4j::math::nd4j_exp<T>(lnU0 * nd4j::math::nd4j_sin<T>(two_pi * u1) * stddev + realMean1);
                 }
             }
 
-            // update rng state
-            buffer->rewindH(zLength);
+            // update rng state, odd length still consumes whole pair
+            buffer->rewindH(pairs * 2);
 
         }
     };
@@ -30,14 +30,22 @@ namespace nd4j {
         static void averageGeneric(T **x, T *z, int n, const Nd4jIndex length, bool propagate);
 
         static int getPosition(int *xShapeInfo, int index);
-        static void quickSort_parallel_internal(T* array, int *xShapeInfo, int left, int right, int cutoff, bool descending);
-        static void quickSort_parallel(T* array, int *xShapeInfo, Nd4jIndex lenArray, int numThreads, bool descending);
 
         static int nextPowerOf2(int number);
         static int lastPowerOf2(int number);
 
+        /**
+         * Sorting methods are backed by LSD radix sort over sign-flipped bit patterns, see helpers/RadixSort.h
+         * sortByKeyGeneric sorts x, and applies the same permutation to y
+         */
         static void sortGeneric(T *x, int *xShapeInfo, bool descending);
         static void sortTadGeneric(T *x, int *xShapeInfo, int *dimension, int dimensionLength, int *tadShapeInfo, Nd4jIndex *tadOffsets, bool descending);
+        static void sortByKeyGeneric(T *x, int *xShapeInfo, T *y, int *yShapeInfo, bool descending);
+
+        /**
+         * This method writes into z positions of x elements in sorted order, x itself is left intact. Ties keep their original order
+         */
+        static void argsortGeneric(T *x, int *xShapeInfo, Nd4jIndex *z, bool descending);
 
         static void decodeBitmapGeneric(void *dx, Nd4jIndex N, T *dz);
         static Nd4jIndex encodeBitmapGeneric(T *dx, Nd4jIndex N, int *dz, float threshold);
@@ -23,24 +23,12 @@ namespace nd4j {
         * @param x
         */
             static void printIndex(int *indices, int rank, int x);
-            static bool ltIndices(int *indices, int rank, Nd4jIndex x, Nd4jIndex y);
 
             /**
-            * Returns true, if x > y, false otherwise
-            * @param indices
-            * @param rank
-            * @param x
-            * @param y
-            * @return
-            */
-            static bool gtIndices(int *indices, int rank, Nd4jIndex x, Nd4jIndex y);
-
-            static void swapEverything(int *indices, T *array, int rank, Nd4jIndex x, Nd4jIndex y);
-
-            static void coo_quickSort_parallel_internal(int *indices, T* array, Nd4jIndex left, Nd4jIndex right, int cutoff, int rank);
-
-            static void coo_quickSort_parallel(int *indices, T* array, Nd4jIndex lenArray, int numThreads, int rank);
-
+             * This method sorts COO entries by their indices, in lexicographic order.
+             * It's LSD radix sort over index columns: permutation is sorted by the last dimension first,
+             * and then stable-sorted by each outer one, so indices and values are moved only once, in the end
+             */
             static void sortCooIndicesGeneric(int *indices, T *values, Nd4jIndex length, int rank);
         };
     }
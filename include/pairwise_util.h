@@ -258,6 +258,14 @@ public:
     }
 };
 
+/**
+ * Decides whether TADs should be split into chunks processed in parallel, instead of spreading whole TADs across threads.
+ * That's the case when there's not enough TADs to keep all threads busy, and each TAD spans at least 2 blocks of threshold size.
+ */
+inline bool splitTads(Nd4jIndex numTads, Nd4jIndex tadLength, int threshold) {
+    return numTads < omp_get_max_threads() && tadLength / nd4j::math::nd4j_max<int>(1, threshold) > 1;
+}
+
 
 class CudaBlockInformation {
 
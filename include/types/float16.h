@@ -13,6 +13,13 @@
 // support for half precision conversion
 #ifdef __INTEL_COMPILER
 #include <emmintrin.h>
+#elif defined(__F16C__) && !defined(__CUDACC__)
+// hardware conversion is available on x86 when F16C is enabled via ARCH_TUNE
+#include <immintrin.h>
+#define ND4J_F16C
+#elif defined(__ARM_FP16_FORMAT_IEEE) && !defined(__CUDACC__)
+#include <cstring>
+#define ND4J_ARM_FP16
 #endif
 
 
@@ -93,11 +100,18 @@ typedef __half ihalf;
 #include <fp16_emu.h>
 
 
-#ifdef __INTEL_COMPILER
+#if defined(__INTEL_COMPILER) || defined(ND4J_F16C)
 //_Pragma("omp declare simd") inline
 local_def  float cpu_ihalf2float(ihalf h) {
     return _cvtsh_ss(h.getX());
 }
+#elif defined(ND4J_ARM_FP16)
+local_def  float cpu_ihalf2float(ihalf h) {
+    __fp16 v;
+    unsigned short x = h.getX();
+    std::memcpy(&v, &x, sizeof(x));
+    return (float) v;
+}
 #else
 local_def float cpu_ihalf2float(ihalf h) {
     unsigned sign = ((h.getX() >> 15) & 1);
@@ -128,13 +142,20 @@ local_def float cpu_ihalf2float(ihalf h) {
 }
 #endif
 
-#ifdef __INTEL_COMPILER
+#if defined(__INTEL_COMPILER) || defined(ND4J_F16C)
 //_Pragma("omp declare simd") inline
 local_def ihalf cpu_float2ihalf_rn(float f) {
     ihalf ret;
     ret.x = _cvtss_sh(f, 0);
     return ret;
 }
+#elif defined(ND4J_ARM_FP16)
+local_def ihalf cpu_float2ihalf_rn(float f) {
+    ihalf ret;
+    __fp16 v = (__fp16) f;
+    std::memcpy(ret.getXP(), &v, sizeof(v));
+    return ret;
+}
 
 #else
 local_def ihalf cpu_float2ihalf_rn(float f)
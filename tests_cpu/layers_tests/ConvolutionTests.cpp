@@ -1158,6 +1158,134 @@ TEST_F(ConvolutionTests, conv2d_test3) {
     delete results;
 }
 
+//////////////////////////////////////////////////////////////////////
+TEST_F(ConvolutionTests, conv2d_test4) {
+
+    // 3x3 stride 1 with enough channels goes through Winograd engine
+    int bS=2, iH=9,iW=8,  iC=16,oC=16,  kH=3,kW=3,  sH=1,sW=1,  pH=1,pW=1,  dH=1,dW=1;
+    int       oH=9,oW=8;
+    int paddingMode = 1;             // 1-SAME, 0-VALID;
+    int dataFormat  = 0;             // 1-NHWC, 0-NCHW
+
+    NDArray<float> input   ('c', {bS, iC, iH, iW});
+    NDArray<float> weights ('c', {oC, iC, kH, kW});
+    NDArray<float> expOutput('c', {bS, oC, oH, oW});
+
+    NDArrayFactory<float>::linspace(-1., input, 0.001);
+    NDArrayFactory<float>::linspace(0.5, weights, -0.0005);
+
+    ASSERT_EQ(CONV_WINOGRAD, ConvolutionUtils<float>::conv2dAlgorithm(iC, oC, oH, oW, kH, kW, sH, sW, dH, dW));
+
+    for (int b = 0; b < bS; ++b)
+        for (int o = 0; o < oC; ++o)
+            for (int y = 0; y < oH; ++y)
+                for (int x = 0; x < oW; ++x) {
+                    double sum = 0.;
+                    for (int c = 0; c < iC; ++c)
+                        for (int ky = 0; ky < kH; ++ky)
+                            for (int kx = 0; kx < kW; ++kx) {
+                                int iy = y * sH - pH + ky * dH;
+                                int ix = x * sW - pW + kx * dW;
+                                if (iy >= 0 && ix >= 0 && iy < iH && ix < iW)
+                                    sum += (double) input(b, c, iy, ix) * (double) weights(o, c, ky, kx);
+                            }
+                    expOutput(b, o, y, x) = (float) sum;
+                }
+
+    nd4j::ops::conv2d<float> op;
+    ResultSet<float>* results = op.execute({&input, &weights}, {}, {kH,kW,  sH,sW,  pH,pW,  dH,dW, paddingMode, dataFormat});
+    NDArray<float>* output = results->at(0);
+
+    ASSERT_EQ(Status::OK(), results->status());
+
+    ASSERT_TRUE(expOutput.isSameShape(output));
+    ASSERT_TRUE(expOutput.equalsTo(output, 1e-3));
+
+    delete results;
+}
+
+//////////////////////////////////////////////////////////////////////
+TEST_F(ConvolutionTests, conv2d_test5) {
+
+    // the same as above, NHWC data format
+    int bS=2, iH=9,iW=8,  iC=16,oC=16,  kH=3,kW=3,  sH=1,sW=1,  pH=0,pW=0,  dH=1,dW=1;
+    int       oH=7,oW=6;
+    int paddingMode = 0;             // 1-SAME, 0-VALID;
+    int dataFormat  = 1;             // 1-NHWC, 0-NCHW
+
+    NDArray<float> input   ('c', {bS, iH, iW, iC});
+    NDArray<float> weights ('c', {kH, kW, iC, oC});
+    NDArray<float> bias    ('c', {oC});
+    NDArray<float> expOutput('c', {bS, oH, oW, oC});
+
+    NDArrayFactory<float>::linspace(-1., input, 0.001);
+    NDArrayFactory<float>::linspace(0.5, weights, -0.0005);
+    NDArrayFactory<float>::linspace(1., bias, 1.);
+
+    for (int b = 0; b < bS; ++b)
+        for (int o = 0; o < oC; ++o)
+            for (int y = 0; y < oH; ++y)
+                for (int x = 0; x < oW; ++x) {
+                    double sum = bias(o);
+                    for (int c = 0; c < iC; ++c)
+                        for (int ky = 0; ky < kH; ++ky)
+                            for (int kx = 0; kx < kW; ++kx)
+                                sum += (double) input(b, y + ky, x + kx, c) * (double) weights(ky, kx, c, o);
+                    expOutput(b, y, x, o) = (float) sum;
+                }
+
+    nd4j::ops::conv2d<float> op;
+    ResultSet<float>* results = op.execute({&input, &weights, &bias}, {}, {kH,kW,  sH,sW,  pH,pW,  dH,dW, paddingMode, dataFormat});
+    NDArray<float>* output = results->at(0);
+
+    ASSERT_EQ(Status::OK(), results->status());
+
+    ASSERT_TRUE(expOutput.isSameShape(output));
+    ASSERT_TRUE(expOutput.equalsTo(output, 1e-3));
+
+    delete results;
+}
+
+//////////////////////////////////////////////////////////////////////
+TEST_F(ConvolutionTests, conv2d_test6) {
+
+    // 1x1 kernel goes through direct engine
+    int bS=2, iH=5,iW=4,  iC=3,oC=4,  kH=1,kW=1,  sH=2,sW=2,  pH=0,pW=0,  dH=1,dW=1;
+    int       oH=3,oW=2;
+    int paddingMode = 0;             // 1-SAME, 0-VALID;
+    int dataFormat  = 1;             // 1-NHWC, 0-NCHW
+
+    NDArray<double> input   ('c', {bS, iH, iW, iC});
+    NDArray<double> weights ('c', {kH, kW, iC, oC});
+    NDArray<double> expOutput('c', {bS, oH, oW, oC});
+
+    NDArrayFactory<double>::linspace(-1., input, 0.1);
+    NDArrayFactory<double>::linspace(0.5, weights, -0.1);
+
+    ASSERT_EQ(CONV_DIRECT, ConvolutionUtils<double>::conv2dAlgorithm(iC, oC, oH, oW, kH, kW, sH, sW, dH, dW));
+
+    for (int b = 0; b < bS; ++b)
+        for (int o = 0; o < oC; ++o)
+            for (int y = 0; y < oH; ++y)
+                for (int x = 0; x < oW; ++x) {
+                    double sum = 0.;
+                    for (int c = 0; c < iC; ++c)
+                        sum += input(b, y * sH, x * sW, c) * weights(0, 0, c, o);
+                    expOutput(b, y, x, o) = sum;
+                }
+
+    nd4j::ops::conv2d<double> op;
+    ResultSet<double>* results = op.execute({&input, &weights}, {}, {kH,kW,  sH,sW,  pH,pW,  dH,dW, paddingMode, dataFormat});
+    NDArray<double>* output = results->at(0);
+
+    ASSERT_EQ(Status::OK(), results->status());
+
+    ASSERT_TRUE(expOutput.isSameShape(output));
+    ASSERT_TRUE(expOutput.equalsTo(output));
+
+    delete results;
+}
+
 
 ////////////////////////////////////////////////////////////////////
 TEST_F(ConvolutionTests, conv3d_bp_test1) {
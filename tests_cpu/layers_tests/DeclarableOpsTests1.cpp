@@ -2578,6 +2578,43 @@ TEST_F(DeclarableOpsTests1, batchnorm_test4) {
     delete results;
 }
 
+////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests1, batchnorm_test5) {
+
+    // per-channel params along NCHW channels axis
+    NDArray<double> input   ('c', {2,3,2,2});
+    NDArray<double> mean    ('c', {1,3,1,1});
+    NDArray<double> variance('c', {1,3,1,1});
+    NDArray<double> gamma   ('c', {1,3,1,1});
+    NDArray<double> beta    ('c', {1,3,1,1});
+    NDArray<double> expected('c', {2,3,2,2});
+
+    NDArrayFactory<double>::linspace(-2., input, 0.25);
+    NDArrayFactory<double>::linspace(0.1, mean, 0.2);
+    NDArrayFactory<double>::linspace(0.5, variance, 0.5);
+    NDArrayFactory<double>::linspace(1., gamma, -0.5);
+    NDArrayFactory<double>::linspace(-1., beta, 1.);
+
+    for (int b = 0; b < 2; ++b)
+        for (int c = 0; c < 3; ++c)
+            for (int h = 0; h < 2; ++h)
+                for (int w = 0; w < 2; ++w)
+                    expected(b, c, h, w) = gamma(0, c, 0, 0) * (input(b, c, h, w) - mean(0, c, 0, 0)) / nd4j::math::nd4j_sqrt<double>(variance(0, c, 0, 0) + 1e-5) + beta(0, c, 0, 0);
+
+    nd4j::ops::batchnorm<double> op;
+
+    ResultSet<double>* results = op.execute({&input, &mean, &variance, &gamma, &beta}, {1e-5}, {1,1});
+
+    ASSERT_EQ(ND4J_STATUS_OK, results->status());
+
+    NDArray<double>* output = results->at(0);
+
+    ASSERT_TRUE(expected.isSameShapeStrict(output));
+    ASSERT_TRUE(expected.equalsTo(output));
+
+    delete results;
+}
+
 
 
 ////////////////////////////////////////////////////////////////////
@@ -3581,6 +3618,47 @@ TEST_F(DeclarableOpsTests1, softmax_test8) {
     delete results;
 }
 
+//////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests1, softmax_test9) {
+    // large logits must not overflow: softmax is shift invariant
+    NDArray<float> input('c', {2, 5}, {1000, 1001, 1002, 1003, 1004, -3, -2, -1, 0, 1});
+    NDArray<float> expOutput('c', {2, 5}, {0.01165623, 0.03168492, 0.08612854, 0.23412166, 0.63640865, 0.01165623, 0.03168492, 0.08612854, 0.23412166, 0.63640865});
+
+    nd4j::ops::softmax<float> op;
+    ResultSet<float>*  results = op.execute({&input}, {}, {});
+    NDArray<float>* z = results->at(0);
+
+    ASSERT_EQ(Status::OK(), results->status());
+    ASSERT_TRUE(expOutput.isSameShape(z));
+    ASSERT_TRUE(expOutput.equalsTo(z));
+
+    delete results;
+}
+
+//////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests1, softmax_test10) {
+    // softmax along dimension with non-unit stride
+    NDArray<double> input('f', {3, 4});
+    NDArrayFactory<double>::linspace(-2., input, 0.5);
+
+    nd4j::ops::softmax<double> op;
+    ResultSet<double>*  results = op.execute({&input}, {}, {0});
+    NDArray<double>* z = results->at(0);
+
+    ASSERT_EQ(Status::OK(), results->status());
+
+    for (int c = 0; c < 4; c++) {
+        double sum = 0.;
+        for (int r = 0; r < 3; r++)
+            sum += nd4j::math::nd4j_exp<double>(input(r, c));
+
+        for (int r = 0; r < 3; r++)
+            ASSERT_NEAR(nd4j::math::nd4j_exp<double>(input(r, c)) / sum, (*z)(r, c), 1e-10);
+    }
+
+    delete results;
+}
+
 //////////////////////////////////////////////////////////////////////
 TEST_F(DeclarableOpsTests1, Test_Stack_Edge_1) {
     float inBuff[]  = {1.0f, 2.0f, 3.0f};
@@ -4161,3 +4239,29 @@ TEST_F(DeclarableOpsTests1, Test_Expose_2) {
     ASSERT_TRUE(list == list1);
 
 }
+
+TEST_F(DeclarableOpsTests1, Test_Preallocated_Shape_1) {
+    auto variableSpace = new VariableSpace<float>();
+
+    auto x = new NDArray<float>('c', {3, 4});
+    NDArrayFactory<float>::linspace(1, *x);
+    variableSpace->putVariable(-1, x);
+
+    // same length, but other shape, i.e. left by run with other inputs
+    variableSpace->putVariable(1, new NDArray<float>('c', {2, 6}));
+
+    Context<float> block(1, variableSpace);
+    block.fillInputs({-1});
+
+    nd4j::ops::transpose<float> op;
+    ASSERT_EQ(ND4J_STATUS_OK, op.execute(&block));
+
+    auto exp = x->transpose();
+    auto z = variableSpace->getVariable(1)->getNDArray();
+
+    ASSERT_TRUE(exp->isSameShape(z));
+    ASSERT_TRUE(exp->equalsTo(z));
+
+    delete exp;
+    delete variableSpace;
+}
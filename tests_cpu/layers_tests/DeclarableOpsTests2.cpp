@@ -165,6 +165,37 @@ TEST_F(DeclarableOpsTests2, Gather_test_5) {
     delete result;
 }
 
+////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests2, Gather_test_6) {
+
+    // 'f' ordered input, enough rows to run in parallel
+    NDArray<double> input   ('f', {300, 3, 2});
+    NDArray<double> indices ('c', {1, 2000});
+    NDArray<double> expected('f', {300, 2000, 2});
+
+    NDArrayFactory<double>::linspace(1, input);
+    for (int e = 0; e < indices.lengthOf(); e++)
+        indices.putIndexedScalar(e, (e * 7) % 3);
+
+    for (int i = 0; i < 300; i++)
+        for (int j = 0; j < 2000; j++)
+            for (int k = 0; k < 2; k++)
+                expected(i, j, k) = input(i, (int) indices.getIndexedScalar(j), k);
+
+    nd4j::ops::gather<double> op;
+
+    ResultSet<double>* result = op.execute({&input, &indices}, {}, {1});
+
+    ASSERT_EQ(ND4J_STATUS_OK, result->status());
+
+    NDArray<double>* output = result->at(0);
+
+    ASSERT_TRUE(expected.isSameShape(output));
+    ASSERT_TRUE(expected.equalsTo(output));
+
+    delete result;
+}
+
 
 TEST_F(DeclarableOpsTests2, YetAnotherMatmulTest_1) {
     NDArray<float> A('c', {3, 3});
@@ -3,6 +3,7 @@
 #include <helpers/helper_hash.h>
 #include <NDArray.h>
 #include <array/NDArrayList.h>
+#include <map>
 
 
 using namespace nd4j;
@@ -145,6 +146,53 @@ TEST_F(DeclarableOpsTests3, Test_Unique_2) {
     delete result;
 }
 
+TEST_F(DeclarableOpsTests3, Test_Unique_3) {
+    // long enough input to be split between threads: ids and counts should still follow first occurrences
+    const int length = 200000;
+    NDArray<float> x('c', {1, length});
+    for (int e = 0; e < length; e++)
+        x.putIndexedScalar(e, (float) ((e * 7919) % 1543) - 700.f);
+
+    std::vector<float> expValues;
+    std::vector<int> expFirsts(length);
+    std::vector<int> expCounts;
+    std::vector<int> firstOf;
+    std::map<float, int> seen;
+    for (int e = 0; e < length; e++) {
+        float value = x.getIndexedScalar(e);
+        if (seen.count(value) == 0) {
+            seen[value] = (int) expValues.size();
+            expValues.emplace_back(value);
+            expCounts.emplace_back(0);
+            firstOf.emplace_back(e);
+        }
+
+        int id = seen[value];
+        expCounts[id]++;
+        expFirsts[e] = firstOf[id];
+    }
+
+    nd4j::ops::unique_with_counts<float> op;
+    auto result = op.execute({&x}, {}, {});
+
+    ASSERT_EQ(ND4J_STATUS_OK, result->status());
+
+    auto v = result->at(0);
+    auto i = result->at(1);
+    auto c = result->at(2);
+
+    ASSERT_EQ((int) expValues.size(), v->lengthOf());
+    for (int e = 0; e < (int) expValues.size(); e++) {
+        ASSERT_EQ(expValues[e], v->getIndexedScalar(e));
+        ASSERT_EQ(expCounts[e], (int) c->getIndexedScalar(e));
+    }
+
+    for (int e = 0; e < length; e++)
+        ASSERT_EQ(expFirsts[e], (int) i->getIndexedScalar(e));
+
+    delete result;
+}
+
 TEST_F(DeclarableOpsTests3, Test_Rint_1) {
     NDArray<float> x('c', {1, 7}, {-1.7, -1.5, -0.2, 0.2, 1.5, 1.7, 2.0});
     NDArray<float> exp('c', {1, 7}, {-2., -2., -0., 0., 2., 2., 2.});
@@ -369,6 +417,30 @@ TEST_F(DeclarableOpsTests3, Test_ListDiff_1) {
     delete result;
 }
 
+TEST_F(DeclarableOpsTests3, Test_ListDiff_2) {
+    NDArray<float> x('c', {8}, {5, -0.f, 3, 5, 7, 2, 9, 3});
+    NDArray<float> y('c', {4}, {3, 0, 7, 11});
+
+    NDArray<float> exp0('c', {4}, {5, 5, 2, 9});
+    NDArray<float> exp1('c', {4}, {0, 3, 5, 6});
+
+    nd4j::ops::listdiff<float> op;
+    auto result = op.execute({&x, &y}, {}, {});
+
+    ASSERT_EQ(Status::OK(), result->status());
+
+    auto z0 = result->at(0);
+    auto z1 = result->at(1);
+
+    ASSERT_TRUE(exp0.isSameShape(z0));
+    ASSERT_TRUE(exp0.equalsTo(z0));
+
+    ASSERT_TRUE(exp1.isSameShape(z1));
+    ASSERT_TRUE(exp1.equalsTo(z1));
+
+    delete result;
+}
+
 TEST_F(DeclarableOpsTests3, Test_Range_1) {
     NDArray<float> start('c', {1, 1}, {2});
     NDArray<float> stop('c', {1, 1}, {0});
@@ -274,6 +274,48 @@ TEST_F(DeclarableOpsTests4, Test_Pooling_Parity_12) {
 }
 
 
+TEST_F(DeclarableOpsTests4, Test_Pooling_Parity_BP_1) {
+    NDArray<float> x('c', {1, 4, 4, 2});
+    NDArray<float> eps('c', {1, 2, 2, 2}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f});
+    NDArray<float> exp('c', {1, 4, 4, 2}, {0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f,  0.f, 0.f, 1.f, 2.f, 0.f, 0.f, 3.f, 4.f,  0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f,  0.f, 0.f, 5.f, 6.f, 0.f, 0.f, 7.f, 8.f});
+
+    NDArrayFactory<float>::linspace(1, x);
+
+    nd4j::ops::maxpool2d_bp<float> op;
+    auto result = op.execute({&x, &eps}, {}, {2, 2, 2, 2, 0, 0, 1, 1, 0, 0, 1});
+
+    ASSERT_EQ(ND4J_STATUS_OK, result->status());
+
+    auto z = result->at(0);
+
+    ASSERT_TRUE(exp.isSameShape(z));
+    ASSERT_TRUE(exp.equalsTo(z));
+
+    delete result;
+}
+
+
+TEST_F(DeclarableOpsTests4, Test_Pooling_Parity_BP_2) {
+    NDArray<float> x('c', {1, 1, 3, 3});
+    NDArray<float> eps('c', {1, 1, 2, 2}, {4.f, 8.f, 8.f, 8.f});
+    NDArray<float> exp('c', {1, 1, 3, 3}, {4.f, 4.f, 4.f, 4.f, 2.f, 2.f, 4.f, 2.f, 2.f});
+
+    NDArrayFactory<float>::linspace(1, x);
+
+    // padding is excluded from divisor here
+    nd4j::ops::avgpool2d_bp<float> op;
+    auto result = op.execute({&x, &eps}, {}, {2, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0});
+
+    ASSERT_EQ(ND4J_STATUS_OK, result->status());
+
+    auto z = result->at(0);
+
+    ASSERT_TRUE(exp.isSameShape(z));
+    ASSERT_TRUE(exp.equalsTo(z));
+
+    delete result;
+}
+
 TEST_F(DeclarableOpsTests4, Test_BiasAdd_NHWC_1) {
     NDArray<float> x('c', {2, 3, 3, 2});
     NDArray<float> bias('c', {1, 2}, {1, 2});
@@ -1418,6 +1460,157 @@ TEST_F(DeclarableOpsTests4, gru_test1) {
     delete results;
 } 
 
+///////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests4, lstm_test2) {
+
+    const int time      = 4;
+    const int batchSize = 2;
+    const int inSize    = 3;
+    const int numProj   = 2;
+    const int numUnits  = 3;
+
+    NDArray<double> x  ('c', {time, batchSize, inSize});
+    NDArray<double> h0 ('c', {batchSize, numProj});
+    NDArray<double> c0 ('c', {batchSize, numUnits});
+    NDArray<double> Wx ('f', {inSize, 4*numUnits});
+    NDArray<double> Wh ('c', {numProj, 4*numUnits});
+    NDArray<double> Wc ('c', {3*numUnits});
+    NDArray<double> Wp ('c', {numUnits, numProj});
+    NDArray<double> b  ('c', {4*numUnits});
+
+    NDArrayFactory<double>::linspace(-1., x, 0.1);
+    NDArrayFactory<double>::linspace(0.5, h0, -0.3);
+    NDArrayFactory<double>::linspace(-2., c0, 0.7);
+    NDArrayFactory<double>::linspace(-0.5, Wx, 0.03);
+    NDArrayFactory<double>::linspace(0.4, Wh, -0.05);
+    NDArrayFactory<double>::linspace(-0.2, Wc, 0.05);
+    NDArrayFactory<double>::linspace(0.3, Wp, -0.1);
+    NDArrayFactory<double>::linspace(-0.1, b, 0.02);
+
+    // peephole connections, projection and clipping of both cell state and output
+    nd4j::ops::lstm<double> op;
+    nd4j::ResultSet<double>* results = op.execute({&x, &h0, &c0, &Wx, &Wh, &Wc, &Wp, &b}, {1.2, 0.25, 0.5}, {1, 1});
+
+    ASSERT_EQ(ND4J_STATUS_OK, results->status());
+
+    NDArray<double> *h = results->at(0);
+    NDArray<double> *c = results->at(1);
+
+    // the same sequence, one cell at a time
+    nd4j::ops::lstmCell<double> cellOp;
+    NDArray<double> ht(&h0);
+    NDArray<double> ct(&c0);
+    for (int t = 0; t < time; ++t) {
+        NDArray<double> xt = x({{t, t+1}, {}, {}});
+
+        nd4j::ResultSet<double>* cell = cellOp.execute({&xt, &ht, &ct, &Wx, &Wh, &Wc, &Wp, &b}, {1.2, 0.25, 0.5}, {1, 1});
+        ASSERT_EQ(ND4J_STATUS_OK, cell->status());
+
+        ht.assign(cell->at(0));
+        ct.assign(cell->at(1));
+        delete cell;
+
+        NDArray<double> hOut = (*h)({{t, t+1}, {}, {}});
+        NDArray<double> cOut = (*c)({{t, t+1}, {}, {}});
+
+        ASSERT_TRUE(ht.equalsTo(&hOut));
+        ASSERT_TRUE(ct.equalsTo(&cOut));
+    }
+
+    delete results;
+}
+
+///////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests4, lstm_test3) {
+
+    const int time      = 5;
+    const int batchSize = 3;
+    const int inSize    = 3;
+    const int numProj   = 3;
+    const int numUnits  = 3;
+
+    NDArray<float16> x  ('c', {time, batchSize, inSize});
+    NDArray<float16> h0 ('c', {batchSize, numProj});
+    NDArray<float16> c0 ('c', {batchSize, numUnits});
+    NDArray<float16> Wx ('c', {inSize, 4*numUnits});
+    NDArray<float16> Wh ('c', {numProj, 4*numUnits});
+    NDArray<float16> Wc ('c', {3*numUnits});
+    NDArray<float16> Wp ('c', {numUnits, numProj});
+    NDArray<float16> b  ('c', {4*numUnits});
+
+    NDArrayFactory<float16>::linspace((float16) 0.5, x, (float16) 0.5);
+    h0 = 1.;
+    c0 = 2.;
+    Wx = 0.003;
+    Wh = 0.006;
+    Wc = 0.;
+    Wp = 0.;
+    b = 0.5;
+
+    // same as lstm_test1, but in half precision
+    NDArray<float16> expClast('c', {1, batchSize, numProj}, {1.1589154,1.1589154,1.1589154,1.1892855,1.1892855,1.1892855,1.219861 ,1.219861 ,1.219861});
+
+    nd4j::ops::lstm<float16> op;
+    nd4j::ResultSet<float16>* results = op.execute({&x, &h0, &c0, &Wx, &Wh, &Wc, &Wp, &b}, {0., 0., 0.}, {0, 0});
+
+    ASSERT_EQ(ND4J_STATUS_OK, results->status());
+
+    NDArray<float16> *c = results->at(1);
+    NDArray<float16> cLast = (*c)({{4,5},{},{}},true);
+
+    ASSERT_TRUE(expClast.isSameShape(&cLast));
+    ASSERT_TRUE(expClast.equalsTo(&cLast, 1e-2));
+
+    delete results;
+}
+
+///////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests4, gru_test2) {
+
+    const int time      = 4;
+    const int batchSize = 2;
+    const int inSize    = 3;
+    const int numUnits  = 3;
+
+    NDArray<double> x  ('c', {time, batchSize, inSize});
+    NDArray<double> h0 ('c', {batchSize, numUnits});
+    NDArray<double> Wx ('c', {inSize, 3*numUnits});
+    NDArray<double> Wh ('f', {numUnits, 3*numUnits});
+    NDArray<double> b  ('c', {3*numUnits});
+
+    NDArrayFactory<double>::linspace(-1., x, 0.1);
+    NDArrayFactory<double>::linspace(0.5, h0, -0.2);
+    NDArrayFactory<double>::linspace(-0.5, Wx, 0.04);
+    NDArrayFactory<double>::linspace(0.4, Wh, -0.03);
+    NDArrayFactory<double>::linspace(-0.1, b, 0.05);
+
+    nd4j::ops::gru<double> op;
+    nd4j::ResultSet<double>* results = op.execute({&x, &h0, &Wx, &Wh, &b}, {}, {});
+
+    ASSERT_EQ(ND4J_STATUS_OK, results->status());
+
+    NDArray<double> *h = results->at(0);
+
+    // the same sequence, one cell at a time
+    nd4j::ops::gruCell<double> cellOp;
+    NDArray<double> ht(&h0);
+    for (int t = 0; t < time; ++t) {
+        NDArray<double> xt = x({{t, t+1}, {}, {}});
+
+        nd4j::ResultSet<double>* cell = cellOp.execute({&xt, &ht, &Wx, &Wh, &b}, {}, {});
+        ASSERT_EQ(ND4J_STATUS_OK, cell->status());
+
+        ht.assign(cell->at(0));
+        delete cell;
+
+        NDArray<double> hOut = (*h)({{t, t+1}, {}, {}});
+
+        ASSERT_TRUE(ht.equalsTo(&hOut));
+    }
+
+    delete results;
+}
+
 ///////////////////////////////////////////////////////////////////
 TEST_F(DeclarableOpsTests4, relu6_test1) {
     
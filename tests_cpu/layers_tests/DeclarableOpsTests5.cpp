@@ -1116,6 +1116,122 @@ TEST_F(DeclarableOpsTests5, Test_InTopK_3) {
     delete result;
 }
 
+//////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests5, Test_InTopK_4) {
+    // ties with k-th value are counted as hits
+    NDArray<float> x('c', {2, 4}, {1.0, 5.0, 5.0, 5.0,
+                                   -3.0, -1.0, -2.0, -1.0});
+    NDArray<float> y('c', {2}, {3, 2});
+    NDArray<float> expV('c', {2}, {1, 0});
+
+    nd4j::ops::in_top_k<float> op;
+    auto result = op.execute({&x, &y}, {}, {1});
+
+    ASSERT_EQ(ND4J_STATUS_OK, result->status());
+
+    auto v = result->at(0);
+
+    ASSERT_TRUE(expV.isSameShape(v));
+    ASSERT_TRUE(expV.equalsTo(v));
+
+    delete result;
+}
+
+//////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests5, Test_TopK_6) {
+    NDArray<float> x('c', {2, 4}, {-5.0f, -1.5f, -3.0f, -2.0f,
+                                   -0.5f, -0.25f, -7.0f, -0.75f});
+    NDArray<float> expV('c', {2, 1}, {-1.5f, -0.25f});
+    NDArray<float> expI('c', {2, 1}, {1.0f, 1.0f});
+
+    nd4j::ops::top_k<float> op;
+    auto result = op.execute({&x}, {}, {1});
+
+    ASSERT_EQ(ND4J_STATUS_OK, result->status());
+
+    ASSERT_TRUE(expV.isSameShape(result->at(0)));
+    ASSERT_TRUE(expV.equalsTo(result->at(0)));
+    ASSERT_TRUE(expI.equalsTo(result->at(1)));
+
+    delete result;
+}
+
+//////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests5, Test_TopK_7) {
+    // rows are processed in parallel, and contain lots of ties
+    const int rows = 3;
+    const int columns = 100000;
+    const int k = 50;
+
+    NDArray<float> x('c', {rows, columns});
+    for (int r = 0; r < rows; r++)
+        for (int c = 0; c < columns; c++)
+            x.putScalar(r, c, (float) ((c * 7919 + r * 31) % 1000));
+
+    nd4j::ops::top_k<float> op;
+    auto result = op.execute({&x}, {}, {k, 1});
+
+    ASSERT_EQ(ND4J_STATUS_OK, result->status());
+
+    auto v = result->at(0);
+    auto i = result->at(1);
+
+    for (int r = 0; r < rows; r++) {
+        std::vector<std::pair<float, int>> reference(columns);
+        for (int c = 0; c < columns; c++)
+            reference[c] = std::make_pair(x.getScalar(r, c), c);
+
+        std::stable_sort(reference.begin(), reference.end(), [](const std::pair<float, int>& a, const std::pair<float, int>& b) {
+            return a.first > b.first;
+        });
+
+        for (int e = 0; e < k; e++) {
+            ASSERT_NEAR(reference[e].first, v->getScalar(r, e), 1e-5f);
+            ASSERT_EQ(reference[e].second, (int) i->getScalar(r, e));
+        }
+    }
+
+    delete result;
+}
+
+TEST_F(DeclarableOpsTests5, Test_TopK_8) {
+    // single row is long enough to be split between threads, and contains lots of ties
+    const int columns = 100000;
+    const int k = 50;
+
+    NDArray<float> x('c', {1, columns});
+    for (int c = 0; c < columns; c++)
+        x.putScalar(0, c, (float) ((c * 7919) % 1000));
+
+    auto threads = omp_get_max_threads();
+    omp_set_num_threads(4);
+
+    nd4j::ops::top_k<float> op;
+    auto result = op.execute({&x}, {}, {k, 1});
+
+    omp_set_num_threads(threads);
+
+    ASSERT_EQ(ND4J_STATUS_OK, result->status());
+
+    auto v = result->at(0);
+    auto i = result->at(1);
+
+    std::vector<std::pair<float, int>> reference(columns);
+    for (int c = 0; c < columns; c++)
+        reference[c] = std::make_pair(x.getScalar(0, c), c);
+
+    std::stable_sort(reference.begin(), reference.end(), [](const std::pair<float, int>& a, const std::pair<float, int>& b) {
+        return a.first > b.first;
+    });
+
+    for (int e = 0; e < k; e++) {
+        ASSERT_NEAR(reference[e].first, v->getScalar(0, e), 1e-5f);
+        ASSERT_EQ(reference[e].second, (int) i->getScalar(0, e));
+    }
+
+    delete result;
+}
+
 ///////////////////////////////////////////////////////////
 
 TEST_F(DeclarableOpsTests5, Test_Moments_1) {
@@ -1910,6 +2026,37 @@ TEST_F(DeclarableOpsTests5, fusedBatchNorm_test5) {
     delete results;
 }
 
+//////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests5, fusedBatchNorm_test6) {
+
+    // NCHW: statistics are gathered per channel, over batch and spatial dimensions
+    NDArray<double> x('c', {2, 4, 2, 3});
+    NDArrayFactory<double>::linspace(1, x);
+    std::vector<int> shape = {4};
+    NDArray<double> scale('c', shape);
+
+    scale = 0.5;
+    NDArray<double> offset('c', shape);
+    offset = 2.;
+    NDArray<double> expY('c', {2, 4, 2, 3}, {1.40186255, 1.44311341, 1.48436427, 1.52561513, 1.56686598, 1.60811684, 1.40186255, 1.44311341, 1.48436427, 1.52561513, 1.56686598, 1.60811684, 1.40186255, 1.44311341, 1.48436427, 1.52561513, 1.56686598, 1.60811684, 1.40186255, 1.44311341, 1.48436427, 1.52561513, 1.56686598, 1.60811684, 2.39188316, 2.43313402, 2.47438487, 2.51563573, 2.55688659, 2.59813745, 2.39188316, 2.43313402, 2.47438487, 2.51563573, 2.55688659, 2.59813745, 2.39188316, 2.43313402, 2.47438487, 2.51563573, 2.55688659, 2.59813745, 2.39188316, 2.43313402, 2.47438487, 2.51563573, 2.55688659, 2.59813745});
+    NDArray<double> expBatchMean('c', shape, {15.5, 21.5, 27.5, 33.5});
+    NDArray<double> expBatchVar('c', shape, {160.27272727, 160.27272727, 160.27272727, 160.27272727});
+
+    nd4j::ops::fused_batch_norm<double> op;
+    ResultSet<double>* results = op.execute({&x, &scale, &offset}, {}, {1,1});
+    NDArray<double>* y = results->at(0);
+    NDArray<double>* batchMean = results->at(1);
+    NDArray<double>* batchVar = results->at(2);
+
+    ASSERT_EQ(Status::OK(), results->status());
+    ASSERT_TRUE(expY.isSameShape(y));
+    ASSERT_TRUE(expY.equalsTo(y));
+    ASSERT_TRUE(expBatchMean.equalsTo(batchMean));
+    ASSERT_TRUE(expBatchVar.equalsTo(batchVar));
+
+    delete results;
+}
+
 //////////////////////////////////////////////////////////////////////
 TEST_F(DeclarableOpsTests5, confusion_matrix_test1) {
 
@@ -1969,6 +2116,25 @@ TEST_F(DeclarableOpsTests5, confusion_matrix_test3) {
     delete results;
 }
 
+//////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests5, confusion_matrix_test4) {
+
+    NDArray<float> labels('c', {1, 5}, {1, 2, 1, 0, 1});
+    NDArray<float> predictions('c', {1, 5}, {0, 2, 0, 0, 1});
+    NDArray<float> weights('c', {1, 5}, {1, 2, 3, 4, 5});
+    NDArray<float> expected('c', {3, 3}, {4, 0, 0, 4, 5, 0, 0, 0, 2});
+
+    nd4j::ops::confusion_matrix<float> op;
+    ResultSet<float> *results = op.execute({&labels, &predictions, &weights}, {}, {3});
+    NDArray<float> *output = results->at(0);
+
+    ASSERT_EQ(Status::OK(), results->status());
+    ASSERT_TRUE(expected.isSameShape(output));
+    ASSERT_TRUE(expected.equalsTo(output));
+
+    delete results;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 TEST_F(DeclarableOpsTests5, ZeroFraction_1) {
     
@@ -2267,7 +2433,7 @@ TEST_F(DeclarableOpsTests5, log_softmax_bp_test1) {
 
     NDArray<double> input  ('c', {2, 2}, {1,2,3,4});
     NDArray<double> epsilon('c', {2, 2}, {0.1, 0.2, 0.3, 0.4});    
-    NDArray<double> exp('c', {2, 2}, {-0.07311,0.02689, -0.07311,0.02689});
+    NDArray<double> exp('c', {2, 2}, {0.019318, -0.019318, 0.111741, -0.111741});
     
     nd4j::ops::log_softmax_bp<double> op;
     ResultSet<double>*  results = op.execute({&input, &epsilon}, {}, {});
@@ -2285,7 +2451,7 @@ TEST_F(DeclarableOpsTests5, log_softmax_bp_test2) {
 
     NDArray<double> input  ('c', {2, 2}, {1,2,3,4});
     NDArray<double> epsilon('c', {2, 2}, {0.1, 0.2, 0.3, 0.4});    
-    NDArray<double> exp('c', {2, 2}, {-0.17616, -0.17616, 0.02384,  0.02384});
+    NDArray<double> exp('c', {2, 2}, {0.052319, 0.128478, -0.052319, -0.128478});
     
     nd4j::ops::log_softmax_bp<double> op;
     ResultSet<double>*  results = op.execute({&input, &epsilon}, {}, {0});
@@ -2298,6 +2464,42 @@ TEST_F(DeclarableOpsTests5, log_softmax_bp_test2) {
     delete results;
 }
 
+//////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests5, log_softmax_bp_test3) {
+
+    NDArray<double> input  ('c', {3, 5}, {0.5, -1.2, 2.0, 0.3, -0.7,   1.5, 1.4, -2.1, 0.0, 0.9,   -0.4, 3.1, 0.2, -1.8, 1.1});
+    NDArray<double> epsilon('c', {3, 5}, {0.3, -0.1, 0.8, 0.2, -0.5,   1.0, 0.4, 0.1, -0.6, 0.7,   0.2, 0.2, -0.9, 0.5, 0.3});
+
+    nd4j::ops::log_softmax<double> fwd;
+    nd4j::ops::log_softmax_bp<double> op;
+
+    // L = sum(eps * log_softmax(x)), checked against central differences
+    auto loss = [&](NDArray<double>& x) -> double {
+        ResultSet<double>* results = fwd.execute({&x}, {}, {1});
+        double l = 0.0;
+        for (int e = 0; e < x.lengthOf(); e++)
+            l += epsilon.getScalar(e) * results->at(0)->getScalar(e);
+        delete results;
+        return l;
+    };
+
+    ResultSet<double>* results = op.execute({&input, &epsilon}, {}, {1});
+    ASSERT_EQ(Status::OK(), results->status());
+    NDArray<double>* output = results->at(0);
+
+    const double h = 1e-5;
+    for (int e = 0; e < input.lengthOf(); e++) {
+        NDArray<double> xp(input);
+        NDArray<double> xm(input);
+        xp.putScalar(e, input.getScalar(e) + h);
+        xm.putScalar(e, input.getScalar(e) - h);
+
+        ASSERT_NEAR((loss(xp) - loss(xm)) / (2 * h), output->getScalar(e), 1e-6);
+    }
+
+    delete results;
+}
+
 //////////////////////////////////////////////////////////////////////
 TEST_F(DeclarableOpsTests5, ELU_1) {
 
@@ -532,6 +532,28 @@ TEST_F(DeclarableOpsTests6, BinCount_3) {
     delete res;
 }
 
+/////////////////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests6, BinCount_4) {
+
+    NDArray<double> x('c', {2, 2, 2}, {
+        1, 2, 0, 1, 2, 2, 1, 2}
+    );
+
+// ------------------------------------
+
+    NDArray<double> exp({1., 3., 4., 0., 0.});
+
+    nd4j::ops::bincount<double> op;
+
+    auto res = op.execute({&x}, {}, {5});
+
+    ASSERT_EQ(ND4J_STATUS_OK, res->status());
+    ASSERT_TRUE(exp.isSameShape(res->at(0)));
+    ASSERT_TRUE(exp.equalsTo(res->at(0)));
+
+    delete res;
+}
+
 /////////////////////////////////////////////////////////////////////////////////
 TEST_F(DeclarableOpsTests6, BroadcastDynamicShape_1) {
 
@@ -611,6 +611,25 @@ TEST_F(DeclarableOpsTests7, Test_Dynamic_Partition_119_1) {
 }
 
 
+TEST_F(DeclarableOpsTests7, Test_Dynamic_Partition_119_2) {
+    NDArray<float> x('c', {4, 3}, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+    NDArray<float> y('c', {4}, {1, 0, 1, 1});
+    NDArray<float> e0('c', {1, 3}, {4, 5, 6});
+    NDArray<float> e1('c', {3, 3}, {1, 2, 3, 7, 8, 9, 10, 11, 12});
+
+    nd4j::ops::dynamic_partition<float> op;
+    auto result = op.execute({&x, &y}, {}, {2});
+    ASSERT_EQ(Status::OK(), result->status());
+    ASSERT_EQ(2, result->size());
+
+    ASSERT_TRUE(e0.isSameShape(result->at(0)));
+    ASSERT_TRUE(e0.equalsTo(result->at(0)));
+    ASSERT_TRUE(e1.isSameShape(result->at(1)));
+    ASSERT_TRUE(e1.equalsTo(result->at(1)));
+
+    delete result;
+}
+
 TEST_F(DeclarableOpsTests7, Test_Gather_Vector_Case_119) {
     NDArray<float> input('c', {4}, {2.f, 3.f, 4.f, 5.f});
     NDArray<float> indices('c', {2}, {0.f, 2.f});
@@ -1608,3 +1627,104 @@ TEST_F(DeclarableOpsTests7, TestSegmentProd_4) {
     delete result;
 }
 
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests7, TestSegmentSum_5) {
+    // many tiny segments followed by few large ones, with skipped ids
+    const int numRows = 40000;
+    const int rowLength = 3;
+    NDArray<double> x('c', {numRows, rowLength});
+    NDArray<double> idx('c', {numRows});
+
+    std::vector<int> ids(numRows);
+    for (int r = 0; r < numRows; r++) {
+        ids[r] = r < numRows / 2 ? r / 2 : numRows / 4 + 1 + (r - numRows / 2) / (numRows / 8);
+        idx.putIndexedScalar(r, (double) ids[r]);
+        for (int c = 0; c < rowLength; c++)
+            x.putScalar(r, c, (double) ((r * 31 + c * 7) % 17) - 8.);
+    }
+
+    const int numSegments = ids[numRows - 1] + 1;
+    NDArray<double> expSum('c', {numSegments, rowLength});
+    NDArray<double> expMax('c', {numSegments, rowLength});
+    std::vector<int> seen(numSegments, 0);
+    for (int r = 0; r < numRows; r++) {
+        for (int c = 0; c < rowLength; c++) {
+            expSum.putScalar(ids[r], c, expSum.getScalar(ids[r], c) + x.getScalar(r, c));
+            expMax.putScalar(ids[r], c, seen[ids[r]] ? nd4j::math::nd4j_max<double>(expMax.getScalar(ids[r], c), x.getScalar(r, c)) : x.getScalar(r, c));
+        }
+
+        seen[ids[r]] = 1;
+    }
+
+    nd4j::ops::segment_sum<double> sum;
+    auto result = sum.execute({&x, &idx}, {}, {});
+    ASSERT_EQ(result->status(), Status::OK());
+    ASSERT_TRUE(expSum.isSameShape(result->at(0)));
+    ASSERT_TRUE(expSum.equalsTo(result->at(0)));
+    delete result;
+
+    nd4j::ops::segment_max<double> max;
+    result = max.execute({&x, &idx}, {}, {});
+    ASSERT_EQ(result->status(), Status::OK());
+    ASSERT_TRUE(expMax.equalsTo(result->at(0)));
+    delete result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests7, TestUnsortedSegmentSum_1) {
+    NDArray<double> x('c', {5, 2}, {1., 2., 3., 4., 5., 6., 7., 8., 9., 10.});
+    NDArray<double> idx({2.0, 0.0, 2.0, 3.0, 0.0});
+    NDArray<double> exp('c', {4, 2}, {12., 14., 0., 0., 6., 8., 7., 8.});
+
+    nd4j::ops::unsorted_segment_sum<double> op;
+
+    auto result = op.execute({&x, &idx}, {}, {4});
+    ASSERT_EQ(result->status(), Status::OK());
+    ASSERT_TRUE(exp.isSameShape(result->at(0)));
+    ASSERT_TRUE(exp.equalsTo(result->at(0)));
+
+    delete result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests7, TestUnsortedSegmentMax_1) {
+    NDArray<double> x({1.8, -2.5, 4., 9., -2.1, 2.4, 3., 9.});
+    NDArray<double> idx({1.0, 0.0, 1.0, 2.0, 0.0, 2.0, 1.0, 0.0});
+    NDArray<double> exp({9., 4., 9.});
+
+    nd4j::ops::unsorted_segment_max<double> op;
+
+    auto result = op.execute({&x, &idx}, {}, {3});
+    ASSERT_EQ(result->status(), Status::OK());
+    ASSERT_TRUE(exp.equalsTo(result->at(0)));
+
+    delete result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests7, TestUnsortedSegmentMinMeanProd_1) {
+    NDArray<double> x({1.8, -2.5, 4., 9., -2.1, 2.4, 3., 9.});
+    NDArray<double> idx({1.0, 0.0, 1.0, 2.0, 0.0, 2.0, 1.0, 0.0});
+    NDArray<double> expMin({-2.5, 1.8, 2.4});
+    NDArray<double> expMean({1.4666666666666666, 2.9333333333333333, 5.7});
+    NDArray<double> expProd({47.25, 21.6, 21.6});
+
+    nd4j::ops::unsorted_segment_min<double> min;
+    auto result = min.execute({&x, &idx}, {}, {3});
+    ASSERT_EQ(result->status(), Status::OK());
+    ASSERT_TRUE(expMin.equalsTo(result->at(0)));
+    delete result;
+
+    nd4j::ops::unsorted_segment_mean<double> mean;
+    result = mean.execute({&x, &idx}, {}, {3});
+    ASSERT_EQ(result->status(), Status::OK());
+    ASSERT_TRUE(expMean.equalsTo(result->at(0)));
+    delete result;
+
+    nd4j::ops::unsorted_segment_prod<double> prod;
+    result = prod.execute({&x, &idx}, {}, {3});
+    ASSERT_EQ(result->status(), Status::OK());
+    ASSERT_TRUE(expProd.equalsTo(result->at(0)));
+    delete result;
+}
@@ -552,6 +552,46 @@ TEST_F(FlatBuffersTest, ReduceDim_1) {
     delete graph;
 }
 
+TEST_F(FlatBuffersTest, ReadFile_Mapped_1) {
+    NDArray<float> exp('c', (std::vector<int>){3});
+    exp.assign(3.0);
+
+    // float weights are used right from the file
+    auto graph = GraphExecutioner<float>::importFromFlatBuffers("./resources/reduce_dim.fb");
+
+    ASSERT_TRUE(graph->bytesMapped() > 0);
+    ASSERT_EQ(0, graph->bytesConverted());
+
+    Nd4jStatus status = GraphExecutioner<float>::execute(graph);
+    ASSERT_EQ(ND4J_STATUS_OK, status);
+
+    auto z = graph->getVariableSpace()->getVariable(4)->getNDArray();
+    ASSERT_TRUE(exp.isSameShape(z));
+    ASSERT_TRUE(exp.equalsTo(z));
+
+    delete graph;
+}
+
+TEST_F(FlatBuffersTest, ReadFile_Mapped_2) {
+    NDArray<double> exp('c', (std::vector<int>){3});
+    exp.assign(3.0);
+
+    // while double graph has to convert them
+    auto graph = GraphExecutioner<double>::importFromFlatBuffers("./resources/reduce_dim.fb");
+
+    ASSERT_EQ(0, graph->bytesMapped());
+    ASSERT_TRUE(graph->bytesConverted() > 0);
+
+    Nd4jStatus status = GraphExecutioner<double>::execute(graph);
+    ASSERT_EQ(ND4J_STATUS_OK, status);
+
+    auto z = graph->getVariableSpace()->getVariable(4)->getNDArray();
+    ASSERT_TRUE(exp.isSameShape(z));
+    ASSERT_TRUE(exp.equalsTo(z));
+
+    delete graph;
+}
+
 TEST_F(FlatBuffersTest, Ae_00) {
     nd4j::ops::rank<float> op1;
 
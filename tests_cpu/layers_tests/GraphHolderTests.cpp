@@ -4,6 +4,10 @@
 
 #include "testlayers.h"
 #include <graph/GraphHolder.h>
+#include <GraphExecutioner.h>
+#include <NDArrayFactory.h>
+#include <ops/declarable/CustomOperations.h>
+#include <memory/MemoryRegistrator.h>
 
 using namespace nd4j;
 using namespace nd4j::ops;
@@ -67,4 +71,283 @@ TEST_F(GraphHolderTests, SimpleTests_3) {
 
 
     delete graph2;
-}
\ No newline at end of file
+}
+
+TEST_F(GraphHolderTests, SimpleTests_4) {
+    auto graph = GraphExecutioner<float>::importFromFlatBuffers("./resources/reduce_dim.fb");
+    Nd4jIndex graphId = 121;
+    GraphHolder::getInstance()->registerGraph(graphId, graph);
+
+    auto plan = GraphHolder::getInstance()->pullPlan<float>(graphId);
+
+    ASSERT_TRUE(plan->graph() == graph);
+    ASSERT_TRUE(plan->isCompiled());
+    ASSERT_EQ(graph->totalNodes(), plan->numberOfNodes());
+
+    // each run gets own VariableSpace, so graph itself stays untouched
+    auto space = plan->prepareSpace();
+    ASSERT_EQ(ND4J_STATUS_OK, plan->execute(space));
+
+    ASSERT_TRUE(space->hasVariable(4));
+    ASSERT_FALSE(graph->getVariableSpace()->hasVariable(4) && graph->getVariableSpace()->getVariable(4)->hasNDArray());
+
+    plan->releaseSpace(space);
+
+    GraphHolder::getInstance()->dropGraph<float>(graphId);
+
+    ASSERT_FALSE(GraphHolder::getInstance()->hasGraph<float>(graphId));
+}
+
+
+TEST_F(GraphHolderTests, Test_MemoryPlan_1) {
+    auto graph = new Graph<float>();
+
+    auto x = new NDArray<float>('c', {32, 32});
+    x->assign(0.0f);
+
+    graph->getVariableSpace()->putVariable(-1, x);
+
+    // chain of scalar adds, and one more consumer of node 2 at the very end
+    std::vector<Node<float>*> nodes({new Node<float>(OpType_SCALAR, 0, 1, {-1}, {2}, {}, 1.0f),
+                                     new Node<float>(OpType_SCALAR, 0, 2, {1}, {3, 7}, {}, 1.0f),
+                                     new Node<float>(OpType_SCALAR, 0, 3, {2}, {4}, {}, 1.0f),
+                                     new Node<float>(OpType_SCALAR, 0, 4, {3}, {5}, {}, 1.0f),
+                                     new Node<float>(OpType_SCALAR, 0, 5, {4}, {6}, {}, 1.0f),
+                                     new Node<float>(OpType_SCALAR, 0, 6, {5}, {7}, {}, 1.0f),
+                                     new Node<float>(OpType_PAIRWISE, 0, 7, {2, 6}, {})});
+
+    // every node gets its own output, so there's something to plan
+    for (auto node: nodes) {
+        node->markInplace(false);
+        graph->addNode(node);
+    }
+
+    Nd4jIndex graphId = 123;
+    GraphHolder::getInstance()->registerGraph(graphId, graph);
+
+    auto plan = GraphHolder::getInstance()->pullPlan<float>(graphId);
+    ASSERT_TRUE(plan->isCompiled());
+    ASSERT_TRUE(plan->memoryPlan() == nullptr);
+
+    NDArray<float> exp('c', {32, 32});
+    exp.assign(8.0f);
+
+    for (int e = 0; e < 3; e++) {
+        auto space = plan->prepareSpace();
+        ASSERT_EQ(ND4J_STATUS_OK, plan->execute(space));
+
+        auto z = space->getVariable(7)->getNDArray();
+        ASSERT_TRUE(exp.equalsTo(z));
+
+        plan->releaseSpace(space);
+    }
+
+    // 7 outputs, but only 3 of them are alive at the same time
+    auto memoryPlan = plan->memoryPlan();
+    ASSERT_TRUE(memoryPlan != nullptr);
+    ASSERT_EQ(7, memoryPlan->numberOfArrays());
+    ASSERT_EQ(7 * 1024 * sizeof(float), memoryPlan->naiveBytes());
+    ASSERT_EQ(3 * 1024 * sizeof(float), memoryPlan->plannedBytes());
+
+    GraphHolder::getInstance()->dropGraph<float>(graphId);
+}
+
+TEST_F(GraphHolderTests, Test_MemoryPlan_2) {
+    auto graph = new Graph<float>();
+
+    auto x = new NDArray<float>('c', {32, 32});
+    x->assign(0.0f);
+
+    graph->getVariableSpace()->putVariable(-1, x);
+
+    // first node is in-place, but consumes external variable
+    std::vector<Node<float>*> nodes({new Node<float>(OpType_SCALAR, 0, 1, {-1}, {2}, {}, 1.0f),
+                                     new Node<float>(OpType_SCALAR, 0, 2, {1}, {3}, {}, 1.0f),
+                                     new Node<float>(OpType_SCALAR, 0, 3, {2}, {4}, {}, 1.0f),
+                                     new Node<float>(OpType_PAIRWISE, 0, 4, {1, 3}, {})});
+
+    for (auto node: nodes) {
+        if (node->id() > 1)
+            node->markInplace(false);
+
+        graph->addNode(node);
+    }
+
+    ASSERT_TRUE(graph->nodeById(1)->isInplace());
+
+    ExecutionPlan<float> plan(graph);
+    ASSERT_TRUE(plan.isCompiled());
+
+    // plan keeps its own flags, graph nodes stay as they are
+    ASSERT_TRUE(graph->nodeById(1)->isInplace());
+
+    NDArray<float> exp('c', {32, 32});
+    exp.assign(4.0f);
+
+    std::vector<NDArray<float>*> results;
+    for (int e = 0; e < 3; e++) {
+        auto space = plan.prepareSpace();
+        ASSERT_EQ(ND4J_STATUS_OK, plan.execute(space));
+
+        auto z = space->getVariable(4)->getNDArray();
+        ASSERT_TRUE(exp.equalsTo(z));
+        results.emplace_back(z);
+
+        plan.releaseSpace(space);
+    }
+
+    ASSERT_NEAR(0.0f, x->reduceNumber<simdOps::Sum<float>>(), 1e-5f);
+
+    // planned runs within the same workspace reuse output arrays
+    ASSERT_TRUE(plan.memoryPlan() != nullptr);
+    ASSERT_TRUE(results[1] == results[2]);
+
+    delete graph;
+}
+
+TEST_F(GraphHolderTests, Test_Footprint_1) {
+    auto graph = new Graph<float>();
+
+    // stored input is tiny, fed inputs are much bigger
+    graph->getVariableSpace()->putVariable(-1, new NDArray<float>('c', {4, 4}));
+
+    std::vector<Node<float>*> nodes({new Node<float>(OpType_SCALAR, 0, 1, {-1}, {2}, {}, 1.0f),
+                                     new Node<float>(OpType_SCALAR, 0, 2, {1}, {3}, {}, 1.0f),
+                                     new Node<float>(OpType_SCALAR, 0, 3, {2}, {}, {}, 1.0f)});
+
+    for (auto node: nodes) {
+        node->markInplace(false);
+        graph->addNode(node);
+    }
+
+    // the same way NativeOps feeds inputs of stored graph
+    auto feed = [] (VariableSpace<float> *space) {
+        auto array = new NDArray<float>('c', {128, 128});
+        array->assign(1.0f);
+
+        auto var = space->getVariable(-1);
+        if (var->hasNDArray() && var->isRemovable())
+            delete var->getNDArray();
+
+        var->setNDArray(array);
+        var->markRemovable(true);
+    };
+
+    Nd4jIndex footprint = 0;
+    {
+        ExecutionPlan<float> plan(graph);
+        auto space = plan.prepareSpace();
+        feed(space);
+
+        ASSERT_EQ(ND4J_STATUS_OK, plan.execute(space));
+
+        auto key = graph->footprintKey(space);
+        plan.releaseSpace(space);
+
+        footprint = nd4j::memory::MemoryRegistrator::getInstance()->getGraphMemoryFootprint(key);
+
+        // footprint is recorded for fed shapes, and stored shapes have none
+        ASSERT_EQ(0L, nd4j::memory::MemoryRegistrator::getInstance()->getGraphMemoryFootprint(graph->footprintKey(graph->getVariableSpace())));
+    }
+
+    // new plan has no pooled workspaces, so workspace is sized with footprint found for fed shapes
+    ExecutionPlan<float> plan(graph);
+    auto space = plan.prepareSpace();
+    feed(space);
+
+    ASSERT_EQ(ND4J_STATUS_OK, plan.execute(space));
+    ASSERT_TRUE(footprint > 0);
+    ASSERT_TRUE(space->workspace()->getCurrentSize() >= footprint);
+
+    // spilled sizes don't include alignment padding, so the last allocation may still spill
+    ASSERT_TRUE(space->workspace()->getUsedSize() > 0);
+    ASSERT_TRUE(space->workspace()->getSpilledSize() < footprint / 2);
+
+    plan.releaseSpace(space);
+
+    delete graph;
+}
+
+TEST_F(GraphHolderTests, Test_FoldBatchNorm_1) {
+    auto graph = new Graph<float>();
+    auto space = graph->getVariableSpace();
+
+    auto x = new NDArray<float>('c', {2, 5, 5, 3});
+    auto w = new NDArray<float>('c', {2, 2, 3, 4});
+    auto mean = new NDArray<float>('c', {4});
+    auto variance = new NDArray<float>('c', {4});
+    auto gamma = new NDArray<float>('c', {4});
+    auto beta = new NDArray<float>('c', {4});
+    auto bias = new NDArray<float>('c', {4});
+
+    NDArrayFactory<float>::linspace(-1.0f, *x, 0.01f);
+    NDArrayFactory<float>::linspace(0.5f, *w, -0.02f);
+    NDArrayFactory<float>::linspace(0.1f, *mean, 0.1f);
+    NDArrayFactory<float>::linspace(0.5f, *variance, 0.25f);
+    NDArrayFactory<float>::linspace(2.0f, *gamma, -0.5f);
+    NDArrayFactory<float>::linspace(-1.0f, *beta, 0.5f);
+    NDArrayFactory<float>::linspace(1.0f, *bias, 1.0f);
+
+    space->putVariable(-1, x);
+    space->putVariable(-2, w);
+    space->putVariable(-3, mean);
+    space->putVariable(-4, variance);
+    space->putVariable(-5, gamma);
+    space->putVariable(-6, beta);
+    space->putVariable(-7, bias);
+
+    // NHWC conv2d -> batchnorm -> biasadd
+    nd4j::ops::conv2d<float> opA;
+    nd4j::ops::batchnorm<float> opB;
+    nd4j::ops::biasadd<float> opC;
+
+    std::initializer_list<int> convArgs = {2, 2, 1, 1, 0, 0, 1, 1, 0, 1};
+
+    auto nodeA = new Node<float>(OpType_CUSTOM, 0, 1, {-1, -2}, {2}, {}, 0.0f, {}, convArgs);
+    auto nodeB = new Node<float>(OpType_CUSTOM, 0, 2, {1, -3, -4, -5, -6}, {3}, {}, 0.0f, {1e-3f}, {1, 1});
+    auto nodeC = new Node<float>(OpType_CUSTOM, 0, 3, {2, -7}, {}, {});
+    nodeA->setCustomOp(&opA);
+    nodeB->setCustomOp(&opB);
+    nodeC->setCustomOp(&opC);
+
+    graph->addNode(nodeA);
+    graph->addNode(nodeB);
+    graph->addNode(nodeC);
+
+    // the same chain, op by op
+    auto resultA = opA.execute({x, w}, {}, convArgs);
+    auto resultB = opB.execute({resultA->at(0), mean, variance, gamma, beta}, {1e-3f}, {1, 1});
+    auto resultC = opC.execute({resultB->at(0), bias}, {}, {});
+    auto exp = resultC->at(0);
+
+    Nd4jIndex graphId = 125;
+    GraphHolder::getInstance()->registerGraph(graphId, graph);
+
+    // whole chain becomes single conv2d with folded weights and bias
+    auto plan = GraphHolder::getInstance()->pullPlan<float>(graphId);
+    ASSERT_TRUE(plan->isCompiled());
+    ASSERT_EQ(1, plan->numberOfFolded());
+    ASSERT_EQ(1, plan->numberOfNodes());
+
+    for (int e = 0; e < 2; e++) {
+        auto runSpace = plan->prepareSpace();
+        ASSERT_EQ(ND4J_STATUS_OK, plan->execute(runSpace));
+
+        ASSERT_TRUE(runSpace->hasVariable(3));
+        auto z = runSpace->getVariable(3)->getNDArray();
+        ASSERT_TRUE(exp->isSameShape(z));
+        ASSERT_TRUE(exp->equalsTo(z, 1e-4));
+
+        plan->releaseSpace(runSpace);
+    }
+
+    // original weights stay untouched
+    ASSERT_EQ(0.5f, w->getScalar(0));
+    ASSERT_EQ(3, graph->totalNodes());
+
+    delete resultA;
+    delete resultB;
+    delete resultC;
+
+    GraphHolder::getInstance()->dropGraph<float>(graphId);
+}
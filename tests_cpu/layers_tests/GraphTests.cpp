@@ -1365,6 +1365,67 @@ TEST_F(GraphTests, Test_Hash_Function_1) {
     delete graph1D;
 }
 
+TEST_F(GraphTests, Test_Hash_Function_2) {
+    auto graph = new Graph<float>();
+
+    auto x = new NDArray<float>('c', {5, 5});
+    x->assign(-2.0);
+
+    graph->getVariableSpace()->putVariable(-1, x);
+
+    graph->addNode(new Node<float>(OpType_TRANSFORM, 0, 1, {-1}, {2}));
+    graph->addNode(new Node<float>(OpType_TRANSFORM, 2, 2, {1}, {3}));
+    graph->addNode(new Node<float>(OpType_TRANSFORM, 0, 3, {2}, {}));
+
+    auto hash = graph->hashCode();
+    ASSERT_NE(0L, hash);
+
+    // node outputs appear in VariableSpace, but structural hash stays the same
+    GraphExecutioner<float>::execute(graph);
+    ASSERT_TRUE(graph->getVariableSpace()->hasVariable(3));
+
+    ASSERT_EQ(hash, graph->hashCode());
+
+    delete graph;
+}
+
+TEST_F(GraphTests, Test_Hash_Function_3) {
+    auto graph = new Graph<float>();
+
+    graph->getVariableSpace()->putVariable(-1, new NDArray<float>('c', {5, 5}));
+    graph->addNode(new Node<float>(OpType_TRANSFORM, 0, 1, {-1}, {2}));
+
+    auto hash = graph->hashCode();
+
+    // once more node is added, that's another graph
+    graph->addNode(new Node<float>(OpType_TRANSFORM, 2, 2, {1}, {}));
+
+    ASSERT_NE(hash, graph->hashCode());
+
+    delete graph;
+}
+
+TEST_F(GraphTests, Test_Footprint_Key_1) {
+    auto graph = new Graph<float>();
+
+    graph->getVariableSpace()->putVariable(-1, new NDArray<float>('c', {33, 5}));
+    graph->addNode(new Node<float>(OpType_TRANSFORM, 0, 1, {-1}, {}));
+
+    VariableSpace<float> spaceA;
+    VariableSpace<float> spaceB;
+    VariableSpace<float> spaceC;
+    spaceA.putVariable(-1, new NDArray<float>('c', {33, 5}));
+    spaceB.putVariable(-1, new NDArray<float>('c', {60, 7}));
+    spaceC.putVariable(-1, new NDArray<float>('c', {100, 5}));
+
+    // 33 and 60 rows both fall into the bucket of 64, 100 rows go to 128
+    ASSERT_EQ(graph->footprintKey(&spaceA), graph->footprintKey(&spaceB));
+    ASSERT_NE(graph->footprintKey(&spaceA), graph->footprintKey(&spaceC));
+    ASSERT_EQ(graph->footprintKey(&spaceA), graph->footprintKey(graph->getVariableSpace()));
+
+    delete graph;
+}
+
 TEST_F(GraphTests, Test_Inplace_Execution_1) {
     NDArray<float> exp('c', {5, 4}, {0.951276f, 0.501379f, 0.501368f, 0.968136f, -0.951359f, 0.499845f, -0.501381f, 0.976955f, -0.000073f, 0.499154f, 0.000098f, 0.972500f, -0.019765f, -0.499479f, -0.005979f, -0.965330f, 0.016531f, -0.500842f, 0.004861f, -0.965910f});
 
@@ -1453,4 +1514,99 @@ TEST_F(GraphTests, Test_Inplace_Outputs_1) {
 
     ASSERT_TRUE(exp.isSameShape(z));
     ASSERT_TRUE(exp.equalsTo(z));
-}
\ No newline at end of file
+}
+
+TEST_F(GraphTests, Test_Parallel_Execution_1) {
+    auto graph = new Graph<float>();
+    graph->getExecutorConfiguration()->_executionMode = ExecutionMode_AUTO;
+
+    auto x0 = new NDArray<float>('c', {5, 5});
+    x0->assign(0.0);
+
+    auto x1 = new NDArray<float>('c', {5, 5});
+    x1->assign(-1.0);
+
+    auto x2 = new NDArray<float>('c', {5, 5});
+    x2->assign(-2.0);
+
+    auto x3 = new NDArray<float>('c', {5, 5});
+    x3->assign(-3.0);
+
+    auto z = new NDArray<float>('c', {5, 5});
+    z->assign(119.0);
+
+    graph->getVariableSpace()->putVariable(-1, x0);
+    graph->getVariableSpace()->putVariable(-2, x1);
+    graph->getVariableSpace()->putVariable(-3, x2);
+    graph->getVariableSpace()->putVariable(-4, x3);
+    graph->getVariableSpace()->putVariable(-5, z);
+
+    auto nodeA = new Node<float>(OpType_TRANSFORM, 0, 1, {-1}, {11});
+    auto nodeB = new Node<float>(OpType_TRANSFORM, 0, 2, {-2}, {11});
+    auto nodeC = new Node<float>(OpType_TRANSFORM, 0, 3, {-3}, {21});
+    auto nodeD = new Node<float>(OpType_TRANSFORM, 0, 4, {-4}, {21});
+
+    auto nodeP1 = new Node<float>(OpType_PAIRWISE, 0, 11, {1, 2}, {31});
+    auto nodeP2 = new Node<float>(OpType_PAIRWISE, 0, 21, {3, 4}, {31});
+
+    auto nodeZ = new Node<float>(OpType_PAIRWISE, 0, 31, {11, 21}, {-5});
+
+    graph->addNode(nodeA);
+    graph->addNode(nodeB);
+    graph->addNode(nodeC);
+    graph->addNode(nodeD);
+    graph->addNode(nodeP1);
+    graph->addNode(nodeP2);
+    graph->addNode(nodeZ);
+
+    graph->buildGraph();
+
+    ASSERT_TRUE(graph->isParallelizable());
+    ASSERT_EQ(4, graph->maxWidth());
+    ASSERT_EQ(7, graph->executionOrder()->size());
+
+    // root nodes have no internal inputs, pairwise nodes have 2 each
+    for (int e = 0; e < graph->executionOrder()->size(); e++) {
+        auto node = graph->executionOrder()->at(e);
+        ASSERT_EQ(node->id() < 10 ? 0 : 2, graph->inDegrees()->at(e));
+    }
+
+    Nd4jStatus status = GraphExecutioner<float>::execute(graph);
+    ASSERT_EQ(ND4J_STATUS_OK, status);
+
+    ASSERT_NEAR(6.0, z->reduceNumber<simdOps::Mean<float>>(), 1e-5);
+
+    delete graph;
+}
+
+TEST_F(GraphTests, Test_Parallel_Execution_2) {
+    auto graph = new Graph<float>();
+    graph->getExecutorConfiguration()->_executionMode = ExecutionMode_AUTO;
+
+    auto x = new NDArray<float>('c', {5, 5});
+    x->assign(-2.0);
+
+    graph->getVariableSpace()->putVariable(-1, x);
+
+    // plain chain has nothing to run concurrently
+    auto nodeA = new Node<float>(OpType_TRANSFORM, 0, 1, {-1}, {2});
+    auto nodeB = new Node<float>(OpType_TRANSFORM, 2, 2, {1}, {3});
+    auto nodeC = new Node<float>(OpType_TRANSFORM, 0, 3, {2}, {});
+
+    graph->addNode(nodeA);
+    graph->addNode(nodeB);
+    graph->addNode(nodeC);
+
+    graph->buildGraph();
+
+    ASSERT_FALSE(graph->isParallelizable());
+    ASSERT_EQ(1, graph->maxWidth());
+
+    GraphExecutioner<float>::execute(graph);
+
+    auto node3 = graph->getVariableSpace()->getVariable(3)->getNDArray();
+
+    ASSERT_NEAR(0.4161468, node3->reduceNumber<simdOps::Mean<float>>(), 1e-5);
+
+    delete graph;
+}
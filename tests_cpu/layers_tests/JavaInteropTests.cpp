@@ -496,6 +496,60 @@ TEST_F(JavaInteropTests, Test_GraphReuse_2) {
 }
 
 
+TEST_F(JavaInteropTests, Test_GraphReuse_3) {
+    NDArray<float> exp0('c', {3}, {3, 3, 3});
+    NDArray<float> exp1('c', {3}, {6, 6, 6});
+
+    NativeOps nativeOps;
+
+    uint8_t* data = nd4j::graph::readFlatBuffers("./resources/reduce_dim.fb");
+
+    nativeOps.registerGraphFloat(nullptr, 119, (Nd4jPointer) data);
+    ASSERT_TRUE(GraphHolder::getInstance()->pullPlan<float>(119)->isCompiled());
+
+    int idx[] = {1};
+
+    NDArray<float> input_0('c', {3, 3});
+    input_0.assign(1.0f);
+
+    NDArray<float> z('c', {3});
+
+    Nd4jPointer inputs_0[] = {(Nd4jPointer) input_0.buffer()};
+    Nd4jPointer shapes_0[] = {(Nd4jPointer) input_0.shapeInfo()};
+    Nd4jPointer outputs[] = {(Nd4jPointer) z.buffer()};
+    Nd4jPointer outputShapes[] = {(Nd4jPointer) z.shapeInfo()};
+
+    // results are written directly into provided buffer
+    auto status = nativeOps.executeStoredGraphFloat(nullptr, 119, inputs_0, shapes_0, idx, 1, outputs, outputShapes, 1);
+    ASSERT_EQ(ND4J_STATUS_OK, status);
+    ASSERT_TRUE(exp0.equalsTo(&z));
+
+    NDArray<float> input_1('c', {3, 3});
+    input_1.assign(2.0f);
+
+    Nd4jPointer inputs_1[] = {(Nd4jPointer) input_1.buffer()};
+    Nd4jPointer shapes_1[] = {(Nd4jPointer) input_1.shapeInfo()};
+
+    status = nativeOps.executeStoredGraphFloat(nullptr, 119, inputs_1, shapes_1, idx, 1, outputs, outputShapes, 1);
+    ASSERT_EQ(ND4J_STATUS_OK, status);
+    ASSERT_TRUE(exp1.equalsTo(&z));
+
+    // wrong output shape is reported
+    NDArray<float> wrong('c', {3, 3});
+    Nd4jPointer wrongOutputs[] = {(Nd4jPointer) wrong.buffer()};
+    Nd4jPointer wrongShapes[] = {(Nd4jPointer) wrong.shapeInfo()};
+
+    status = nativeOps.executeStoredGraphFloat(nullptr, 119, inputs_1, shapes_1, idx, 1, wrongOutputs, wrongShapes, 1);
+    ASSERT_EQ(ND4J_STATUS_BAD_OUTPUT, status);
+
+    nativeOps.unregisterGraph(nullptr, 119);
+
+    ASSERT_FALSE(GraphHolder::getInstance()->hasGraph<float>(119));
+
+    delete[] data;
+}
+
+
 TEST_F(JavaInteropTests, Test_Greater_1) {
     NDArray<float> x('c', {2, 2}, {1, 2, 1, 2});
     NDArray<float> y('c', {2, 2}, {1, 2, 0, 0});
@@ -669,4 +723,48 @@ TEST_F(JavaInteropTests, Test_SimpleIf_Output) {
     char *re = reinterpret_cast<char *>(ptr);
     delete[] pl;
     delete[] re;
-}
\ No newline at end of file
+}
+TEST_F(JavaInteropTests, Test_ThresholdEncoding_1) {
+    // 3000 elements span 3 encoder blocks
+    int length = 3000;
+    float threshold = 0.5f;
+    NDArray<float> x('c', {1, length});
+    NDArray<float> original('c', {1, length});
+    NDArray<float> decoded('c', {1, length});
+
+    for (int e = 0; e < length; e++)
+        x.putScalar(e, e % 3 == 0 ? (e % 2 == 0 ? 0.7f : -0.6f) : 0.1f);
+    original.assign(&x);
+    decoded.assign(0.0f);
+
+    int numBlocks = length / 1024 + 1;
+    std::vector<int> blocks(numBlocks + 1, 0);
+    std::vector<int> offsets(numBlocks, 0);
+
+    NativeOps nativeOps;
+    nativeOps.encodeThresholdP1Float(nullptr, x.buffer(), length, blocks.data(), threshold);
+    ASSERT_EQ(1000, blocks[0]);
+
+    nativeOps.encodeThresholdP2Int(nullptr, blocks.data(), numBlocks, offsets.data());
+    ASSERT_EQ(0, offsets[0]);
+    ASSERT_EQ(blocks[1], offsets[1]);
+    ASSERT_EQ(blocks[1] + blocks[2], offsets[2]);
+
+    std::vector<int> encoded(blocks[0] + 4, 0);
+    encoded[0] = blocks[0];
+    encoded[1] = length;
+    memcpy(&encoded[2], &threshold, sizeof(float));
+
+    nativeOps.encodeThresholdP3Float(nullptr, x.buffer(), offsets.data(), length, encoded.data());
+
+    // indices are 1-based, signed, and follow original element order
+    ASSERT_EQ(1, encoded[4]);
+    ASSERT_EQ(-4, encoded[5]);
+    ASSERT_EQ(-2998, encoded[1003]);
+
+    nativeOps.decodeThresholdFloat(nullptr, encoded.data(), length, decoded.buffer());
+
+    // decoded + residual gives back original values
+    decoded.template applyPairwiseTransform<simdOps::Add<float>>(&x, nullptr);
+    ASSERT_TRUE(original.equalsTo(&decoded));
+}
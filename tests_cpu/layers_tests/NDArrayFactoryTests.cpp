@@ -341,6 +341,84 @@ TEST_F(NDArrayFactoryTests, mmmulHelperAgain) {
 }
 
 
+////////////////////////////////////////////////////////////////////
+TEST_F(NDArrayFactoryTests, mmulHelper_blocked_1) {
+    // sizes aren't multiples of register/cache tiles, so all tails are covered
+    NDArray<double> x('c', {131, 300});  NDArrayFactory<double>::linspace(-1., x, 0.01);
+    NDArray<double> y('f', {300, 37});   NDArrayFactory<double>::linspace(1., y, -0.003);
+    NDArray<double> e('f', {131, 37});
+
+    for (int r = 0; r < 131; r++)
+        for (int c = 0; c < 37; c++) {
+            double sum = 0.;
+            for (int k = 0; k < 300; k++)
+                sum += x(r, k) * y(k, c);
+            e(r, c) = sum;
+        }
+
+    auto z = NDArrayFactory<double>::mmulHelper(&x, &y, nullptr, 1., 0.);
+
+    ASSERT_TRUE(e.isSameShape(z));
+    ASSERT_TRUE(e.equalsTo(z, 1e-8));
+
+    delete z;
+}
+
+////////////////////////////////////////////////////////////////////
+TEST_F(NDArrayFactoryTests, gemm_rowMajor_1) {
+    // C = 2 * A * B^T + C, everything is row-major
+    double a[] = {1., 2., 3., 4., 5., 6.};         // 2 x 3
+    double b[] = {1., 0., 1., 2., 1., 0.};         // 2 x 3
+    double c[] = {1., 1., 1., 1.};                 // 2 x 2
+    double e[] = {9., 9., 21., 27.};
+
+    nd4j::blas::GEMM<double>::op(CblasRowMajor, CblasNoTrans, CblasTrans, 2, 2, 3, 2., a, 3, b, 3, 1., c, 2);
+
+    for (int i = 0; i < 4; i++)
+        ASSERT_NEAR(e[i], c[i], 1e-10);
+}
+
+
+////////////////////////////////////////////////////////////////////
+TEST_F(NDArrayFactoryTests, mmulHelper_half_1) {
+    // 2048 ones summed up in fp16 would stall at 2048, fp32 accumulation keeps it exact
+    NDArray<float16> x('c', {17, 4100});
+    NDArray<float16> y('c', {4100, 9});
+    NDArray<float16> e('f', {17, 9});
+    x.assign(1.0f);
+    y.assign(1.0f);
+    e.assign(4100.0f);
+
+    auto z = NDArrayFactory<float16>::mmulHelper(&x, &y, nullptr, 1., 0.);
+
+    ASSERT_TRUE(e.isSameShape(z));
+    ASSERT_TRUE(e.equalsTo(z));
+
+    delete z;
+}
+
+////////////////////////////////////////////////////////////////////
+TEST_F(NDArrayFactoryTests, mmulHelper_half_2) {
+    NDArray<float16> xC('c', {3, 4});  NDArrayFactory<float16>::linspace(1, xC);
+    NDArray<float16> y('c', {4, 1}, {1.f, 2.f, 3.f, 4.f});
+    NDArray<float16> e('f', {3, 1}, {30.f, 70.f, 110.f});
+
+    auto xF = xC.dup('f');
+
+    // row-major and column-major A go through different GEMV branches
+    auto zC = NDArrayFactory<float16>::mmulHelper(&xC, &y, nullptr, 1., 0.);
+    auto zF = NDArrayFactory<float16>::mmulHelper(xF, &y, nullptr, 1., 0.);
+
+    ASSERT_TRUE(e.isSameShape(zC));
+    ASSERT_TRUE(e.equalsTo(zC));
+    ASSERT_TRUE(e.equalsTo(zF));
+
+    delete xF;
+    delete zC;
+    delete zF;
+}
+
+
 
 ////////////////////////////////////////////////////////////////////
 // TEST_F(NDArrayFactoryTests, mmulHelper_test_9) {
@@ -6,6 +6,7 @@
 #include <memory>
 #include <NDArray.h>
 #include <NDArrayFactory.h>
+#include <helpers/StridedIterator.h>
 
 using namespace nd4j;
 
@@ -2618,3 +2619,79 @@ TEST_F(NDArrayTest, Test_diagonal_18) {
 }
 
 
+
+//////////////////////////////////////////////////////////////////////
+TEST_F(NDArrayTest, Test_StridedIterator_1) {
+    NDArray<float> x('c', {3, 1, 4, 5});
+    NDArrayFactory<float>::linspace(1, x);
+
+    x.permutei({3, 1, 0, 2});
+
+    int coords[MAX_RANK];
+    for (Nd4jIndex start: {0, 7, 59}) {
+        nd4j::StridedIterator iter(x.getShapeInfo(), start);
+
+        for (Nd4jIndex e = start; e < x.lengthOf(); e++) {
+            shape::ind2subC(x.rankOf(), x.shapeOf(), e, coords);
+            ASSERT_EQ(shape::getOffset(0, x.shapeOf(), x.stridesOf(), coords, x.rankOf()), iter.offset());
+
+            iter.next();
+        }
+    }
+
+    // c-ordered view of contiguous buffer collapses into single dimension
+    NDArray<float> y('c', {2, 3, 4});
+    nd4j::StridedIterator yIter(y.getShapeInfo());
+    ASSERT_EQ(1, yIter.rank());
+
+    Nd4jIndex total = 0;
+    for (int t = 0; t < 3; t++) {
+        Nd4jIndex start, end;
+        nd4j::StridedIterator::threadSpan(10, t, 3, start, end);
+        ASSERT_EQ(total, start);
+        total = end;
+    }
+    ASSERT_EQ(10, total);
+}
+
+//////////////////////////////////////////////////////////////////////
+TEST_F(NDArrayTest, Test_StridedIterator_2) {
+    NDArray<double> x('c', {4, 5, 6});
+    NDArrayFactory<double>::linspace(1, x);
+
+    x.permutei({2, 0, 1});
+    auto xDup = x.dup('c');
+
+    NDArray<double> y('c', {6, 4, 5});
+    NDArrayFactory<double>::linspace(1, y);
+
+    NDArray<double> z('c', {6, 4, 5});
+    NDArray<double> exp('c', {6, 4, 5});
+
+    xDup->applyPairwiseTransform<simdOps::Add<double>>(&y, &exp, nullptr);
+    x.applyPairwiseTransform<simdOps::Add<double>>(&y, &z, nullptr);
+
+    ASSERT_TRUE(exp.equalsTo(&z));
+
+    for (int e = 0; e < x.lengthOf(); e++)
+        ASSERT_NEAR(xDup->getScalar(e), x(e), 1e-5);
+
+    auto sumExp = xDup->reduceAlongDimension<simdOps::Sum<double>>({1, 2});
+    auto sum = x.reduceAlongDimension<simdOps::Sum<double>>({1, 2});
+
+    ASSERT_TRUE(sumExp->equalsTo(sum));
+    ASSERT_NEAR(xDup->reduceNumber<simdOps::Sum<double>>(), x.reduceNumber<simdOps::Sum<double>>(), 1e-5);
+
+    NDArray<double> row('c', {1, 4});
+    NDArrayFactory<double>::linspace(1, row);
+
+    x.applyBroadcast<simdOps::Add<double>>({1}, &row);
+    xDup->applyBroadcast<simdOps::Add<double>>({1}, &row);
+
+    for (int e = 0; e < x.lengthOf(); e++)
+        ASSERT_NEAR(xDup->getScalar(e), x(e), 1e-5);
+
+    delete sumExp;
+    delete sum;
+    delete xDup;
+}
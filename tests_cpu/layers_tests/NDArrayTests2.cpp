@@ -6,6 +6,7 @@
 #include <memory>
 #include <NDArray.h>
 #include <NDArrayFactory.h>
+#include <helpers/SimdHelper.h>
 
 using namespace nd4j;
 
@@ -619,4 +620,60 @@ TEST_F(NDArrayTest2, Test_toIndexedString_1) {
     std::string exp = "[1.5, 2.5, 3, 4.5]";
 
     ASSERT_EQ(exp, str);
-}
\ No newline at end of file
+}
+
+//////////////////////////////////////////////////////////////////////
+template <typename T, typename OpType>
+static void checkSimdTransform(NDArray<T> &x, double eps) {
+    NDArray<T> z('c', x.getShapeAsVector());
+    x.template applyTransform<OpType>(&z);
+
+    for (int e = 0; e < x.lengthOf(); e++) {
+        T exp = OpType::op(x.getScalar(e), nullptr);
+        T val = z.getScalar(e);
+
+        if (std::isnan((double) exp)) {
+            ASSERT_TRUE(std::isnan((double) val));
+        } else if (std::isinf((double) exp)) {
+            ASSERT_EQ(exp, val);
+        } else {
+            ASSERT_NEAR((double) exp, (double) val, eps * nd4j::math::nd4j_max<double>(1.0, nd4j::math::nd4j_abs<double>((double) exp)));
+        }
+    }
+}
+
+template <typename T>
+static void checkSimdTransforms(double eps) {
+    auto simd = nd4j::SimdHelper::getInstance();
+    int level = simd->level();
+
+    NDArray<T> x('c', {4, 1000});
+    NDArrayFactory<T>::linspace(-100, x, 0.05);
+    x.putScalar(0, (T) 0.0f);
+    x.putScalar(1, std::numeric_limits<T>::infinity());
+    x.putScalar(2, -std::numeric_limits<T>::infinity());
+    x.putScalar(3, std::numeric_limits<T>::quiet_NaN());
+    // denormals aren't used here: with -funsafe-math-optimizations they're flushed to zero on load, while libm still handles them
+    x.putScalar(4, std::numeric_limits<T>::min());
+
+    for (int l = nd4j::SIMD_GENERIC; l <= simd->detectedLevel(); l++) {
+        simd->setLevel(l);
+
+        checkSimdTransform<T, simdOps::Exp<T>>(x, eps);
+        checkSimdTransform<T, simdOps::Log<T>>(x, eps);
+        checkSimdTransform<T, simdOps::Tanh<T>>(x, eps);
+        checkSimdTransform<T, simdOps::Sigmoid<T>>(x, eps);
+        checkSimdTransform<T, simdOps::SoftPlus<T>>(x, eps);
+    }
+
+    simd->setLevel(level);
+    ASSERT_EQ(level, simd->level());
+}
+
+TEST_F(NDArrayTest2, Test_SimdTransform_1) {
+    checkSimdTransforms<float>(1e-6);
+}
+
+TEST_F(NDArrayTest2, Test_SimdTransform_2) {
+    checkSimdTransforms<double>(1e-14);
+}
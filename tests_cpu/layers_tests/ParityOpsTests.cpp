@@ -652,4 +652,70 @@ TEST_F(ParityOpsTests, Test_Scatter_Add_6) {
 //    ASSERT_TRUE(exp.equalsTo(z));
 
     delete result;
-}
\ No newline at end of file
+}
+
+TEST_F(ParityOpsTests, Test_Scatter_Add_7) {
+    // large table, duplicate indices spread over all rows
+    NDArray<float> matrix('c', {1000, 16});
+    NDArray<float> idc('c', {1, 4000});
+    NDArray<float> updates('c', {4000, 16});
+    NDArray<float> exp('c', {1000, 16});
+
+    NDArrayFactory<float>::linspace(1, matrix);
+    NDArrayFactory<float>::linspace(1, updates, 0.01);
+    for (int e = 0; e < idc.lengthOf(); e++)
+        idc.putIndexedScalar(e, (e * 7) % 1000);
+
+    exp.assign(&matrix);
+    for (int e = 0; e < idc.lengthOf(); e++)
+        for (int i = 0; i < 16; i++)
+            exp((int) idc.getIndexedScalar(e), i) += updates(e, i);
+
+    nd4j::ops::scatter_add<float> op;
+    auto result = op.execute({&matrix, &idc, &updates}, {}, {});
+    ASSERT_EQ(ND4J_STATUS_OK, result->status());
+
+    auto z = result->at(0);
+
+    ASSERT_TRUE(exp.equalsTo(z));
+
+    delete result;
+}
+
+TEST_F(ParityOpsTests, Test_Scatter_Add_8) {
+    NDArray<float> matrix('c', {2, 2}, {1, 2, 3, 4});
+    NDArray<float> idc('c', {1, 1}, {2});
+    NDArray<float> updates('c', {1, 2}, {1, 1});
+    NDArray<float> z('c', {2, 2});
+
+    // index 2 is out of [0, 2) range, so helper's REQUIRE_TRUE throws
+    nd4j::ops::scatter_add<float> op;
+    ASSERT_THROW(op.execute({&matrix, &idc, &updates}, {&z}, {}, {}), std::invalid_argument);
+}
+
+TEST_F(ParityOpsTests, Test_Scatter_Upd_1) {
+    // duplicate indices: last update wins, as in sequential loop
+    NDArray<float> matrix('c', {100, 3, 4});
+    NDArray<float> idc('c', {1, 1000});
+    NDArray<float> updates('c', {1000, 3, 4});
+    NDArray<float> exp('c', {100, 3, 4});
+
+    matrix.assign(0.0f);
+    NDArrayFactory<float>::linspace(1, updates);
+    for (int e = 0; e < idc.lengthOf(); e++)
+        idc.putIndexedScalar(e, e % 50);
+
+    for (int r = 0; r < 100; r++)
+        for (int i = 0; i < 12; i++)
+            exp.putIndexedScalar(r * 12 + i, r < 50 ? updates.getIndexedScalar((950 + r) * 12 + i) : 0.0f);
+
+    nd4j::ops::scatter_upd<float> op;
+    auto result = op.execute({&matrix, &idc, &updates}, {}, {});
+    ASSERT_EQ(ND4J_STATUS_OK, result->status());
+
+    auto z = result->at(0);
+
+    ASSERT_TRUE(exp.equalsTo(z));
+
+    delete result;
+}
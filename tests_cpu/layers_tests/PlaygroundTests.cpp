@@ -5,9 +5,16 @@
 #include "testlayers.h"
 #include <Graph.h>
 #include <chrono>
+#include <random>
 #include <Node.h>
 #include <ops/declarable/CustomOperations.h>
 #include <graph/profiling/GraphProfilingHelper.h>
+#include <ops/declarable/helpers/batched_gemm.h>
+#include <helpers/SimdHelper.h>
+#include <helpers/RandomLauncher.h>
+#include <helpers/RadixSort.h>
+#include <memory/Workspace.h>
+#include <omp.h>
 
 using namespace nd4j;
 using namespace nd4j::graph;
@@ -176,6 +183,173 @@ TEST_F(PlaygroundTests, ReductionTest_1) {
         delete v;
 }
 
+/**
+ * TAD count x TAD length matrix: intra-TAD chunking vs whole TADs per thread.
+ * Huge elementwise threshold effectively disables chunking
+ */
+TEST_F(PlaygroundTests, ReductionTest_2) {
+    auto env = nd4j::Environment::getInstance();
+    int threshold = env->elementwiseThreshold();
+
+    std::vector<int> tads = {2, 4, 8, 16, 64};
+    std::vector<int> lengths = {4096, 65536, 1048576};
+
+    for (auto numTads: tads) {
+        for (auto tadLength: lengths) {
+            if ((Nd4jIndex) numTads * tadLength > 16777216L)
+                continue;
+
+            NDArray<float> x('c', {numTads, tadLength});
+            NDArrayFactory<float>::linspace(1, x);
+            auto z = x.template reduceAlongDimension<simdOps::Sum<float>>({1});
+
+            Nd4jIndex times[2];
+            for (int e = 0; e < 2; e++) {
+                env->setElementwiseThreshold(e == 0 ? threshold : 2147483647);
+
+                auto timeStart = std::chrono::system_clock::now();
+                for (int i = 0; i < numIterations; i++)
+                    x.template reduceAlongDimension<simdOps::Sum<float>>(z, {1});
+                auto timeEnd = std::chrono::system_clock::now();
+
+                times[e] = std::chrono::duration_cast<std::chrono::microseconds> (timeEnd - timeStart).count() / numIterations;
+            }
+
+            nd4j_printf("TADs: %i; TAD length: %i; chunked: %lld us; per TAD: %lld us;\n", numTads, tadLength, times[0], times[1]);
+
+            delete z;
+        }
+    }
+
+    env->setElementwiseThreshold(threshold);
+}
+
+TEST_F(PlaygroundTests, StridedPairwise_1) {
+    NDArray<float> x('c', {64, 128, 128});
+    NDArray<float> y('c', {128, 64, 128});
+    NDArray<float> z('c', {128, 64, 128});
+    NDArrayFactory<float>::linspace(1, x);
+    NDArrayFactory<float>::linspace(1, y);
+
+    auto xPermuted = x.permute({1, 0, 2});
+    auto xContiguous = xPermuted->dup('c');
+
+    // permuted view has no element-wise stride, so it goes through strided iterators
+    std::vector<NDArray<float> *> inputs = {xContiguous, xPermuted};
+    std::vector<const char *> names = {"contiguous", "permuted"};
+    for (int e = 0; e < 2; e++) {
+        auto timeStart = std::chrono::system_clock::now();
+        for (int i = 0; i < numIterations; i++)
+            inputs[e]->template applyPairwiseTransform<simdOps::Add<float>>(&y, &z, nullptr);
+        auto timeEnd = std::chrono::system_clock::now();
+
+        auto time = std::chrono::duration_cast<std::chrono::microseconds> (timeEnd - timeStart).count() / numIterations;
+        nd4j_printf("Pairwise %s: %lld us;\n", names[e], time);
+    }
+
+    delete xPermuted;
+    delete xContiguous;
+}
+
+TEST_F(PlaygroundTests, SimdTransform_1) {
+    auto simd = nd4j::SimdHelper::getInstance();
+    int level = simd->level();
+
+    NDArray<float> x('c', {1024, 1024});
+    NDArray<float> z('c', {1024, 1024});
+    NDArrayFactory<float>::linspace(-10, x, 20.0f / x.lengthOf());
+
+    for (int l = nd4j::SIMD_GENERIC; l <= simd->detectedLevel(); l++) {
+        simd->setLevel(l);
+
+        auto timeStart = std::chrono::system_clock::now();
+        for (int i = 0; i < numIterations; i++)
+            x.template applyTransform<simdOps::Tanh<float>>(&z);
+        auto timeEnd = std::chrono::system_clock::now();
+
+        auto time = std::chrono::duration_cast<std::chrono::microseconds> (timeEnd - timeStart).count() / numIterations;
+        nd4j_printf("Tanh with %s kernels: %lld us;\n", nd4j::SimdHelper::levelName(l), time);
+    }
+
+    simd->setLevel(level);
+}
+
+TEST_F(PlaygroundTests, PoolingBenchmark_1) {
+    // VGG-style 2x2/2 pooling and ResNet stem 3x3/2 pooling with padding, in both data formats
+    std::vector<std::vector<int>> shapes = {{1, 64, 224, 224}, {1, 64, 112, 112}};
+    std::vector<std::vector<int>> args = {{2, 2, 2, 2, 0, 0, 1, 1, 0, 0}, {3, 3, 2, 2, 1, 1, 1, 1, 0, 0}};
+    std::vector<int> outSizes = {112, 56};
+
+    nd4j::ops::maxpool2d<float> op;
+    for (int s = 0; s < (int) shapes.size(); s++) {
+        for (int nhwc = 0; nhwc < 2; nhwc++) {
+            auto &sh = shapes[s];
+            NDArray<float> x('c', nhwc ? std::vector<int>({sh[0], sh[2], sh[3], sh[1]}) : sh);
+            NDArray<float> z('c', nhwc ? std::vector<int>({sh[0], outSizes[s], outSizes[s], sh[1]}) : std::vector<int>({sh[0], sh[1], outSizes[s], outSizes[s]}));
+            NDArrayFactory<float>::linspace(1, x);
+
+            std::vector<NDArray<float>*> inputs = {&x};
+            std::vector<NDArray<float>*> outputs = {&z};
+            std::vector<float> tArgs;
+            std::vector<int> iArgs = args[s];
+            iArgs.emplace_back(nhwc);
+
+            auto timeStart = std::chrono::system_clock::now();
+            for (int i = 0; i < numIterations; i++)
+                op.execute(inputs, outputs, tArgs, iArgs);
+            auto timeEnd = std::chrono::system_clock::now();
+
+            auto time = std::chrono::duration_cast<std::chrono::microseconds> (timeEnd - timeStart).count() / numIterations;
+            nd4j_printf("MaxPool2D %ix%i/%i on [%i, %i, %i, %i] %s: %lld us;\n", args[s][0], args[s][1], args[s][2], sh[0], sh[1], sh[2], sh[3], nhwc ? "NHWC" : "NCHW", time);
+        }
+    }
+}
+
+TEST_F(PlaygroundTests, GatherScatterBenchmark_1) {
+    // embedding-style lookups and updates: table rows x 64 columns, random rows picked
+    std::vector<int> tableSizes = {10000, 100000, 1000000};
+    std::vector<int> indexCounts = {1000, 100000};
+
+    nd4j::ops::gather<float> gather;
+    nd4j::ops::scatter_add<float> scatter;
+    for (auto rows: tableSizes) {
+        NDArray<float> table('c', {rows, 64});
+        table.assign(1.0f);
+
+        for (auto count: indexCounts) {
+            NDArray<float> indices('c', {1, count});
+            NDArray<float> gathered('c', {count, 64});
+            NDArray<float> updates('c', {count, 64});
+            updates.assign(0.1f);
+
+            std::mt19937 rng(119);
+            std::uniform_int_distribution<int> distribution(0, rows - 1);
+            for (int e = 0; e < count; e++)
+                indices.putIndexedScalar(e, (float) distribution(rng));
+
+            std::vector<NDArray<float>*> gatherIn = {&table, &indices};
+            std::vector<NDArray<float>*> gatherOut = {&gathered};
+            std::vector<NDArray<float>*> scatterIn = {&table, &indices, &updates};
+            std::vector<NDArray<float>*> scatterOut = {&table};
+            std::vector<float> tArgs;
+            std::vector<int> iArgs = {0};
+            std::vector<int> noArgs;
+
+            auto timeStart = std::chrono::system_clock::now();
+            for (int i = 0; i < numIterations; i++)
+                gather.execute(gatherIn, gatherOut, tArgs, iArgs);
+            auto timeMid = std::chrono::system_clock::now();
+            for (int i = 0; i < numIterations; i++)
+                scatter.execute(scatterIn, scatterOut, tArgs, noArgs, true);
+            auto timeEnd = std::chrono::system_clock::now();
+
+            auto gatherTime = std::chrono::duration_cast<std::chrono::microseconds> (timeMid - timeStart).count() / numIterations;
+            auto scatterTime = std::chrono::duration_cast<std::chrono::microseconds> (timeEnd - timeMid).count() / numIterations;
+            nd4j_printf("Table [%i, 64], %i indices: gather %lld us; scatter_add %lld us;\n", rows, count, gatherTime, scatterTime);
+        }
+    }
+}
+
 
 TEST_F(PlaygroundTests, ScalarTest_1) {
     std::vector<NDArray<float> *> pool1(poolSize);
@@ -294,6 +468,326 @@ TEST_F(PlaygroundTests, Test_Profile_1) {
 }
 
 
+TEST_F(PlaygroundTests, TopKBenchmark_1) {
+    // batch of wide rows, and single very long row which is split between threads
+    std::vector<std::vector<int>> shapes = {{64, 50000}, {1, 1000000}};
+    std::vector<int> ks = {10, 100};
+
+    nd4j::ops::top_k<float> op;
+    for (int s = 0; s < (int) shapes.size(); s++) {
+        NDArray<float> x('c', shapes[s]);
+        NDArray<float> values('c', {shapes[s][0], ks[s]});
+        NDArray<float> indices('c', {shapes[s][0], ks[s]});
+
+        std::mt19937 rng(119);
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+        for (Nd4jIndex e = 0; e < x.lengthOf(); e++)
+            x.putIndexedScalar(e, distribution(rng));
+
+        std::vector<NDArray<float>*> inputs = {&x};
+        std::vector<NDArray<float>*> outputs = {&values, &indices};
+        std::vector<float> tArgs;
+        std::vector<int> iArgs = {ks[s], 1};
+
+        auto timeStart = std::chrono::system_clock::now();
+        for (int i = 0; i < numIterations; i++)
+            op.execute(inputs, outputs, tArgs, iArgs);
+        auto timeEnd = std::chrono::system_clock::now();
+
+        auto time = std::chrono::duration_cast<std::chrono::microseconds> (timeEnd - timeStart).count() / numIterations;
+        nd4j_printf("TopK k=%i on [%i, %i]: %lld us;\n", ks[s], shapes[s][0], shapes[s][1], time);
+    }
+}
+
+TEST_F(PlaygroundTests, UniqueBenchmark_1) {
+    // time per element should stay flat as length grows, half of values are distinct
+    std::vector<int> lengths = {100000, 1000000, 4000000};
+
+    nd4j::ops::unique_with_counts<float> unique;
+    nd4j::ops::listdiff<float> listdiff;
+    for (auto length: lengths) {
+        NDArray<float> x('c', {1, length});
+        NDArray<float> values('c', {length});
+        NDArray<float> keep('c', {length / 2});
+
+        std::mt19937 rng(119);
+        std::uniform_int_distribution<int> distribution(0, length / 2);
+        for (int e = 0; e < length; e++) {
+            x.putIndexedScalar(e, (float) distribution(rng));
+            values.putIndexedScalar(e, x.getIndexedScalar(e));
+        }
+
+        for (int e = 0; e < length / 2; e++)
+            keep.putIndexedScalar(e, (float) (e * 2));
+
+        auto timeStart = std::chrono::system_clock::now();
+        for (int i = 0; i < numIterations; i++) {
+            auto result = unique.execute({&x}, {}, {});
+            delete result;
+        }
+        auto timeMid = std::chrono::system_clock::now();
+        for (int i = 0; i < numIterations; i++) {
+            auto result = listdiff.execute({&values, &keep}, {}, {});
+            delete result;
+        }
+        auto timeEnd = std::chrono::system_clock::now();
+
+        auto uniqueTime = std::chrono::duration_cast<std::chrono::microseconds> (timeMid - timeStart).count() / numIterations;
+        auto listdiffTime = std::chrono::duration_cast<std::chrono::microseconds> (timeEnd - timeMid).count() / numIterations;
+        nd4j_printf("Length %i: unique_with_counts %lld us (%.2f ns/element); listdiff %lld us;\n", length, uniqueTime, uniqueTime * 1000.0 / length, listdiffTime);
+    }
+}
+
+TEST_F(PlaygroundTests, SegmentBenchmark_1) {
+    // 4M rows x 8 columns: few large segments, and many tiny ones
+    const int numRows = 4000000;
+    const int rowLength = 8;
+    std::vector<int> segmentSizes = {1000000, 4};
+
+    NDArray<float> x('c', {numRows, rowLength});
+    NDArrayFactory<float>::linspace(1, x);
+
+    nd4j::ops::segment_sum<float> sorted;
+    nd4j::ops::unsorted_segment_sum<float> unsorted;
+    for (auto segmentSize: segmentSizes) {
+        const int numSegments = numRows / segmentSize;
+        NDArray<float> sortedIdx('c', {numRows});
+        NDArray<float> unsortedIdx('c', {numRows});
+        NDArray<float> z('c', {numSegments, rowLength});
+
+        std::mt19937 rng(119);
+        std::uniform_int_distribution<int> distribution(0, numSegments - 1);
+        for (int r = 0; r < numRows; r++) {
+            sortedIdx.putIndexedScalar(r, (float) (r / segmentSize));
+            unsortedIdx.putIndexedScalar(r, (float) distribution(rng));
+        }
+
+        std::vector<NDArray<float>*> sortedIn = {&x, &sortedIdx};
+        std::vector<NDArray<float>*> unsortedIn = {&x, &unsortedIdx};
+        std::vector<NDArray<float>*> outputs = {&z};
+        std::vector<float> tArgs;
+        std::vector<int> noArgs;
+        std::vector<int> iArgs = {numSegments};
+
+        auto timeStart = std::chrono::system_clock::now();
+        for (int i = 0; i < numIterations; i++)
+            sorted.execute(sortedIn, outputs, tArgs, noArgs);
+        auto timeMid = std::chrono::system_clock::now();
+        for (int i = 0; i < numIterations; i++)
+            unsorted.execute(unsortedIn, outputs, tArgs, iArgs);
+        auto timeEnd = std::chrono::system_clock::now();
+
+        auto sortedTime = std::chrono::duration_cast<std::chrono::microseconds> (timeMid - timeStart).count() / numIterations;
+        auto unsortedTime = std::chrono::duration_cast<std::chrono::microseconds> (timeEnd - timeMid).count() / numIterations;
+        nd4j_printf("[%i, %i] in %i segments: segment_sum %lld us; unsorted_segment_sum %lld us;\n", numRows, rowLength, numSegments, sortedTime, unsortedTime);
+    }
+}
+
+TEST_F(PlaygroundTests, RandomBenchmark_1) {
+    const int length = 4000000;
+    NativeOps nativeOps;
+
+    // buffer is only kept for compatibility, so it can be way smaller than number of values drawn
+    std::vector<Nd4jIndex> buffer(1024);
+    auto rng = (nd4j::random::RandomBuffer *) nativeOps.initRandom(nullptr, 119, buffer.size(), (Nd4jPointer) buffer.data());
+
+    NDArray<float> x('c', {length});
+
+    auto timeStart = std::chrono::system_clock::now();
+    for (int i = 0; i < numIterations; i++)
+        RandomLauncher<float>::fillUniform(rng, &x, 0.0f, 1.0f);
+    auto timeMid = std::chrono::system_clock::now();
+    for (int i = 0; i < numIterations; i++)
+        RandomLauncher<float>::fillGaussian(rng, &x, 0.0f, 1.0f);
+    auto timeEnd = std::chrono::system_clock::now();
+
+    auto uniformTime = std::chrono::duration_cast<std::chrono::microseconds> (timeMid - timeStart).count() / numIterations;
+    auto gaussianTime = std::chrono::duration_cast<std::chrono::microseconds> (timeEnd - timeMid).count() / numIterations;
+    nd4j_printf("[%i] uniform: %lld us, %.1f Msamples/sec; gaussian: %lld us, %.1f Msamples/sec;\n", length, uniformTime, (double) length / nd4j::math::nd4j_max<double>(1.0, (double) uniformTime), gaussianTime, (double) length / nd4j::math::nd4j_max<double>(1.0, (double) gaussianTime));
+
+    nativeOps.destroyRandom(rng);
+}
+
+TEST_F(PlaygroundTests, SortBenchmark_1) {
+    const int length = 4000000;
+
+    std::vector<float> source(length);
+    std::mt19937 rng(119);
+    std::normal_distribution<float> distribution(0.0f, 1.0f);
+    for (int e = 0; e < length; e++)
+        source[e] = distribution(rng);
+
+    std::vector<float> x(length);
+
+    Nd4jIndex radixTime = 0;
+    Nd4jIndex stdTime = 0;
+    for (int i = 0; i < numIterations; i++) {
+        x = source;
+        auto timeStart = std::chrono::system_clock::now();
+        nd4j::RadixSort::sort(x.data(), length, false);
+        auto timeEnd = std::chrono::system_clock::now();
+        radixTime += std::chrono::duration_cast<std::chrono::microseconds> (timeEnd - timeStart).count();
+
+        x = source;
+        timeStart = std::chrono::system_clock::now();
+        std::sort(x.begin(), x.end());
+        timeEnd = std::chrono::system_clock::now();
+        stdTime += std::chrono::duration_cast<std::chrono::microseconds> (timeEnd - timeStart).count();
+    }
+
+    nd4j_printf("[%i] radix sort: %lld us; std::sort: %lld us;\n", length, radixTime / numIterations, stdTime / numIterations);
+}
+
+TEST_F(PlaygroundTests, GemmBenchmark_1) {
+    // square, skinny and tall-skinny shapes, M x N x K
+    std::vector<std::vector<int>> shapes = {{256, 256, 256}, {1024, 1024, 1024}, {16, 4096, 1024}, {4096, 16, 1024}, {4096, 4096, 16}};
+
+    for (auto &s: shapes) {
+        NDArray<float> a('f', {s[0], s[2]});
+        NDArray<float> b('f', {s[2], s[1]});
+        NDArray<float> c('f', {s[0], s[1]});
+        a.assign(0.1f);
+        b.assign(0.2f);
+
+        // warm up
+        nd4j::blas::GEMM<float>::op(CblasColMajor, CblasNoTrans, CblasNoTrans, s[0], s[1], s[2], 1.0f, a.buffer(), s[0], b.buffer(), s[2], 0.0f, c.buffer(), s[0]);
+
+        auto timeStart = std::chrono::system_clock::now();
+        for (int e = 0; e < numIterations; e++)
+            nd4j::blas::GEMM<float>::op(CblasColMajor, CblasNoTrans, CblasNoTrans, s[0], s[1], s[2], 1.0f, a.buffer(), s[0], b.buffer(), s[2], 0.0f, c.buffer(), s[0]);
+        auto timeEnd = std::chrono::system_clock::now();
+
+        auto outerTime = std::chrono::duration_cast<std::chrono::microseconds> (timeEnd - timeStart).count() / numIterations;
+        double gflops = 2.0 * s[0] * s[1] * s[2] / (outerTime * 1000.0);
+
+        nd4j_printf("GEMM [%i x %i x %i]: %lld us; %.2f GFLOPS\n", s[0], s[1], s[2], outerTime, gflops);
+    }
+}
+
+
+TEST_F(PlaygroundTests, GemmBenchmark_Half_1) {
+    std::vector<std::vector<int>> shapes = {{256, 256, 256}, {1024, 1024, 1024}, {16, 4096, 1024}};
+
+    for (auto &s: shapes) {
+        NDArray<float16> a('f', {s[0], s[2]});
+        NDArray<float16> b('f', {s[2], s[1]});
+        NDArray<float16> c('f', {s[0], s[1]});
+        a.assign(0.1f);
+        b.assign(0.2f);
+
+        auto timeStart = std::chrono::system_clock::now();
+        for (int e = 0; e < numIterations; e++)
+            NDArrayFactory<float16>::mmulHelper(&a, &b, &c, 1.0, 0.0);
+        auto timeEnd = std::chrono::system_clock::now();
+
+        auto outerTime = std::chrono::duration_cast<std::chrono::microseconds> (timeEnd - timeStart).count() / numIterations;
+        double gflops = 2.0 * s[0] * s[1] * s[2] / (outerTime * 1000.0);
+
+        nd4j_printf("HGEMM [%i x %i x %i]: %lld us; %.2f GFLOPS\n", s[0], s[1], s[2], outerTime, gflops);
+    }
+}
+
+
+TEST_F(PlaygroundTests, GemmBenchmark_2) {
+    // batched small matrices, as in attention heads
+    int batch = 64;
+    int M = 64, N = 64, K = 64;
+    std::vector<NDArray<float>*> vA(batch), vB(batch), vC(batch);
+    for (int e = 0; e < batch; e++) {
+        vA[e] = new NDArray<float>('f', {M, K});
+        vB[e] = new NDArray<float>('f', {K, N});
+        vC[e] = new NDArray<float>('f', {M, N});
+        vA[e]->assign(0.1f);
+        vB[e]->assign(0.2f);
+    }
+
+    NDArray<float> alphas('c', {1, batch});
+    NDArray<float> betas('c', {1, batch});
+    alphas.assign(1.0f);
+    betas.assign(0.0f);
+
+    auto timeStart = std::chrono::system_clock::now();
+    for (int e = 0; e < numIterations; e++)
+        nd4j::ops::helpers::_bgemm<float>(vA, vB, vC, &alphas, &betas, CblasNoTrans, CblasNoTrans, M, N, K, M, K, M);
+    auto timeEnd = std::chrono::system_clock::now();
+
+    auto outerTime = std::chrono::duration_cast<std::chrono::microseconds> (timeEnd - timeStart).count() / numIterations;
+    double gflops = 2.0 * batch * M * N * K / (outerTime * 1000.0);
+
+    nd4j_printf("Batched GEMM [%i x %i x %i x %i]: %lld us; %.2f GFLOPS\n", batch, M, N, K, outerTime, gflops);
+
+    for (int e = 0; e < batch; e++) {
+        delete vA[e];
+        delete vB[e];
+        delete vC[e];
+    }
+}
+
+
+TEST_F(PlaygroundTests, ThresholdEncodingBenchmark_1) {
+    Nd4jIndex length = 100000000;
+    float threshold = 1e-3f;
+    NDArray<float> x('c', {1, (int) length});
+    NDArray<float> decoded('c', {1, (int) length});
+    NDArrayFactory<float>::linspace(-1.0f, x, 2e-8f);
+
+    Nd4jIndex numBlocks = length / 1024 + (length % 1024 ? 1 : 0);
+    std::vector<int> blocks(numBlocks + 1, 0);
+    std::vector<int> offsets(numBlocks, 0);
+
+    NativeOps nativeOps;
+
+    auto timeStart = std::chrono::system_clock::now();
+    nativeOps.encodeThresholdP1Float(nullptr, x.buffer(), length, blocks.data(), threshold);
+    nativeOps.encodeThresholdP2Int(nullptr, blocks.data(), numBlocks, offsets.data());
+
+    std::vector<int> encoded(blocks[0] + 4, 0);
+    encoded[0] = blocks[0];
+    encoded[1] = (int) length;
+    memcpy(&encoded[2], &threshold, sizeof(float));
+
+    nativeOps.encodeThresholdP3Float(nullptr, x.buffer(), offsets.data(), length, encoded.data());
+    auto timeEncoded = std::chrono::system_clock::now();
+
+    nativeOps.decodeThresholdFloat(nullptr, encoded.data(), length, decoded.buffer());
+    auto timeDecoded = std::chrono::system_clock::now();
+
+    auto encTime = std::chrono::duration_cast<std::chrono::microseconds> (timeEncoded - timeStart).count();
+    auto decTime = std::chrono::duration_cast<std::chrono::microseconds> (timeDecoded - timeEncoded).count();
+
+    // encoder reads gradients twice, decoder touches encoded elements only
+    double encGBs = (double) length * sizeof(float) / (encTime * 1000.0);
+    double decGBs = (double) blocks[0] * (sizeof(int) + sizeof(float)) / (decTime * 1000.0);
+
+    nd4j_printf("Threshold encoding of %lld elements: %lld us, %.2f GB/s; decoding of %i elements: %lld us, %.2f GB/s\n", length, encTime, encGBs, blocks[0], decTime, decGBs);
+}
+
+TEST_F(PlaygroundTests, WorkspaceBenchmark_1) {
+    const int numAllocations = 10000;
+
+    nd4j::memory::Workspace ws(64 * 1024 * 1024);
+
+    auto timeStart = std::chrono::system_clock::now();
+
+    for (int i = 0; i < numIterations; i++) {
+        ws.scopeIn();
+
+#pragma omp parallel
+        {
+            for (int e = 0; e < numAllocations; e++)
+                ws.allocateBytes(64 + (e % 8) * 32);
+        }
+
+        ws.scopeOut();
+    }
+
+    auto timeEnd = std::chrono::system_clock::now();
+    auto outerTime = std::chrono::duration_cast<std::chrono::microseconds>(timeEnd - timeStart).count();
+
+    nd4j_printf("%i threads, %i allocations per thread: %lld us per iteration\n", omp_get_max_threads(), numAllocations, outerTime / numIterations);
+}
+
+
 TEST_F(PlaygroundTests, Test_Profile_2) {
     Environment::getInstance()->setProfiling(true);
     auto graph = GraphExecutioner<float>::importFromFlatBuffers("./resources/ae_00.fb");
@@ -438,4 +438,97 @@ TEST_F(RNGTests, Test_ExponentialDistribution_2) {
     ASSERT_FALSE(nexp2->equalsTo(z));
 
     delete result;
-}
\ No newline at end of file
+}
+
+TEST_F(RNGTests, Test_Philox_1) {
+    // known-answer vectors from Random123 distribution
+    uint32_t c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+    nd4j::random::Philox::bijection(c0, c1, c2, c3, 0ULL);
+
+    ASSERT_EQ(0x6627e8d5U, c0);
+    ASSERT_EQ(0xe169c58dU, c1);
+    ASSERT_EQ(0xbc57ac4cU, c2);
+    ASSERT_EQ(0x9b00dbd8U, c3);
+
+    c0 = 0x243f6a88U; c1 = 0x85a308d3U; c2 = 0x13198a2eU; c3 = 0x03707344U;
+    nd4j::random::Philox::bijection(c0, c1, c2, c3, (0x299f31d0ULL << 32) | 0xa4093822ULL);
+
+    ASSERT_EQ(0xd16cfe09U, c0);
+    ASSERT_EQ(0x94fdccebU, c1);
+    ASSERT_EQ(0x5001e420U, c2);
+    ASSERT_EQ(0x24126ea1U, c3);
+}
+
+TEST_F(RNGTests, Test_Uniform_3) {
+    // stream doesn't wrap around after buffer length, so values drawn past it are new ones
+    NDArray<float> x0('c', {1000});
+    NDArray<float> skip('c', {100000 - 1000});
+    NDArray<float> x1('c', {1000});
+
+    RandomLauncher<float>::fillUniform(_rngA, &x0, 0.0f, 1.0f);
+    RandomLauncher<float>::fillUniform(_rngA, &skip, 0.0f, 1.0f);
+    RandomLauncher<float>::fillUniform(_rngA, &x1, 0.0f, 1.0f);
+
+    int matches = 0;
+    for (int e = 0; e < 1000; e++) {
+        ASSERT_TRUE(x1.getScalar(e) >= 0.0f && x1.getScalar(e) < 1.0f);
+
+        if (x0.getScalar(e) == x1.getScalar(e))
+            matches++;
+    }
+
+    ASSERT_GT(10, matches);
+}
+
+TEST_F(RNGTests, Test_Threads_1) {
+    // the same seed should give the same values, no matter how many threads were used
+    NDArray<float> g0('c', {20001});
+    NDArray<float> g1('c', {20001});
+    NDArray<float> t0('c', {20001});
+    NDArray<float> t1('c', {20001});
+    NDArray<float> b0('c', {20001});
+    NDArray<float> b1('c', {20001});
+
+    auto threads = omp_get_max_threads();
+    auto threshold = nd4j::Environment::getInstance()->elementwiseThreshold();
+
+    omp_set_num_threads(1);
+    RandomLauncher<float>::fillGaussian(_rngA, &g0, 1.0f, 2.0f);
+    RandomLauncher<float>::fillTruncatedNormal(_rngA, &t0, 1.0f, 2.0f);
+    RandomLauncher<float>::fillBinomial(_rngA, &b0, 5, 0.3f);
+
+    omp_set_num_threads(4);
+    nd4j::Environment::getInstance()->setElementwiseThreshold(1024);
+    RandomLauncher<float>::fillGaussian(_rngB, &g1, 1.0f, 2.0f);
+    RandomLauncher<float>::fillTruncatedNormal(_rngB, &t1, 1.0f, 2.0f);
+    RandomLauncher<float>::fillBinomial(_rngB, &b1, 5, 0.3f);
+
+    omp_set_num_threads(threads);
+    nd4j::Environment::getInstance()->setElementwiseThreshold(threshold);
+
+    for (int e = 0; e < g0.lengthOf(); e++) {
+        ASSERT_EQ(g0.getScalar(e), g1.getScalar(e));
+        ASSERT_EQ(t0.getScalar(e), t1.getScalar(e));
+        ASSERT_EQ(b0.getScalar(e), b1.getScalar(e));
+    }
+}
+
+TEST_F(RNGTests, Test_Binomial_3) {
+    NDArray<double> x('c', {20000});
+
+    RandomLauncher<double>::fillBinomial(_rngA, &x, 10, 0.3);
+
+    double mean = 0.0;
+    for (int e = 0; e < x.lengthOf(); e++)
+        mean += x.getScalar(e);
+    mean /= x.lengthOf();
+
+    double variance = 0.0;
+    for (int e = 0; e < x.lengthOf(); e++)
+        variance += (x.getScalar(e) - mean) * (x.getScalar(e) - mean);
+    variance /= x.lengthOf();
+
+    // n * p and n * p * (1 - p)
+    ASSERT_NEAR(3.0, mean, 0.05);
+    ASSERT_NEAR(2.1, variance, 0.1);
+}
@@ -2,6 +2,7 @@
 // Created by agibsonccc on 1/15/17.
 //
 #include <helpers/ShapeUtils.h>
+#include <NDArrayFactory.h>
 #include "testinclude.h"
 
 class ReduceTest : public testing::Test {
@@ -133,4 +134,54 @@ TEST_F(ReduceTest,MatrixTest) {
     delete[] resultShapeInfo;
     delete tad;
     delete[] xShapeInfo;
-}
\ No newline at end of file
+}
+TEST_F(ReduceTest, ChunkedTad_1) {
+    nd4j::NDArray<float> array('c', {2, 50000});
+    nd4j::NDArrayFactory<float>::linspace(1, array);
+    array.putScalar(1, 31337, 1e7f);
+
+    // TADs along {0, 2} have no element wise stride, so they're iterated by coordinates
+    nd4j::NDArray<float> strided('c', {100, 2, 500});
+    nd4j::NDArrayFactory<float>::linspace(1, strided);
+    strided.putScalar(50, 1, 123, 1e7f);
+
+    auto threads = omp_get_max_threads();
+    auto threshold = nd4j::Environment::getInstance()->elementwiseThreshold();
+
+    // less TADs than threads, so each TAD is split into chunks
+    omp_set_num_threads(4);
+    nd4j::Environment::getInstance()->setElementwiseThreshold(1024);
+
+    auto sum = array.template reduceAlongDimension<simdOps::Sum<float>>({1});
+    auto max = array.template applyIndexReduce<simdOps::IndexMax<float>>({1});
+    auto sumS = strided.template reduceAlongDimension<simdOps::Sum<float>>({0, 2});
+    auto maxS = strided.template applyIndexReduce<simdOps::IndexMax<float>>({0, 2});
+
+    omp_set_num_threads(threads);
+    nd4j::Environment::getInstance()->setElementwiseThreshold(threshold);
+
+    double exp0 = 50000.0 * 50001.0 / 2.0;
+    double exp1 = exp0 + 50000.0 * 50000.0 - (50000.0 + 31338.0) + 1e7;
+
+    ASSERT_NEAR(exp0, sum->getScalar(0), exp0 * 1e-4);
+    ASSERT_NEAR(exp1, sum->getScalar(1), exp1 * 1e-4);
+    ASSERT_NEAR(49999.f, max->getScalar(0), 1e-5f);
+    ASSERT_NEAR(31337.f, max->getScalar(1), 1e-5f);
+
+    for (int j = 0; j < 2; j++) {
+        double exp = 0.0;
+        for (int i = 0; i < 100; i++)
+            for (int k = 0; k < 500; k++)
+                exp += strided.getScalar(i, j, k);
+
+        ASSERT_NEAR(exp, sumS->getScalar(j), exp * 1e-4);
+    }
+
+    ASSERT_NEAR(49999.f, maxS->getScalar(0), 1e-5f);
+    ASSERT_NEAR(25123.f, maxS->getScalar(1), 1e-5f);
+
+    delete sum;
+    delete max;
+    delete sumS;
+    delete maxS;
+}
@@ -0,0 +1,162 @@
+//
+//  @author raver119@gmail.com
+//
+
+#include "testlayers.h"
+#include <NDArray.h>
+#include <NDArrayFactory.h>
+#include <NativeOps.h>
+#include <NativeOpExcutioner.h>
+#include <helpers/RadixSort.h>
+#include <algorithm>
+#include <random>
+#include <limits>
+
+using namespace nd4j;
+
+class SortCpuTests : public testing::Test {
+public:
+
+};
+
+TEST_F(SortCpuTests, Test_Sort_1) {
+    NDArray<float> x({4.f, -1.f, 0.f, -0.f, 1e30f, -1e30f, std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), 3.f, -2.5f});
+    std::vector<float> exp(x.getBuffer(), x.getBuffer() + x.lengthOf());
+    std::sort(exp.begin(), exp.end());
+
+    NativeOps nativeOps;
+    nativeOps.sortFloat(nullptr, x.getBuffer(), x.getShapeInfo(), false);
+
+    for (int e = 0; e < x.lengthOf(); e++)
+        ASSERT_EQ(exp[e], x.getScalar(e));
+
+    nativeOps.sortFloat(nullptr, x.getBuffer(), x.getShapeInfo(), true);
+
+    for (int e = 0; e < x.lengthOf(); e++)
+        ASSERT_EQ(exp[x.lengthOf() - 1 - e], x.getScalar(e));
+}
+
+TEST_F(SortCpuTests, Test_Sort_2) {
+    // long enough for parallel radix passes
+    const int length = 50000;
+    NDArray<double> x('c', {length});
+
+    std::mt19937 rng(119);
+    std::normal_distribution<double> distribution(0.0, 1000.0);
+    for (int e = 0; e < length; e++)
+        x.putScalar(e, distribution(rng));
+
+    std::vector<double> exp(x.getBuffer(), x.getBuffer() + length);
+    std::sort(exp.begin(), exp.end());
+
+    auto threads = omp_get_max_threads();
+    omp_set_num_threads(4);
+
+    NativeOps nativeOps;
+    nativeOps.sortDouble(nullptr, x.getBuffer(), x.getShapeInfo(), false);
+
+    omp_set_num_threads(threads);
+
+    for (int e = 0; e < length; e++)
+        ASSERT_EQ(exp[e], x.getScalar(e));
+}
+
+TEST_F(SortCpuTests, Test_Sort_3) {
+    NDArray<float16> x('c', {1000});
+
+    std::mt19937 rng(119);
+    std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+    for (int e = 0; e < x.lengthOf(); e++)
+        x.putScalar(e, (float16) distribution(rng));
+
+    NativeOps nativeOps;
+    nativeOps.sortHalf(nullptr, x.getBuffer(), x.getShapeInfo(), true);
+
+    for (int e = 1; e < x.lengthOf(); e++)
+        ASSERT_TRUE((float) x.getScalar(e - 1) >= (float) x.getScalar(e));
+}
+
+TEST_F(SortCpuTests, Test_SortTad_1) {
+    // every column gets sorted, so TADs are strided
+    NDArray<float> x('c', {5, 3}, {5.f, 1.f, 9.f,   2.f, 8.f, -1.f,   4.f, 3.f, 7.f,   1.f, 0.f, 6.f,   3.f, 2.f, 5.f});
+    NDArray<float> exp('c', {5, 3}, {1.f, 0.f, -1.f,   2.f, 1.f, 5.f,   3.f, 2.f, 6.f,   4.f, 3.f, 7.f,   5.f, 8.f, 9.f});
+
+    int dimension = 0;
+    shape::TAD tad(x.getShapeInfo(), &dimension, 1);
+    tad.createTadOnlyShapeInfo();
+    tad.createOffsets();
+
+    NativeOps nativeOps;
+    nativeOps.sortTadFloat(nullptr, x.getBuffer(), x.getShapeInfo(), &dimension, 1, tad.tadOnlyShapeInfo, tad.tadOffsets, false);
+
+    ASSERT_TRUE(exp.equalsTo(&x));
+}
+
+TEST_F(SortCpuTests, Test_SortByKey_1) {
+    NDArray<float> x({3.f, 1.f, 2.f, 1.f, 3.f, 0.f});
+    NDArray<float> y({0.f, 1.f, 2.f, 3.f, 4.f, 5.f});
+
+    // ties keep their original order in both directions
+    NativeOpExcutioner<float>::execSortByKey(x.getBuffer(), x.getShapeInfo(), y.getBuffer(), y.getShapeInfo(), true);
+
+    NDArray<float> expX({3.f, 3.f, 2.f, 1.f, 1.f, 0.f});
+    NDArray<float> expY({0.f, 4.f, 2.f, 1.f, 3.f, 5.f});
+
+    ASSERT_TRUE(expX.equalsTo(&x));
+    ASSERT_TRUE(expY.equalsTo(&y));
+}
+
+TEST_F(SortCpuTests, Test_Argsort_1) {
+    const int length = 20000;
+    NDArray<float> x('c', {length});
+
+    // lots of duplicates, so stability is checked as well
+    std::mt19937 rng(119);
+    std::uniform_int_distribution<int> distribution(-50, 50);
+    for (int e = 0; e < length; e++)
+        x.putScalar(e, (float) distribution(rng));
+
+    std::vector<Nd4jIndex> exp(length);
+    for (int e = 0; e < length; e++)
+        exp[e] = e;
+
+    float *buffer = x.getBuffer();
+    std::stable_sort(exp.begin(), exp.end(), [buffer](Nd4jIndex a, Nd4jIndex b) { return buffer[a] < buffer[b]; });
+
+    std::vector<Nd4jIndex> z(length);
+    NativeOpExcutioner<float>::execArgsort(x.getBuffer(), x.getShapeInfo(), z.data(), false);
+
+    for (int e = 0; e < length; e++)
+        ASSERT_EQ(exp[e], z[e]);
+}
+
+TEST_F(SortCpuTests, Test_SortCoo_1) {
+    const int length = 3000;
+    const int rank = 3;
+    std::vector<int> indices(length * rank);
+    std::vector<double> values(length);
+
+    // distinct index tuples, shuffled
+    std::mt19937 rng(119);
+    std::vector<int> order(length);
+    for (int e = 0; e < length; e++)
+        order[e] = e;
+    std::shuffle(order.begin(), order.end(), rng);
+
+    for (int e = 0; e < length; e++) {
+        indices[e * rank] = order[e] / 300;
+        indices[e * rank + 1] = (order[e] / 10) % 30;
+        indices[e * rank + 2] = (order[e] % 10) * 1000;
+        values[e] = (double) order[e];
+    }
+
+    NativeOps nativeOps;
+    nativeOps.sortCooIndicesDouble(nullptr, indices.data(), values.data(), length, rank);
+
+    for (int e = 0; e < length; e++) {
+        ASSERT_EQ(e / 300, indices[e * rank]);
+        ASSERT_EQ((e / 10) % 30, indices[e * rank + 1]);
+        ASSERT_EQ((e % 10) * 1000, indices[e * rank + 2]);
+        ASSERT_EQ((double) e, values[e]);
+    }
+}
@@ -8,6 +8,8 @@
 #include "testlayers.h"
 #include <NDArray.h>
 #include <NDArrayFactory.h>
+#include <helpers/TadCache.h>
+#include <Environment.h>
 
 using namespace nd4j;
 
@@ -128,6 +130,65 @@ TEST_F(TadTests, TadEdgeCase_2) {
     delete tad;
 }
 
+TEST_F(TadTests, TadCache_1) {
+    NDArray<float> array('c', {7, 11, 13});
+    std::vector<int> dims = {1, 2};
+
+    auto cache = nd4j::TadCache::getInstance();
+    auto env = nd4j::Environment::getInstance();
+    cache->purge();
+    env->resetTadCacheCounters();
+
+    auto first = cache->tadForDimensions(array.getShapeInfo(), dims.data(), (int) dims.size());
+    auto second = cache->tadForDimensions(array.getShapeInfo(), dims.data(), (int) dims.size());
+
+    ASSERT_EQ(1, env->tadCacheMisses());
+    ASSERT_EQ(1, env->tadCacheHits());
+    ASSERT_TRUE(first.get() == second.get());
+    ASSERT_EQ(7, first->numberOfTads());
+    ASSERT_EQ(143, first->primaryOffsets()[1]);
+
+    shape::TAD tad(array.getShapeInfo(), dims.data(), (int) dims.size());
+    tad.createTadOnlyShapeInfo();
+    tad.createOffsets();
+
+    ASSERT_TRUE(shape::equalsStrict(tad.tadOnlyShapeInfo, first->primaryShapeInfo()));
+    for (int e = 0; e < tad.numTads; e++)
+        ASSERT_EQ(tad.tadOffsets[e], first->primaryOffsets()[e]);
+
+    // same shape, different dimensions - is different entry
+    cache->tadForDimensions(array.getShapeInfo(), 0);
+    ASSERT_EQ(2, env->tadCacheMisses());
+    ASSERT_EQ(2, cache->size());
+}
+
+TEST_F(TadTests, TadCache_2) {
+    NDArray<float> array('c', {16, 32});
+
+    auto cache = nd4j::TadCache::getInstance();
+    auto limit = cache->maxBytes();
+    cache->purge();
+
+    auto pack = cache->tadForDimensions(array.getShapeInfo(), 1);
+    auto footprint = pack->memoryFootprint();
+
+    // room for exactly one pack: previous one gets evicted, but stays valid for its holder
+    cache->setMaxBytes(footprint);
+    auto other = cache->tadForDimensions(array.getShapeInfo(), 0);
+
+    ASSERT_EQ(1, cache->size());
+    ASSERT_EQ(16, pack->numberOfTads());
+    ASSERT_EQ(32, pack->primaryOffsets()[1]);
+    ASSERT_EQ(32, other->numberOfTads());
+
+    cache->purge();
+    ASSERT_EQ(0, cache->size());
+    ASSERT_EQ(0L, cache->currentBytes());
+    ASSERT_EQ(1, other->primaryOffsets()[1]);
+
+    cache->setMaxBytes(limit);
+}
+
 /*
  // FIXME: we want this test passing eventually
 TEST_F(TadTests, Tad_1D_1) {
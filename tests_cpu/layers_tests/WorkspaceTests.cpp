@@ -10,12 +10,23 @@
 #include <Workspace.h>
 #include <MemoryRegistrator.h>
 #include <NDArrayFactory.h>
+#include <omp.h>
 
 using namespace nd4j;
 using namespace nd4j::memory;
 
 class WorkspaceTests : public testing::Test {
+public:
+    bool mmap;
 
+    void SetUp() override {
+        mmap = Environment::getInstance()->isWorkspaceMmap();
+    }
+
+    // global flag is restored even if test fails halfway
+    void TearDown() override {
+        Environment::getInstance()->setWorkspaceMmap(mmap);
+    }
 };
 
 
@@ -156,6 +167,21 @@ TEST_F(WorkspaceTests, NewInWorkspaceTest2) {
     MemoryRegistrator::getInstance()->forgetWorkspace();
 }
 
+TEST_F(WorkspaceTests, Test_Graph_Footprint_1) {
+    // keys are far from real graph hashes
+    for (Nd4jIndex e = 0; e < 64; e++) {
+        MemoryRegistrator::getInstance()->setGraphMemoryFootprintIfGreater(-119000L - e, 1000L + e);
+        MemoryRegistrator::getInstance()->setGraphMemoryFootprintIfGreater(-119000L - e, 10L);
+    }
+
+    for (Nd4jIndex e = 0; e < 64; e++)
+        ASSERT_EQ(1000L + e, MemoryRegistrator::getInstance()->getGraphMemoryFootprint(-119000L - e));
+
+    MemoryRegistrator::getInstance()->setGraphMemoryFootprint(-119000L, 10L);
+    ASSERT_EQ(10L, MemoryRegistrator::getInstance()->getGraphMemoryFootprint(-119000L));
+    ASSERT_EQ(0L, MemoryRegistrator::getInstance()->getGraphMemoryFootprint(-118999L));
+}
+
 TEST_F(WorkspaceTests, CloneTest1) {
     Workspace ws(65536);
 
@@ -219,7 +245,9 @@ TEST_F(WorkspaceTests, Test_Externalized_1) {
     NDArray<float> x('c', {10, 10}, &ws);
 
     ASSERT_EQ(32 + 400, ws.getUsedSize());
-    ASSERT_EQ(32 + 400, ws.getCurrentOffset());
+
+    // offset also includes alignment padding
+    ASSERT_TRUE(ws.getCurrentOffset() >= 32 + 400);
 
     x.assign(2.0);
 
@@ -227,5 +255,138 @@ TEST_F(WorkspaceTests, Test_Externalized_1) {
     ASSERT_NEAR(2.0f, m, 1e-5);
 }
 
+TEST_F(WorkspaceTests, Test_Alignment_1) {
+    Workspace ws(65536);
+
+    ASSERT_EQ(WORKSPACE_ALIGNMENT, ws.getAlignment());
+
+    for (int e = 1; e < 200; e += 7) {
+        auto ptr = ws.allocateBytes(e);
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(ptr) % WORKSPACE_ALIGNMENT);
+    }
+
+    // spills are aligned as well
+    auto ptr = ws.allocateBytes(65536 * 2);
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(ptr) % WORKSPACE_ALIGNMENT);
+    ASSERT_EQ(65536 * 2, ws.getSpilledSize());
+}
+
+TEST_F(WorkspaceTests, Test_MultiThreaded_1) {
+    const int numAllocations = 2000;
+    const int numBytes = 200;
+    const int maxThreads = 16;
+
+    Workspace ws(4 * 1024 * 1024);
+
+    std::vector<unsigned char*> pointers(maxThreads * numAllocations, nullptr);
+
+#pragma omp parallel num_threads(maxThreads)
+    {
+        auto t = omp_get_thread_num();
+        for (int e = 0; e < numAllocations; e++) {
+            auto ptr = reinterpret_cast<unsigned char*>(ws.allocateBytes(numBytes));
+            memset(ptr, t + 1, numBytes);
+            pointers[t * numAllocations + e] = ptr;
+        }
+    }
+
+    int numThreads = 0;
+    for (int t = 0; t < maxThreads; t++) {
+        if (pointers[t * numAllocations] == nullptr)
+            continue;
+
+        numThreads++;
+        for (int e = 0; e < numAllocations; e++) {
+            auto ptr = pointers[t * numAllocations + e];
+            ASSERT_EQ(0, reinterpret_cast<uintptr_t>(ptr) % WORKSPACE_ALIGNMENT);
+
+            // no other thread has overwritten this block
+            for (int i = 0; i < numBytes; i++)
+                ASSERT_EQ(t + 1, ptr[i]);
+        }
+    }
+
+    ASSERT_EQ((Nd4jIndex) numThreads * numAllocations * numBytes, ws.getUsedSize() + ws.getSpilledSize());
+
+    ws.scopeOut();
+    ASSERT_EQ(0, ws.getUsedSize());
+    ASSERT_EQ(0, ws.getCurrentOffset());
+}
+
+TEST_F(WorkspaceTests, Test_Growth_1) {
+    Workspace ws(1024);
+
+    ASSERT_EQ(0, ws.getNumberOfGrowths());
+
+    // fresh memory is zero, even though buffer wasn't memset on creation
+    auto ptr = reinterpret_cast<char*>(ws.allocateBytes(512));
+    for (int e = 0; e < 512; e++)
+        ASSERT_EQ(0, ptr[e]);
+
+    ws.allocateBytes(1500);
+    ASSERT_EQ(1500, ws.getSpilledSize());
+
+    ws.scopeOut();
+    ws.scopeIn();
+
+    ASSERT_EQ(1, ws.getNumberOfGrowths());
+    ASSERT_EQ(2048, ws.getCurrentSize());
+    ASSERT_EQ(1024, ws.getGrownBytes());
+    ASSERT_EQ(0, ws.getSpilledSize());
+
+    ws.allocateBytes(1000);
+    ws.scopeOut();
+    ws.scopeIn();
+
+    // this cycle fits, so no growth
+    ASSERT_EQ(1, ws.getNumberOfGrowths());
+
+    ws.allocateBytes(4000);
+    ws.scopeOut();
+    ws.scopeIn();
+
+    // grown geometrically, not to the exact cycle size
+    ASSERT_EQ(2, ws.getNumberOfGrowths());
+    ASSERT_EQ(4096, ws.getCurrentSize());
+}
+
+TEST_F(WorkspaceTests, Test_Arena_Switch_1) {
+    // both are big enough for per-thread arenas
+    Workspace wsA(2 * 1024 * 1024);
+    Workspace wsB(2 * 1024 * 1024);
+
+    for (int c = 0; c < 3; c++) {
+        wsA.scopeIn();
+        wsB.scopeIn();
+
+        // thread switches workspaces on every allocation, but each of them keeps its own arena
+        for (int e = 0; e < 48; e++) {
+            wsA.allocateBytes(256);
+            wsB.allocateBytes(256);
+        }
+
+        ASSERT_EQ(0, wsA.getSpilledSize());
+        ASSERT_EQ(0, wsB.getSpilledSize());
+        ASSERT_EQ(2 * 1024 * 1024, wsA.getCurrentSize());
+        ASSERT_EQ(2 * 1024 * 1024, wsB.getCurrentSize());
+
+        wsA.scopeOut();
+        wsB.scopeOut();
+    }
+}
+
+TEST_F(WorkspaceTests, Test_Mmap_1) {
+    Environment::getInstance()->setWorkspaceMmap(true);
+
+    Workspace ws(16 * 1024 * 1024);
+    NDArray<float> x('c', {100, 100}, &ws);
+    x.assign(2.0);
+
+    ASSERT_NEAR(2.0f, x.meanNumber(), 1e-5);
+
+    auto ptr = reinterpret_cast<char*>(ws.allocateBytes(1024));
+    for (int e = 0; e < 1024; e++)
+        ASSERT_EQ(0, ptr[e]);
+}
 
 #endif //LIBND4J_WORKSPACETESTS_H